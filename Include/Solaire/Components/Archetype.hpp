@@ -0,0 +1,210 @@
+#ifndef SOLAIRE_COMPONENTS_ARCHETYPE_HPP
+#define SOLAIRE_COMPONENTS_ARCHETYPE_HPP
+
+//Copyright 2015 Adam Smith
+//
+//Licensed under the Apache License, Version 2.0 (the "License");
+//you may not use this file except in compliance with the License.
+//You may obtain a copy of the License at
+//
+//    http://www.apache.org/licenses/LICENSE-2.0
+//
+//Unless required by applicable law or agreed to in writing, software
+//distributed under the License is distributed on an "AS IS" BASIS,
+//WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//See the License for the specific language governing permissions and
+//limitations under the License.
+
+// Contact :
+// Email             : solairelibrary@mail.com
+// GitHub repository : https://github.com/SolaireLibrary/SolaireCPP
+
+/*!
+	\file Archetype.hpp
+	\brief
+	\author
+	Created			: Adam Smith
+	Last modified	: Adam Smith
+	\version 1.0
+	\date
+	Created			: 18th October 2026
+	Last Modified	: 18th October 2026
+*/
+
+#include "Component.hpp"
+#include "..\Core\Allocator.hpp"
+#include "..\Core\DynamicArray.hpp"
+
+namespace Solaire {
+
+	/*!
+		\class Archetype
+		\brief Stores every entity that has exactly the same set of component types.
+		\detail
+		Entities are stored in chunks of CHUNK_BYTES, each chunk has one contiguous column per component type plus a column
+		of entity handles. Rows are kept packed, so every chunk except the last is full and erasing a row moves the last
+		row into its place.
+		Columns are aligned to COLUMN_ALIGNMENT bytes.
+		\author Adam Smith
+		\date Created : 18th October 2026
+		\date Modified : 18th October 2026
+		\version 1.0
+	*/
+	class Archetype {
+	public:
+		enum : uint32_t {
+			CHUNK_BYTES = 16 * 1024,
+			COLUMN_ALIGNMENT = 64
+		};
+
+		struct Chunk {
+			void* Memory;
+			uint8_t* Base;
+			uint32_t Count;
+		};
+	private:
+		enum : uint8_t {
+			NO_COLUMN = UINT8_MAX
+		};
+	private:
+		Allocator& mAllocator;
+		DynamicArray<Chunk> mChunks;
+		const ComponentMask mMask;
+		uint32_t mComponentCount;
+		uint32_t mChunkCapacity;
+		uint32_t mSize;
+		uint32_t mEntityOffset;
+		ComponentID mComponents[MAX_COMPONENT_TYPES];
+		uint32_t mOffsets[MAX_COMPONENT_TYPES];
+		uint8_t mColumns[MAX_COMPONENT_TYPES];
+		Archetype* mAddEdges[MAX_COMPONENT_TYPES];
+		Archetype* mRemoveEdges[MAX_COMPONENT_TYPES];
+	private:
+		Archetype(const Archetype&) = delete;
+		Archetype(Archetype&&) = delete;
+		Archetype& operator=(const Archetype&) = delete;
+		Archetype& operator=(Archetype&&) = delete;
+
+		uint32_t SOLAIRE_DEFAULT_CALL LayoutBytes(const uint32_t aCapacity) const throw();
+		void SOLAIRE_DEFAULT_CALL DestroyRow(const uint32_t aRow) throw();
+
+		SOLAIRE_FORCE_INLINE uint8_t* SOLAIRE_DEFAULT_CALL GetCell(const uint32_t aRow, const uint32_t aColumn) const throw() {
+			const Chunk& chunk = mChunks[aRow / mChunkCapacity];
+			return chunk.Base + mOffsets[aColumn] + GetComponentInfo(mComponents[aColumn]).Size * (aRow % mChunkCapacity);
+		}
+
+		SOLAIRE_FORCE_INLINE Entity& SOLAIRE_DEFAULT_CALL GetEntityCell(const uint32_t aRow) const throw() {
+			const Chunk& chunk = mChunks[aRow / mChunkCapacity];
+			return reinterpret_cast<Entity*>(chunk.Base + mEntityOffset)[aRow % mChunkCapacity];
+		}
+	public:
+		/*!
+			\brief Create an empty archetype, no chunks are allocated until the first entity is added.
+			\param aAllocator The allocator that chunks will be allocated from.
+			\param aMask The component types of the archetype, each type must already be registered.
+		*/
+		Archetype(Allocator& aAllocator, const ComponentMask aMask);
+		~Archetype();
+
+		/*!
+			\brief Add a row for an entity.
+			\detail The components of the new row are not constructed.
+			\param aEntity The entity that owns the row.
+			\return The index of the row.
+		*/
+		uint32_t SOLAIRE_DEFAULT_CALL PushRow(const Entity aEntity);
+
+		/*!
+			\brief Remove a row, the last row is moved into its place.
+			\param aRow The index of the row.
+			\param aDestroy True if the components of the row should be destroyed, false if they have already been moved.
+			\return The entity that was moved into \a aRow, or an invalid handle if no entity was moved.
+		*/
+		Entity SOLAIRE_DEFAULT_CALL EraseRow(const uint32_t aRow, const bool aDestroy) throw();
+
+		/*!
+			\brief Move the components of a row into another archetype.
+			\detail
+			Components that both archetypes have are relocated, components that only \a aSrc has are destroyed and components
+			that only \a aDst has are left unconstructed. The source row must still be erased with aDestroy set to false.
+			\param aSrc The archetype to move from.
+			\param aSrcRow The row to move from.
+			\param aDst The archetype to move to.
+			\param aDstRow The row to move to.
+		*/
+		static void SOLAIRE_DEFAULT_CALL MoveRow(Archetype& aSrc, const uint32_t aSrcRow, Archetype& aDst, const uint32_t aDstRow) throw();
+
+		/*!
+			\brief Destroy every row and release every chunk.
+		*/
+		void SOLAIRE_DEFAULT_CALL Clear() throw();
+
+		SOLAIRE_FORCE_INLINE void* SOLAIRE_DEFAULT_CALL GetComponent(const uint32_t aRow, const ComponentID aID) const throw() {
+			const uint8_t column = mColumns[aID];
+			return column == NO_COLUMN ? nullptr : GetCell(aRow, column);
+		}
+
+		SOLAIRE_FORCE_INLINE Entity SOLAIRE_DEFAULT_CALL GetEntity(const uint32_t aRow) const throw() {
+			return GetEntityCell(aRow);
+		}
+
+		/*!
+			\brief Get the column of a component type in a chunk.
+			\param aChunk The index of the chunk.
+			\param aID The component type.
+			\return The address of the first component in the chunk, or nullptr if the archetype does not have the type.
+		*/
+		SOLAIRE_FORCE_INLINE void* SOLAIRE_DEFAULT_CALL GetColumn(const uint32_t aChunk, const ComponentID aID) const throw() {
+			const uint8_t column = mColumns[aID];
+			return column == NO_COLUMN ? nullptr : mChunks[aChunk].Base + mOffsets[column];
+		}
+
+		SOLAIRE_FORCE_INLINE const Entity* SOLAIRE_DEFAULT_CALL GetEntities(const uint32_t aChunk) const throw() {
+			return reinterpret_cast<const Entity*>(mChunks[aChunk].Base + mEntityOffset);
+		}
+
+		SOLAIRE_FORCE_INLINE uint32_t SOLAIRE_DEFAULT_CALL GetChunkCount() const throw() {
+			return mChunks.Size();
+		}
+
+		SOLAIRE_FORCE_INLINE uint32_t SOLAIRE_DEFAULT_CALL GetChunkSize(const uint32_t aChunk) const throw() {
+			return mChunks[aChunk].Count;
+		}
+
+		SOLAIRE_FORCE_INLINE uint32_t SOLAIRE_DEFAULT_CALL GetChunkCapacity() const throw() {
+			return mChunkCapacity;
+		}
+
+		SOLAIRE_FORCE_INLINE uint32_t SOLAIRE_DEFAULT_CALL Size() const throw() {
+			return mSize;
+		}
+
+		SOLAIRE_FORCE_INLINE ComponentMask SOLAIRE_DEFAULT_CALL GetMask() const throw() {
+			return mMask;
+		}
+
+		SOLAIRE_FORCE_INLINE bool SOLAIRE_DEFAULT_CALL Contains(const ComponentMask aMask) const throw() {
+			return (mMask & aMask) == aMask;
+		}
+
+		// The archetype reached by adding or removing a component type, or nullptr if it has not been cached
+
+		SOLAIRE_FORCE_INLINE Archetype* SOLAIRE_DEFAULT_CALL GetAddEdge(const ComponentID aID) const throw() {
+			return mAddEdges[aID];
+		}
+
+		SOLAIRE_FORCE_INLINE Archetype* SOLAIRE_DEFAULT_CALL GetRemoveEdge(const ComponentID aID) const throw() {
+			return mRemoveEdges[aID];
+		}
+
+		SOLAIRE_FORCE_INLINE void SOLAIRE_DEFAULT_CALL SetAddEdge(const ComponentID aID, Archetype* const aArchetype) throw() {
+			mAddEdges[aID] = aArchetype;
+		}
+
+		SOLAIRE_FORCE_INLINE void SOLAIRE_DEFAULT_CALL SetRemoveEdge(const ComponentID aID, Archetype* const aArchetype) throw() {
+			mRemoveEdges[aID] = aArchetype;
+		}
+	};
+}
+
+#endif
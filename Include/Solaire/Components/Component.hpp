@@ -0,0 +1,139 @@
+#ifndef SOLAIRE_COMPONENTS_COMPONENT_HPP
+#define SOLAIRE_COMPONENTS_COMPONENT_HPP
+
+//Copyright 2015 Adam Smith
+//
+//Licensed under the Apache License, Version 2.0 (the "License");
+//you may not use this file except in compliance with the License.
+//You may obtain a copy of the License at
+//
+//    http://www.apache.org/licenses/LICENSE-2.0
+//
+//Unless required by applicable law or agreed to in writing, software
+//distributed under the License is distributed on an "AS IS" BASIS,
+//WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//See the License for the specific language governing permissions and
+//limitations under the License.
+
+// Contact :
+// Email             : solairelibrary@mail.com
+// GitHub repository : https://github.com/SolaireLibrary/SolaireCPP
+
+/*!
+	\file Component.hpp
+	\brief
+	\author
+	Created			: Adam Smith
+	Last modified	: Adam Smith
+	\version 1.0
+	\date
+	Created			: 18th October 2026
+	Last Modified	: 18th October 2026
+*/
+
+#include <new>
+#include <utility>
+#include <type_traits>
+#include "ModuleHeader.hpp"
+#include "..\Core\Init.hpp"
+#include "..\Core\SlotMap.hpp"
+
+namespace Solaire {
+
+	/*!
+		\brief A handle to an entity in a World.
+	*/
+	typedef SlotMapHandle Entity;
+
+	typedef uint32_t ComponentID;
+
+	/*!
+		\brief A set of component types, bit N is set if the component with ID N is in the set.
+	*/
+	typedef uint64_t ComponentMask;
+
+	enum : uint32_t {
+		MAX_COMPONENT_TYPES = 64
+	};
+
+	/*!
+		\class ComponentInfo
+		\brief Describes how to store a component type without knowing the type.
+		\author Adam Smith
+		\date Created : 18th October 2026
+		\date Modified : 18th October 2026
+		\version 1.0
+	*/
+	struct ComponentInfo {
+		uint32_t Size;
+		uint32_t Alignment;
+		bool IsTrivial;							//!< True if the type can be relocated with memcpy and needs no destructor.
+		void(*Relocate)(void*, void*);			//!< Move construct the first address from the second, then destroy the second.
+		void(*Destroy)(void*);
+	};
+
+	namespace Implementation {
+		template<class T>
+		static void SOLAIRE_DEFAULT_CALL RelocateComponent(void* const aDst, void* const aSrc) {
+			T& src = *static_cast<T*>(aSrc);
+			new(aDst) T(std::move(src));
+			src.~T();
+		}
+
+		template<class T>
+		static void SOLAIRE_DEFAULT_CALL DestroyComponent(void* const aObject) {
+			static_cast<T*>(aObject)->~T();
+		}
+
+		/*!
+			\brief Assign the next free ID to a component type.
+			\param aInfo The description of the type.
+			\return The ID of the type.
+		*/
+		ComponentID SOLAIRE_DEFAULT_CALL RegisterComponent(const ComponentInfo& aInfo);
+	}
+
+	/*!
+		\brief Get the description of a registered component type.
+		\param aID The ID of the type.
+		\return The description of the type.
+	*/
+	const ComponentInfo& SOLAIRE_DEFAULT_CALL GetComponentInfo(const ComponentID aID) throw();
+
+	/*!
+		\brief Get the ID of a component type, the type is registered the first time this is called.
+		\detail IDs are assigned in the order that types are first used, at most MAX_COMPONENT_TYPES types can be registered.
+		\tparam T The component type.
+		\return The ID of \a T.
+	*/
+	template<class T>
+	ComponentID SOLAIRE_DEFAULT_CALL GetComponentID() {
+		static const ComponentID ID = Implementation::RegisterComponent({
+			sizeof(T),
+			std::alignment_of<T>::value,
+			std::is_trivially_copyable<T>::value && std::is_trivially_destructible<T>::value,
+			&Implementation::RelocateComponent<T>,
+			&Implementation::DestroyComponent<T>
+		});
+		return ID;
+	}
+
+	template<class T>
+	inline SOLAIRE_FORCE_INLINE ComponentMask SOLAIRE_DEFAULT_CALL GetComponentMask() {
+		return static_cast<ComponentMask>(1) << GetComponentID<typename std::remove_const<T>::type>();
+	}
+
+	/*!
+		\brief Get the set of several component types.
+		\detail A const component type has the same ID as the type without const.
+		\tparam T The first component type.
+		\tparam COMPONENTS The remaining component types.
+		\return The set containing each type.
+	*/
+	template<class T, class T2, class ...COMPONENTS>
+	inline SOLAIRE_FORCE_INLINE ComponentMask SOLAIRE_DEFAULT_CALL GetComponentMask() {
+		return GetComponentMask<T>() | GetComponentMask<T2, COMPONENTS...>();
+	}
+}
+
+#endif
@@ -0,0 +1,241 @@
+#ifndef SOLAIRE_COMPONENTS_SYSTEM_SCHEDULER_HPP
+#define SOLAIRE_COMPONENTS_SYSTEM_SCHEDULER_HPP
+
+//Copyright 2015 Adam Smith
+//
+//Licensed under the Apache License, Version 2.0 (the "License");
+//you may not use this file except in compliance with the License.
+//You may obtain a copy of the License at
+//
+//    http://www.apache.org/licenses/LICENSE-2.0
+//
+//Unless required by applicable law or agreed to in writing, software
+//distributed under the License is distributed on an "AS IS" BASIS,
+//WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//See the License for the specific language governing permissions and
+//limitations under the License.
+
+// Contact :
+// Email             : solairelibrary@mail.com
+// GitHub repository : https://github.com/SolaireLibrary/SolaireCPP
+
+/*!
+	\file SystemScheduler.hpp
+	\brief
+	\author
+	Created			: Adam Smith
+	Last modified	: Adam Smith
+	\version 1.0
+	\date
+	Created			: 18th October 2026
+	Last Modified	: 18th October 2026
+*/
+
+#include <atomic>
+#include <type_traits>
+#include "World.hpp"
+#include "..\Core\TaskScheduler.hpp"
+
+namespace Solaire {
+
+	/*!
+		\class System
+		\brief A unit of work that reads and writes components of a World.
+		\detail
+		The scheduler uses the read and write masks to decide which systems can run at the same time.
+		A system's work is split into tasks, tasks of the same system may run concurrently on different threads.
+		Systems must not create or destroy entities, or add or remove components, while the scheduler is running.
+		\author Adam Smith
+		\date Created : 18th October 2026
+		\date Modified : 18th October 2026
+		\version 1.0
+	*/
+	SOLAIRE_EXPORT_INTERFACE System {
+	public:
+		virtual ComponentMask SOLAIRE_EXPORT_CALL GetReadMask() const = 0;
+		virtual ComponentMask SOLAIRE_EXPORT_CALL GetWriteMask() const = 0;
+
+		/*!
+			\brief Called once on a single thread before any of this run's tasks are executed.
+			\param aWorld The world being updated.
+			\return The number of tasks to execute.
+		*/
+		virtual uint32_t SOLAIRE_EXPORT_CALL Prepare(World& aWorld) = 0;
+
+		/*!
+			\brief Execute one task.
+			\detail This may be called on a worker thread, so it must not throw.
+			\param aWorld The world being updated.
+			\param aTask The index of the task, less than the value returned by Prepare.
+		*/
+		virtual void SOLAIRE_EXPORT_CALL Execute(World& aWorld, const uint32_t aTask) = 0;
+
+		virtual SOLAIRE_EXPORT_CALL ~System(){}
+	};
+
+	namespace Implementation {
+		template<class T>
+		inline SOLAIRE_FORCE_INLINE ComponentMask SOLAIRE_DEFAULT_CALL GetComponentWriteMask() {
+			return std::is_const<T>::value ? 0 : GetComponentMask<typename std::remove_const<T>::type>();
+		}
+
+		template<class T, class T2, class ...COMPONENTS>
+		inline SOLAIRE_FORCE_INLINE ComponentMask SOLAIRE_DEFAULT_CALL GetComponentWriteMask() {
+			return GetComponentWriteMask<T>() | GetComponentWriteMask<T2, COMPONENTS...>();
+		}
+	}
+
+	/*!
+		\class ChunkSystem
+		\brief A System that calls a function on each archetype chunk with a set of components, one task per chunk.
+		\detail Component types that are only read should be const qualified, all other types are written.
+		\tparam F A function with the signature void(uint32_t aCount, T* aColumn, COMPONENTS*... aColumns).
+		\tparam T The first component type.
+		\tparam COMPONENTS The remaining component types.
+		\author Adam Smith
+		\date Created : 18th October 2026
+		\date Modified : 18th October 2026
+		\version 1.0
+	*/
+	template<class F, class T, class ...COMPONENTS>
+	class ChunkSystem : public System {
+	private:
+		struct Task {
+			const Archetype* Owner;
+			uint32_t Chunk;
+		};
+	private:
+		DynamicArray<Task> mTasks;
+		F mFunction;
+	public:
+		ChunkSystem(Allocator& aAllocator, F aFunction) :
+			mTasks(aAllocator),
+			mFunction(aFunction)
+		{}
+
+		SOLAIRE_EXPORT_CALL ~ChunkSystem() {
+
+		}
+
+		// Inherited from System
+
+		ComponentMask SOLAIRE_EXPORT_CALL GetReadMask() const override {
+			return GetComponentMask<typename std::remove_const<T>::type, typename std::remove_const<COMPONENTS>::type...>();
+		}
+
+		ComponentMask SOLAIRE_EXPORT_CALL GetWriteMask() const override {
+			return Implementation::GetComponentWriteMask<T, COMPONENTS...>();
+		}
+
+		uint32_t SOLAIRE_EXPORT_CALL Prepare(World& aWorld) override {
+			const ComponentMask mask = GetReadMask();
+			const uint32_t count = aWorld.GetArchetypeCount();
+			mTasks.Clear();
+			for(uint32_t i = 0; i < count; ++i) {
+				const Archetype& archetype = aWorld.GetArchetype(i);
+				if(! archetype.Contains(mask)) continue;
+				const uint32_t chunks = archetype.GetChunkCount();
+				for(uint32_t j = 0; j < chunks; ++j) mTasks.PushBack(Task{&archetype, j});
+			}
+			return mTasks.Size();
+		}
+
+		void SOLAIRE_EXPORT_CALL Execute(World&, const uint32_t aTask) override {
+			const Task task = mTasks[aTask];
+			const Archetype& archetype = *task.Owner;
+			mFunction(
+				archetype.GetChunkSize(task.Chunk),
+				static_cast<T*>(archetype.GetColumn(task.Chunk, GetComponentID<typename std::remove_const<T>::type>())),
+				static_cast<COMPONENTS*>(archetype.GetColumn(task.Chunk, GetComponentID<typename std::remove_const<COMPONENTS>::type>()))...
+			);
+		}
+	};
+
+	/*!
+		\brief Create a ChunkSystem.
+		\tparam T The first component type, const qualified if it is only read.
+		\tparam COMPONENTS The remaining component types, const qualified if they are only read.
+		\param aAllocator The allocator that the task list will be allocated from.
+		\param aFunction A function with the signature void(uint32_t aCount, T* aColumn, COMPONENTS*... aColumns).
+		\return The system.
+	*/
+	template<class T, class ...COMPONENTS, class F>
+	static ChunkSystem<F, T, COMPONENTS...> SOLAIRE_DEFAULT_CALL MakeChunkSystem(Allocator& aAllocator, F aFunction) {
+		return ChunkSystem<F, T, COMPONENTS...>(aAllocator, aFunction);
+	}
+
+	/*!
+		\class SystemScheduler
+		\brief Runs the systems of a World in parallel on a TaskScheduler.
+		\detail
+		Two systems conflict if either writes a component type that the other reads or writes, a system waits for every
+		conflicting system that was added before it, so the result is the same as running the systems in the order they were
+		added. Systems that do not conflict run concurrently.
+		When a system becomes ready it is split into one job per thread that can help, each job claims tasks from the system
+		until none are left. Jobs are run in a single TaskGroup, so the thread that calls Run also executes them.
+		\author Adam Smith
+		\date Created : 18th October 2026
+		\date Modified : 18th October 2026
+		\version 1.0
+		\see TaskScheduler
+	*/
+	class SystemScheduler {
+	private:
+		struct Node {
+			System* Target;
+			DynamicArray<uint32_t> Dependents;
+			uint32_t DependencyCount;
+			uint32_t TaskCount;
+			std::atomic<uint32_t> Remaining;
+			std::atomic<uint32_t> NextTask;
+			std::atomic<uint32_t> CompletedTasks;
+
+			Node(Allocator& aAllocator, System& aTarget);
+		};
+	private:
+		Allocator& mAllocator;
+		World& mWorld;
+		TaskScheduler& mScheduler;
+		DynamicArray<Node*> mNodes;
+	private:
+		SystemScheduler(const SystemScheduler&) = delete;
+		SystemScheduler(SystemScheduler&&) = delete;
+		SystemScheduler& operator=(const SystemScheduler&) = delete;
+		SystemScheduler& operator=(SystemScheduler&&) = delete;
+
+		void SOLAIRE_DEFAULT_CALL RunJob(TaskGroup& aGroup, const uint32_t aNode);
+		void SOLAIRE_DEFAULT_CALL Schedule(TaskGroup& aGroup, const uint32_t aNode);
+		void SOLAIRE_DEFAULT_CALL Complete(TaskGroup& aGroup, const uint32_t aNode);
+	public:
+		/*!
+			\brief Create a scheduler.
+			\param aAllocator The allocator that the scheduler will allocate from.
+			\param aWorld The world that systems will be run on.
+			\param aScheduler The task scheduler that systems will be executed on.
+		*/
+		SystemScheduler(Allocator& aAllocator, World& aWorld, TaskScheduler& aScheduler);
+		~SystemScheduler();
+
+		/*!
+			\brief Add a system, it will run after every conflicting system that has already been added.
+			\detail Must not be called while Run is executing.
+			\param aSystem The system, it must remain valid for the lifetime of the scheduler.
+		*/
+		void SOLAIRE_DEFAULT_CALL AddSystem(System& aSystem);
+
+		/*!
+			\brief Run every system once, returns when they have all completed.
+		*/
+		void SOLAIRE_DEFAULT_CALL Run();
+
+		SOLAIRE_FORCE_INLINE TaskScheduler& SOLAIRE_DEFAULT_CALL GetScheduler() const throw() {
+			return mScheduler;
+		}
+
+		SOLAIRE_FORCE_INLINE uint32_t SOLAIRE_DEFAULT_CALL GetSystemCount() const throw() {
+			return mNodes.Size();
+		}
+	};
+}
+
+#endif
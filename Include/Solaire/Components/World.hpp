@@ -0,0 +1,388 @@
+#ifndef SOLAIRE_COMPONENTS_WORLD_HPP
+#define SOLAIRE_COMPONENTS_WORLD_HPP
+
+//Copyright 2015 Adam Smith
+//
+//Licensed under the Apache License, Version 2.0 (the "License");
+//you may not use this file except in compliance with the License.
+//You may obtain a copy of the License at
+//
+//    http://www.apache.org/licenses/LICENSE-2.0
+//
+//Unless required by applicable law or agreed to in writing, software
+//distributed under the License is distributed on an "AS IS" BASIS,
+//WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//See the License for the specific language governing permissions and
+//limitations under the License.
+
+// Contact :
+// Email             : solairelibrary@mail.com
+// GitHub repository : https://github.com/SolaireLibrary/SolaireCPP
+
+/*!
+	\file World.hpp
+	\brief
+	\author
+	Created			: Adam Smith
+	Last modified	: Adam Smith
+	\version 1.0
+	\date
+	Created			: 18th October 2026
+	Last Modified	: 18th October 2026
+*/
+
+#include "Archetype.hpp"
+#include "..\Core\Container.hpp"
+#include "..\Core\Iterator.hpp"
+
+namespace Solaire {
+
+	/*!
+		\class World
+		\brief Stores entities and their components, grouped into an Archetype for each distinct set of component types.
+		\detail
+		Adding or removing a component moves the entity to another archetype, the archetype reached by each transition
+		is cached so that repeated transitions do not need to search.
+		Queries visit each matching chunk once and pass the columns directly, so a system iterates over plain arrays.
+		Entities and components must not be added or removed while a query is running.
+		At most MAX_COMPONENT_TYPES component types can be used.
+		\author Adam Smith
+		\date Created : 18th October 2026
+		\date Modified : 18th October 2026
+		\version 1.0
+	*/
+	class World {
+	private:
+		struct EntityLocation {
+			Archetype* Owner;
+			uint32_t Row;
+		};
+	private:
+		Allocator& mAllocator;
+		SlotMap<EntityLocation> mEntities;
+		DynamicArray<Archetype*> mArchetypes;
+		Archetype* mRoot;
+	private:
+		World(const World&) = delete;
+		World(World&&) = delete;
+		World& operator=(const World&) = delete;
+		World& operator=(World&&) = delete;
+
+		Archetype& SOLAIRE_DEFAULT_CALL FindArchetype(const ComponentMask aMask);
+		void SOLAIRE_DEFAULT_CALL MoveEntity(EntityLocation& aLocation, const Entity aEntity, Archetype& aTarget);
+	public:
+		World(Allocator& aAllocator);
+		~World();
+
+		Entity SOLAIRE_DEFAULT_CALL CreateEntity();
+
+		/*!
+			\brief Destroy an entity and all of its components.
+			\param aEntity The entity to destroy.
+			\return False if the entity was already destroyed.
+		*/
+		bool SOLAIRE_DEFAULT_CALL DestroyEntity(const Entity aEntity) throw();
+
+		/*!
+			\brief Add a component to an entity without constructing it.
+			\param aEntity The entity, must be alive.
+			\param aID The component type.
+			\param aExists Set to true if the entity already had the component, in which case it is still constructed.
+			\return The address of the component.
+		*/
+		void* SOLAIRE_DEFAULT_CALL AddComponent(const Entity aEntity, const ComponentID aID, bool& aExists);
+
+		/*!
+			\brief Destroy a component and remove it from an entity.
+			\param aEntity The entity.
+			\param aID The component type.
+			\return False if the entity is not alive or does not have the component.
+		*/
+		bool SOLAIRE_DEFAULT_CALL RemoveComponent(const Entity aEntity, const ComponentID aID);
+
+		/*!
+			\brief Get a component of an entity.
+			\detail The address is invalidated when a component is added to or removed from any entity.
+			\param aEntity The entity.
+			\param aID The component type.
+			\return The address of the component, or nullptr if the entity is not alive or does not have the component.
+		*/
+		void* SOLAIRE_DEFAULT_CALL GetComponent(const Entity aEntity, const ComponentID aID) const throw();
+
+		SOLAIRE_FORCE_INLINE bool SOLAIRE_DEFAULT_CALL IsAlive(const Entity aEntity) const throw() {
+			return mEntities.Contains(aEntity);
+		}
+
+		SOLAIRE_FORCE_INLINE uint32_t SOLAIRE_DEFAULT_CALL GetEntityCount() const throw() {
+			return mEntities.Size();
+		}
+
+		SOLAIRE_FORCE_INLINE uint32_t SOLAIRE_DEFAULT_CALL GetArchetypeCount() const throw() {
+			return mArchetypes.Size();
+		}
+
+		SOLAIRE_FORCE_INLINE Archetype& SOLAIRE_DEFAULT_CALL GetArchetype(const uint32_t aIndex) const throw() {
+			return *mArchetypes[aIndex];
+		}
+
+		SOLAIRE_FORCE_INLINE Allocator& SOLAIRE_DEFAULT_CALL GetAllocator() const throw() {
+			return mAllocator;
+		}
+
+		/*!
+			\brief Add a component to an entity, or replace it if the entity already has one.
+			\tparam T The component type, must be nothrow move constructible.
+			\tparam PARAMS The parameter types to pass to the component's constructor.
+			\param aEntity The entity, must be alive.
+			\param aParams The parameters to pass to the component's constructor.
+			\return The component.
+		*/
+		template<class T, class ...PARAMS>
+		T& SOLAIRE_DEFAULT_CALL AddComponent(const Entity aEntity, PARAMS&&... aParams) {
+			// The parameters may refer to components that will be moved
+			T tmp(std::forward<PARAMS>(aParams)...);
+			bool exists;
+			T* const component = static_cast<T*>(AddComponent(aEntity, GetComponentID<typename std::remove_const<T>::type>(), exists));
+			if(exists) {
+				*component = std::move(tmp);
+				return *component;
+			}
+			return *new(component) T(std::move(tmp));
+		}
+
+		template<class T>
+		SOLAIRE_FORCE_INLINE bool SOLAIRE_DEFAULT_CALL RemoveComponent(const Entity aEntity) {
+			return RemoveComponent(aEntity, GetComponentID<typename std::remove_const<T>::type>());
+		}
+
+		template<class T>
+		SOLAIRE_FORCE_INLINE T* SOLAIRE_DEFAULT_CALL GetComponent(const Entity aEntity) const throw() {
+			return static_cast<T*>(GetComponent(aEntity, GetComponentID<typename std::remove_const<T>::type>()));
+		}
+
+		template<class T>
+		SOLAIRE_FORCE_INLINE bool SOLAIRE_DEFAULT_CALL HasComponent(const Entity aEntity) const throw() {
+			return GetComponent(aEntity, GetComponentID<typename std::remove_const<T>::type>()) != nullptr;
+		}
+
+		/*!
+			\brief Call a function on each chunk of entities that have a set of component types.
+			\tparam T The first component type, may be const.
+			\tparam COMPONENTS The remaining component types, may be const.
+			\param aFunction A function with the signature void(uint32_t aCount, T* aColumn, COMPONENTS*... aColumns).
+			Each column contains \a aCount components, element i of every column belongs to the same entity.
+		*/
+		template<class T, class ...COMPONENTS, class F>
+		void SOLAIRE_DEFAULT_CALL ForEachChunk(F aFunction) {
+			const ComponentMask mask = GetComponentMask<T, COMPONENTS...>();
+			const ComponentID id = GetComponentID<typename std::remove_const<T>::type>();
+			const uint32_t count = mArchetypes.Size();
+			for(uint32_t i = 0; i < count; ++i) {
+				const Archetype& archetype = *mArchetypes[i];
+				if(! archetype.Contains(mask)) continue;
+				const uint32_t chunks = archetype.GetChunkCount();
+				for(uint32_t j = 0; j < chunks; ++j) {
+					aFunction(
+						archetype.GetChunkSize(j),
+						static_cast<T*>(archetype.GetColumn(j, id)),
+						static_cast<COMPONENTS*>(archetype.GetColumn(j, GetComponentID<typename std::remove_const<COMPONENTS>::type>()))...
+					);
+				}
+			}
+		}
+
+		/*!
+			\brief Call a function on each entity that has a set of component types.
+			\tparam T The first component type.
+			\tparam COMPONENTS The remaining component types.
+			\param aFunction A function with the signature void(T&, COMPONENTS&...).
+			\see ForEachChunk
+		*/
+		template<class T, class ...COMPONENTS, class F>
+		void SOLAIRE_DEFAULT_CALL ForEach(F aFunction) {
+			ForEachChunk<T, COMPONENTS...>([&aFunction](const uint32_t aCount, T* const aColumn, COMPONENTS* const... aColumns) {
+				for(uint32_t i = 0; i < aCount; ++i) aFunction(aColumn[i], aColumns[i]...);
+			});
+		}
+	};
+
+	/*!
+		\class ComponentViewIterator
+		\brief Iterates over the elements of a FixedContainer by index.
+		\author Adam Smith
+		\date Created : 18th October 2026
+		\date Modified : 18th October 2026
+		\version 1.0
+	*/
+	template<class T>
+	class ComponentViewIterator : public Iterator<T> {
+	public:
+		typedef typename Iterator<T>::Type Type;
+		typedef typename Iterator<T>::Offset Offset;
+	private:
+		FixedContainer<T>* mContainer;
+		Offset mOffset;
+	protected:
+		//Inherited from Iterator
+		Offset SOLAIRE_EXPORT_CALL GetOffset() const throw() override {
+			return mOffset;
+		}
+	public:
+		ComponentViewIterator(FixedContainer<T>& aContainer, const Offset aOffset) :
+			mContainer(&aContainer),
+			mOffset(aOffset)
+		{}
+
+		SOLAIRE_EXPORT_CALL ~ComponentViewIterator() {
+
+		}
+
+		// Inherited from Iterator
+
+		Type* SOLAIRE_EXPORT_CALL operator->() throw() override final {
+			return &mContainer->operator[](static_cast<uint32_t>(mOffset));
+		}
+
+		Iterator<Type>& SOLAIRE_EXPORT_CALL operator++() throw() override final {
+			++mOffset;
+			return *this;
+		}
+
+		Iterator<Type>& SOLAIRE_EXPORT_CALL operator--() throw() override final {
+			--mOffset;
+			return *this;
+		}
+
+		Iterator<Type>& SOLAIRE_EXPORT_CALL operator+=(const Offset aOffset) throw() override final {
+			mOffset += aOffset;
+			return *this;
+		}
+
+		Iterator<Type>& SOLAIRE_EXPORT_CALL operator-=(const Offset aOffset) throw() override final {
+			mOffset -= aOffset;
+			return *this;
+		}
+
+		SOLAIRE_FORCE_INLINE Type& SOLAIRE_DEFAULT_CALL operator*() throw() {
+			return *operator->();
+		}
+	};
+
+	/*!
+		\class ComponentView
+		\brief Presents every component of one type in a World as a FixedContainer.
+		\detail
+		GetChunk returns one column of one archetype chunk at a time, so ForEachChunk visits each column with a single call.
+		The archetypes are captured when the view is created, the view is invalidated when an entity or component is
+		added or removed.
+		\tparam T The component type, a const type gives read only access to the same components.
+		\author Adam Smith
+		\date Created : 18th October 2026
+		\date Modified : 18th October 2026
+		\version 1.0
+	*/
+	template<class T>
+	class ComponentView : public FixedContainer<T> {
+	public:
+		typedef typename FixedContainer<T>::Type Type;
+	private:
+		World& mWorld;
+		DynamicArray<Archetype*> mArchetypes;
+		ComponentViewIterator<T> mBeginIterator;
+		const ComponentID mID;
+		uint32_t mSize;
+		uint32_t mCursorArchetype;
+		uint32_t mCursorChunk;
+		uint32_t mCursorBase;
+	private:
+		ComponentView(const ComponentView<T>&) = delete;
+		ComponentView<T>& operator=(const ComponentView<T>&) = delete;
+
+		T* SOLAIRE_DEFAULT_CALL Locate(const uint32_t aIndex, uint32_t& aLength) throw() {
+			// Sequential access only moves the cursor forward
+			if(aIndex < mCursorBase) {
+				mCursorArchetype = 0;
+				mCursorChunk = 0;
+				mCursorBase = 0;
+			}
+
+			while(true) {
+				const Archetype& archetype = *mArchetypes[mCursorArchetype];
+				const uint32_t count = archetype.GetChunkSize(mCursorChunk);
+				if(aIndex < mCursorBase + count) {
+					const uint32_t offset = aIndex - mCursorBase;
+					aLength = count - offset;
+					return static_cast<T*>(archetype.GetColumn(mCursorChunk, mID)) + offset;
+				}
+
+				mCursorBase += count;
+				if(++mCursorChunk == archetype.GetChunkCount()) {
+					++mCursorArchetype;
+					mCursorChunk = 0;
+				}
+			}
+		}
+	public:
+		ComponentView(World& aWorld) :
+			mWorld(aWorld),
+			mArchetypes(aWorld.GetAllocator()),
+			mBeginIterator(*this, 0),
+			mID(GetComponentID<typename std::remove_const<T>::type>()),
+			mSize(0),
+			mCursorArchetype(0),
+			mCursorChunk(0),
+			mCursorBase(0)
+		{
+			const ComponentMask mask = GetComponentMask<T>();
+			const uint32_t count = aWorld.GetArchetypeCount();
+			for(uint32_t i = 0; i < count; ++i) {
+				Archetype& archetype = aWorld.GetArchetype(i);
+				if(archetype.Contains(mask) && archetype.Size() > 0) {
+					mArchetypes.PushBack(&archetype);
+					mSize += archetype.Size();
+				}
+			}
+		}
+
+		SOLAIRE_EXPORT_CALL ~ComponentView() {
+
+		}
+
+		SOLAIRE_FORCE_INLINE World& SOLAIRE_DEFAULT_CALL GetWorld() const throw() {
+			return mWorld;
+		}
+
+		// Inherited from FixedContainer
+
+		uint32_t SOLAIRE_EXPORT_CALL Size() const override {
+			return mSize;
+		}
+
+		Type& SOLAIRE_EXPORT_CALL operator[](const uint32_t aIndex) override {
+			uint32_t length;
+			return *Locate(aIndex, length);
+		}
+
+		bool SOLAIRE_EXPORT_CALL IsContiguous() const override {
+			return mArchetypes.Size() == 1 && mArchetypes[0]->GetChunkCount() == 1;
+		}
+
+		Allocator& SOLAIRE_EXPORT_CALL GetAllocator() const override {
+			return mWorld.GetAllocator();
+		}
+
+		bool SOLAIRE_EXPORT_CALL Reserve(const uint32_t aCapacity) override {
+			return aCapacity <= mSize;
+		}
+
+		Solaire::Iterator<T>& SOLAIRE_EXPORT_CALL GetBeginIterator() override {
+			return mBeginIterator;
+		}
+
+		Type* SOLAIRE_EXPORT_CALL GetChunk(const uint32_t aIndex, uint32_t& aLength) override {
+			return Locate(aIndex, aLength);
+		}
+	};
+}
+
+#endif
@@ -28,9 +28,10 @@
 	\version 1.0
 	\date
 	Created			: 25th September 2015
-	Last Modified	: 4th January 2015
+	Last Modified	: 18th October 2026
 */
 
+#include <utility>
 #include "AllocatorI.hpp"
 #include "UniqueAllocation.hpp"
 #include "SharedAllocation.hpp"
@@ -66,7 +67,7 @@ namespace Solaire {
 		*/
 		template<class T, typename ...PARAMS>
 		SOLAIRE_FORCE_INLINE T* SOLAIRE_DEFAULT_CALL RawAllocate(PARAMS&&... aParams) {
-			return new(Allocate(sizeof(T))) T(aParams...);
+			return new(Allocate(sizeof(T))) T(std::forward<PARAMS>(aParams)...);
 		}
 
 		/*!
@@ -82,7 +83,7 @@ namespace Solaire {
 		SOLAIRE_FORCE_INLINE UniqueAllocation<T> SOLAIRE_DEFAULT_CALL UniqueAllocate(PARAMS&&... aParams) {
 			return UniqueAllocation<T>(
 				*this,
-				new(Allocate(sizeof(T))) T(aParams...)
+				new(Allocate(sizeof(T))) T(std::forward<PARAMS>(aParams)...)
 			);
 		}
 
@@ -99,7 +100,7 @@ namespace Solaire {
 		SOLAIRE_FORCE_INLINE SharedAllocation<T> SOLAIRE_DEFAULT_CALL SharedAllocate(PARAMS&&... aParams) {
 			return SharedAllocation<T>(
 				*this,
-				new(Allocate(sizeof(T))) T(aParams...)
+				new(Allocate(sizeof(T))) T(std::forward<PARAMS>(aParams)...)
 			);
 		}
     };
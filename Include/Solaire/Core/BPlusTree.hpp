@@ -0,0 +1,1077 @@
+#ifndef SOLAIRE_BPLUS_TREE_HPP
+#define SOLAIRE_BPLUS_TREE_HPP
+
+//Copyright 2015 Adam Smith
+//
+//Licensed under the Apache License, Version 2.0 (the "License");
+//you may not use this file except in compliance with the License.
+//You may obtain a copy of the License at
+//
+//    http://www.apache.org/licenses/LICENSE-2.0
+//
+//Unless required by applicable law or agreed to in writing, software
+//distributed under the License is distributed on an "AS IS" BASIS,
+//WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//See the License for the specific language governing permissions and
+//limitations under the License.
+
+// Contact :
+// Email             : solairelibrary@mail.com
+// GitHub repository : https://github.com/SolaireLibrary/SolaireCPP
+
+/*!
+	\file BPlusTree.hpp
+	\brief
+	\author
+	Created			: Adam Smith
+	Last modified	: Adam Smith
+	\version 1.0
+	\date
+	Created			: 18th October 2026
+	Last Modified	: 18th October 2026
+*/
+
+#include <new>
+#include <cstring>
+#include <utility>
+#include <stdexcept>
+#include <type_traits>
+#include "AllocatorI.hpp"
+#include "PoolAllocator.hpp"
+#include "Iterator.hpp"
+#include "Maths.hpp"
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+	#include <emmintrin.h>
+	#define SOLAIRE_BPLUS_TREE_SSE2
+#endif
+
+namespace Solaire {
+
+	enum : uint32_t {
+		BPLUS_TREE_CACHE_LINE = 64,
+		/*!
+			The default size of a node in cache lines. With 32 bit keys an inner node holds 20 keys in its first two lines,
+			which the adjacent line prefetcher loads together, and a fan out of 21 keeps a million keys within 5 levels.
+			Larger nodes shift and copy more lines on every insert and split without reducing the depth much.
+		*/
+		BPLUS_TREE_NODE_LINES = 4
+	};
+
+	namespace Implementation {
+
+		/*!
+			\brief Search a sorted array of keys.
+			\detail The generic implementation is a binary search, 32 bit integer keys are specialised to compare 4 keys at once.
+		*/
+		template<class K>
+		struct BPlusTreeSearch {
+			// Index of the first key that is not less than aKey
+			static uint32_t SOLAIRE_DEFAULT_CALL LowerBound(const K* const aKeys, uint32_t aCount, const K& aKey) throw() {
+				const K* begin = aKeys;
+				while(aCount > 0) {
+					const uint32_t half = aCount / 2;
+					if(begin[half] < aKey) {
+						begin += half + 1;
+						aCount -= half + 1;
+					}else {
+						aCount = half;
+					}
+				}
+				return static_cast<uint32_t>(begin - aKeys);
+			}
+
+			// Index of the first key that is greater than aKey
+			static uint32_t SOLAIRE_DEFAULT_CALL UpperBound(const K* const aKeys, uint32_t aCount, const K& aKey) throw() {
+				const K* begin = aKeys;
+				while(aCount > 0) {
+					const uint32_t half = aCount / 2;
+					if(aKey < begin[half]) {
+						aCount = half;
+					}else {
+						begin += half + 1;
+						aCount -= half + 1;
+					}
+				}
+				return static_cast<uint32_t>(begin - aKeys);
+			}
+		};
+
+		#ifdef SOLAIRE_BPLUS_TREE_SSE2
+			template<class K, uint32_t FLIP>
+			struct BPlusTreeSearchSSE2 {
+				// Node keys are sorted, so the keys that compare true against aKey are always a prefix of each group
+
+				static uint32_t SOLAIRE_DEFAULT_CALL LowerBound(const K* const aKeys, const uint32_t aCount, const K aKey) throw() {
+					const __m128i flip = _mm_set1_epi32(static_cast<int32_t>(FLIP));
+					const __m128i key = _mm_set1_epi32(static_cast<int32_t>(static_cast<uint32_t>(aKey) ^ FLIP));
+					uint32_t i = 0;
+					for(; i + 4 <= aCount; i += 4) {
+						const __m128i keys = _mm_xor_si128(_mm_loadu_si128(reinterpret_cast<const __m128i*>(aKeys + i)), flip);
+						const uint32_t less = static_cast<uint32_t>(_mm_movemask_ps(_mm_castsi128_ps(_mm_cmplt_epi32(keys, key))));
+						if(less != 0xF) return i + CountTrailingZeros(~less);
+					}
+					while(i < aCount && aKeys[i] < aKey) ++i;
+					return i;
+				}
+
+				static uint32_t SOLAIRE_DEFAULT_CALL UpperBound(const K* const aKeys, const uint32_t aCount, const K aKey) throw() {
+					const __m128i flip = _mm_set1_epi32(static_cast<int32_t>(FLIP));
+					const __m128i key = _mm_set1_epi32(static_cast<int32_t>(static_cast<uint32_t>(aKey) ^ FLIP));
+					uint32_t i = 0;
+					for(; i + 4 <= aCount; i += 4) {
+						const __m128i keys = _mm_xor_si128(_mm_loadu_si128(reinterpret_cast<const __m128i*>(aKeys + i)), flip);
+						const uint32_t greater = static_cast<uint32_t>(_mm_movemask_ps(_mm_castsi128_ps(_mm_cmpgt_epi32(keys, key))));
+						if(greater != 0) return i + CountTrailingZeros(greater);
+					}
+					while(i < aCount && ! (aKey < aKeys[i])) ++i;
+					return i;
+				}
+			};
+
+			// SSE2 only has signed comparisons, so unsigned keys have their sign bit flipped
+
+			template<>
+			struct BPlusTreeSearch<int32_t> : public BPlusTreeSearchSSE2<int32_t, 0> {};
+
+			template<>
+			struct BPlusTreeSearch<uint32_t> : public BPlusTreeSearchSSE2<uint32_t, 0x80000000> {};
+		#endif
+
+		/*!
+			\brief Uninitialised storage for the elements of a node.
+		*/
+		template<class T, uint32_t CAPACITY>
+		class BPlusTreeArray {
+		public:
+			enum : uint32_t {
+				ELEMENT_SIZE = sizeof(T)
+			};
+		private:
+			alignas(T) uint8_t mData[sizeof(T) * CAPACITY];
+		public:
+			SOLAIRE_FORCE_INLINE T* SOLAIRE_DEFAULT_CALL GetPtr() throw() {
+				return reinterpret_cast<T*>(mData);
+			}
+
+			SOLAIRE_FORCE_INLINE const T* SOLAIRE_DEFAULT_CALL GetPtr() const throw() {
+				return reinterpret_cast<const T*>(mData);
+			}
+
+			SOLAIRE_FORCE_INLINE T& SOLAIRE_DEFAULT_CALL operator[](const uint32_t aIndex) throw() {
+				return GetPtr()[aIndex];
+			}
+
+			SOLAIRE_FORCE_INLINE const T& SOLAIRE_DEFAULT_CALL operator[](const uint32_t aIndex) const throw() {
+				return GetPtr()[aIndex];
+			}
+
+			template<class ...PARAMS>
+			SOLAIRE_FORCE_INLINE void SOLAIRE_DEFAULT_CALL Construct(const uint32_t aIndex, PARAMS&&... aParams) {
+				new(GetPtr() + aIndex) T(std::forward<PARAMS>(aParams)...);
+			}
+
+			SOLAIRE_FORCE_INLINE void SOLAIRE_DEFAULT_CALL Destroy(const uint32_t aIndex) throw() {
+				GetPtr()[aIndex].~T();
+			}
+
+			void SOLAIRE_DEFAULT_CALL Destroy(const uint32_t aIndex, const uint32_t aCount) throw() {
+				if(std::is_trivially_destructible<T>::value) return;
+				for(uint32_t i = 0; i < aCount; ++i) GetPtr()[aIndex + i].~T();
+			}
+
+			/*!
+				\brief Move elements into uninitialised slots, the source slots are left uninitialised.
+				\detail The source and destination may be the same array and may overlap.
+			*/
+			static void SOLAIRE_DEFAULT_CALL Relocate(BPlusTreeArray<T, CAPACITY>& aDst, const uint32_t aDstIndex, BPlusTreeArray<T, CAPACITY>& aSrc, const uint32_t aSrcIndex, const uint32_t aCount) throw() {
+				T* const dst = aDst.GetPtr() + aDstIndex;
+				T* const src = aSrc.GetPtr() + aSrcIndex;
+				if(dst == src || aCount == 0) return;
+				if(std::is_trivially_copyable<T>::value) {
+					std::memmove(static_cast<void*>(dst), src, sizeof(T) * aCount);
+				}else if(dst < src) {
+					for(uint32_t i = 0; i < aCount; ++i) {
+						new(dst + i) T(std::move(src[i]));
+						src[i].~T();
+					}
+				}else {
+					for(uint32_t i = aCount; i > 0; --i) {
+						new(dst + i - 1) T(std::move(src[i - 1]));
+						src[i - 1].~T();
+					}
+				}
+			}
+		};
+
+		template<uint32_t CAPACITY>
+		class BPlusTreeArray<void, CAPACITY> {
+		public:
+			enum : uint32_t {
+				ELEMENT_SIZE = 0
+			};
+		public:
+			SOLAIRE_FORCE_INLINE void SOLAIRE_DEFAULT_CALL Construct(const uint32_t) throw() {
+
+			}
+
+			SOLAIRE_FORCE_INLINE void SOLAIRE_DEFAULT_CALL Destroy(const uint32_t) throw() {
+
+			}
+
+			SOLAIRE_FORCE_INLINE void SOLAIRE_DEFAULT_CALL Destroy(const uint32_t, const uint32_t) throw() {
+
+			}
+
+			static SOLAIRE_FORCE_INLINE void SOLAIRE_DEFAULT_CALL Relocate(BPlusTreeArray<void, CAPACITY>&, const uint32_t, BPlusTreeArray<void, CAPACITY>&, const uint32_t, const uint32_t) throw() {
+
+			}
+		};
+
+		struct BPlusTreeNode {
+			uint16_t Count;
+			bool IsLeaf;
+		};
+
+		template<class K, class V, uint32_t CAPACITY>
+		struct BPlusTreeLeaf : public BPlusTreeNode {
+			typedef K KeyType;
+
+			BPlusTreeLeaf<K, V, CAPACITY>* Prev;
+			BPlusTreeLeaf<K, V, CAPACITY>* Next;
+			BPlusTreeArray<K, CAPACITY> Keys;
+			BPlusTreeArray<V, CAPACITY> Values;
+		};
+
+		template<class K, uint32_t CAPACITY>
+		struct BPlusTreeInner : public BPlusTreeNode {
+			BPlusTreeArray<K, CAPACITY> Keys;
+			BPlusTreeNode* Children[CAPACITY + 1];
+		};
+	}
+
+	/*!
+		\class BPlusTreeIterator
+		\brief Iterates over the elements of a BPlusTree in key order by following the links between leaves.
+		\detail
+		The offset of an iterator is the address of its element, so only == and != are meaningful comparisons.
+		\tparam LEAF The leaf node type.
+		\tparam T The type that the iterator dereferences to.
+		\tparam KEYS True if the iterator dereferences to keys rather than values.
+		\author Adam Smith
+		\date Created : 18th October 2026
+		\date Modified : 18th October 2026
+		\version 1.0
+	*/
+	template<class LEAF, class T, bool KEYS>
+	class BPlusTreeIterator : public Iterator<T> {
+	public:
+		typedef typename Iterator<T>::Type Type;
+		typedef typename Iterator<T>::Offset Offset;
+		typedef typename LEAF::KeyType Key;
+	private:
+		LEAF* mLeaf;
+		LEAF* mLast;
+		uint32_t mIndex;
+	private:
+		SOLAIRE_FORCE_INLINE Type* SOLAIRE_DEFAULT_CALL Address(std::true_type) const throw() {
+			return &mLeaf->Keys[mIndex];
+		}
+
+		SOLAIRE_FORCE_INLINE Type* SOLAIRE_DEFAULT_CALL Address(std::false_type) const throw() {
+			return &mLeaf->Values[mIndex];
+		}
+	protected:
+		//Inherited from Iterator
+		Offset SOLAIRE_EXPORT_CALL GetOffset() const throw() override {
+			return mLeaf ? reinterpret_cast<Offset>(Address(std::integral_constant<bool, KEYS>())) : 0;
+		}
+	public:
+		BPlusTreeIterator(LEAF* const aLeaf, LEAF* const aLast, const uint32_t aIndex) :
+			mLeaf(aLeaf),
+			mLast(aLast),
+			mIndex(aIndex)
+		{
+			if(mLeaf && mIndex == mLeaf->Count) operator++();
+		}
+
+		SOLAIRE_EXPORT_CALL ~BPlusTreeIterator() {
+
+		}
+
+		SOLAIRE_FORCE_INLINE const Key& SOLAIRE_DEFAULT_CALL GetKey() const throw() {
+			return mLeaf->Keys[mIndex];
+		}
+
+		// Inherited from Iterator
+
+		Type* SOLAIRE_EXPORT_CALL operator->() throw() override final {
+			return Address(std::integral_constant<bool, KEYS>());
+		}
+
+		Iterator<Type>& SOLAIRE_EXPORT_CALL operator++() throw() override final {
+			if(++mIndex >= mLeaf->Count) {
+				mLeaf = mLeaf->Next;
+				mIndex = 0;
+			}
+			return *this;
+		}
+
+		Iterator<Type>& SOLAIRE_EXPORT_CALL operator--() throw() override final {
+			if(mLeaf == nullptr) {
+				mLeaf = mLast;
+				mIndex = mLeaf->Count - 1;
+			}else if(mIndex == 0) {
+				mLeaf = mLeaf->Prev;
+				mIndex = mLeaf->Count - 1;
+			}else {
+				--mIndex;
+			}
+			return *this;
+		}
+
+		Iterator<Type>& SOLAIRE_EXPORT_CALL operator+=(Offset aOffset) throw() override final {
+			while(aOffset > 0 && mLeaf) {
+				const uint32_t remaining = mLeaf->Count - mIndex;
+				if(aOffset < remaining) {
+					mIndex += static_cast<uint32_t>(aOffset);
+					break;
+				}
+				aOffset -= remaining;
+				mLeaf = mLeaf->Next;
+				mIndex = 0;
+			}
+			return *this;
+		}
+
+		Iterator<Type>& SOLAIRE_EXPORT_CALL operator-=(const Offset aOffset) throw() override final {
+			for(Offset i = 0; i < aOffset; ++i) operator--();
+			return *this;
+		}
+
+		SOLAIRE_FORCE_INLINE Type& SOLAIRE_DEFAULT_CALL operator*() throw() {
+			return *operator->();
+		}
+	};
+
+	/*!
+		\class BPlusTreeBase
+		\brief The shared implementation of BPlusTree and BPlusTreeSet.
+		\detail
+		Nodes are allocated from a PoolAllocator so that they are aligned to cache lines and allocating one never searches.
+		A node is kept to roughly \a NODE_BYTES, keys are stored separately from values so that searching a node only
+		touches its keys. All elements are stored in the leaves, which are linked to their neighbours for ordered iteration.
+		Inserting or erasing an element may move other elements, invalidating pointers and iterators.
+		\tparam K The key type, must be copyable and comparable with operator<.
+		\tparam V The value type, or void for a set.
+		\tparam NODE_BYTES The approximate size of a node in bytes.
+		\author Adam Smith
+		\date Created : 18th October 2026
+		\date Modified : 18th October 2026
+		\version 1.0
+	*/
+	template<class K, class V, uint32_t NODE_BYTES>
+	class BPlusTreeBase {
+	public:
+		enum : uint32_t {
+			CACHE_LINE = BPLUS_TREE_CACHE_LINE
+		};
+
+		static_assert(NODE_BYTES >= CACHE_LINE, "SolaireCPP : BPlusTree nodes must be at least one cache line");
+
+		enum : uint32_t {
+			LEAF_CAPACITY = Max<uint32_t>(
+				(NODE_BYTES - sizeof(Implementation::BPlusTreeNode) - sizeof(void*) * 2) / (sizeof(K) + Implementation::BPlusTreeArray<V, 1>::ELEMENT_SIZE),
+				4
+			),
+			INNER_CAPACITY = Max<uint32_t>(
+				(NODE_BYTES - sizeof(Implementation::BPlusTreeNode) - sizeof(void*)) / (sizeof(K) + sizeof(void*)),
+				4
+			)
+		};
+	protected:
+		typedef Implementation::BPlusTreeNode Node;
+		typedef Implementation::BPlusTreeLeaf<K, V, LEAF_CAPACITY> Leaf;
+		typedef Implementation::BPlusTreeInner<K, INNER_CAPACITY> Inner;
+		typedef Implementation::BPlusTreeSearch<K> Search;
+		typedef Implementation::BPlusTreeArray<K, LEAF_CAPACITY> LeafKeys;
+		typedef Implementation::BPlusTreeArray<V, LEAF_CAPACITY> LeafValues;
+		typedef Implementation::BPlusTreeArray<K, INNER_CAPACITY> InnerKeys;
+
+		enum : uint32_t {
+			LEAF_MIN = LEAF_CAPACITY / 2,
+			INNER_MIN = (INNER_CAPACITY - 1) / 2,
+			NODE_SIZE = sizeof(Leaf) > sizeof(Inner) ? sizeof(Leaf) : sizeof(Inner)
+		};
+	private:
+		PoolAllocator mPool;
+		Node* mRoot;
+		Leaf* mFirst;
+		Leaf* mLast;
+		uint32_t mSize;
+	private:
+		BPlusTreeBase(const BPlusTreeBase<K, V, NODE_BYTES>&) = delete;
+		BPlusTreeBase(BPlusTreeBase<K, V, NODE_BYTES>&&) = delete;
+		BPlusTreeBase<K, V, NODE_BYTES>& operator=(const BPlusTreeBase<K, V, NODE_BYTES>&) = delete;
+		BPlusTreeBase<K, V, NODE_BYTES>& operator=(BPlusTreeBase<K, V, NODE_BYTES>&&) = delete;
+
+		Leaf* SOLAIRE_DEFAULT_CALL CreateLeaf() {
+			void* const memory = mPool.Allocate(sizeof(Leaf));
+			SolaireRuntimeAssert(memory != nullptr, "SolaireCPP : BPlusTree failed to allocate memory");
+			Leaf* const leaf = new(memory) Leaf;
+			leaf->Count = 0;
+			leaf->IsLeaf = true;
+			leaf->Prev = nullptr;
+			leaf->Next = nullptr;
+			return leaf;
+		}
+
+		Inner* SOLAIRE_DEFAULT_CALL CreateInner() {
+			void* const memory = mPool.Allocate(sizeof(Inner));
+			SolaireRuntimeAssert(memory != nullptr, "SolaireCPP : BPlusTree failed to allocate memory");
+			Inner* const inner = new(memory) Inner;
+			inner->Count = 0;
+			inner->IsLeaf = false;
+			return inner;
+		}
+
+		SOLAIRE_FORCE_INLINE bool SOLAIRE_DEFAULT_CALL IsFull(const Node* const aNode) const throw() {
+			return aNode->Count == (aNode->IsLeaf ? LEAF_CAPACITY : INNER_CAPACITY);
+		}
+
+		SOLAIRE_FORCE_INLINE uint32_t SOLAIRE_DEFAULT_CALL MinCount(const Node* const aNode) const throw() {
+			return aNode->IsLeaf ? LEAF_MIN : INNER_MIN;
+		}
+
+		void SOLAIRE_DEFAULT_CALL DestroyNode(Node* const aNode) throw() {
+			if(aNode->IsLeaf) {
+				Leaf& leaf = *static_cast<Leaf*>(aNode);
+				leaf.Keys.Destroy(0, leaf.Count);
+				leaf.Values.Destroy(0, leaf.Count);
+			}else {
+				Inner& inner = *static_cast<Inner*>(aNode);
+				for(uint32_t i = 0; i <= inner.Count; ++i) DestroyNode(inner.Children[i]);
+				inner.Keys.Destroy(0, inner.Count);
+			}
+		}
+
+		/*!
+			\brief Split the full child \a aIndex of \a aParent in half, \a aParent must not be full.
+		*/
+		void SOLAIRE_DEFAULT_CALL SplitChild(Inner& aParent, const uint32_t aIndex) {
+			Node* const child = aParent.Children[aIndex];
+			Node* right;
+			uint32_t moved;
+
+			if(child->IsLeaf) {
+				Leaf& left = *static_cast<Leaf*>(child);
+				Leaf* const leaf = CreateLeaf();
+				const uint32_t mid = LEAF_CAPACITY / 2;
+				moved = LEAF_CAPACITY - mid;
+				LeafKeys::Relocate(leaf->Keys, 0, left.Keys, mid, moved);
+				LeafValues::Relocate(leaf->Values, 0, left.Values, mid, moved);
+				leaf->Count = static_cast<uint16_t>(moved);
+				left.Count = static_cast<uint16_t>(mid);
+
+				leaf->Prev = &left;
+				leaf->Next = left.Next;
+				if(left.Next) left.Next->Prev = leaf;
+				else mLast = leaf;
+				left.Next = leaf;
+
+				InnerKeys::Relocate(aParent.Keys, aIndex + 1, aParent.Keys, aIndex, aParent.Count - aIndex);
+				aParent.Keys.Construct(aIndex, leaf->Keys[0]);
+				right = leaf;
+			}else {
+				Inner& left = *static_cast<Inner*>(child);
+				Inner* const inner = CreateInner();
+				const uint32_t mid = INNER_CAPACITY / 2;
+				moved = INNER_CAPACITY - mid - 1;
+				InnerKeys::Relocate(inner->Keys, 0, left.Keys, mid + 1, moved);
+				std::memcpy(inner->Children, left.Children + mid + 1, sizeof(Node*) * (moved + 1));
+				inner->Count = static_cast<uint16_t>(moved);
+
+				// The middle key moves up into the parent
+				InnerKeys::Relocate(aParent.Keys, aIndex + 1, aParent.Keys, aIndex, aParent.Count - aIndex);
+				InnerKeys::Relocate(aParent.Keys, aIndex, left.Keys, mid, 1);
+				left.Count = static_cast<uint16_t>(mid);
+				right = inner;
+			}
+
+			std::memmove(aParent.Children + aIndex + 2, aParent.Children + aIndex + 1, sizeof(Node*) * (aParent.Count - aIndex));
+			aParent.Children[aIndex + 1] = right;
+			++aParent.Count;
+		}
+
+		/*!
+			\brief Move the first element of child \a aIndex + 1 to the end of child \a aIndex.
+		*/
+		void SOLAIRE_DEFAULT_CALL BorrowFromRight(Inner& aParent, const uint32_t aIndex) throw() {
+			Node* const child = aParent.Children[aIndex];
+			Node* const sibling = aParent.Children[aIndex + 1];
+
+			if(child->IsLeaf) {
+				Leaf& left = *static_cast<Leaf*>(child);
+				Leaf& right = *static_cast<Leaf*>(sibling);
+				LeafKeys::Relocate(left.Keys, left.Count, right.Keys, 0, 1);
+				LeafValues::Relocate(left.Values, left.Count, right.Values, 0, 1);
+				LeafKeys::Relocate(right.Keys, 0, right.Keys, 1, right.Count - 1);
+				LeafValues::Relocate(right.Values, 0, right.Values, 1, right.Count - 1);
+				aParent.Keys[aIndex] = right.Keys[0];
+			}else {
+				Inner& left = *static_cast<Inner*>(child);
+				Inner& right = *static_cast<Inner*>(sibling);
+				InnerKeys::Relocate(left.Keys, left.Count, aParent.Keys, aIndex, 1);
+				left.Children[left.Count + 1] = right.Children[0];
+				InnerKeys::Relocate(aParent.Keys, aIndex, right.Keys, 0, 1);
+				InnerKeys::Relocate(right.Keys, 0, right.Keys, 1, right.Count - 1);
+				std::memmove(right.Children, right.Children + 1, sizeof(Node*) * right.Count);
+			}
+
+			++child->Count;
+			--sibling->Count;
+		}
+
+		/*!
+			\brief Move the last element of child \a aIndex - 1 to the start of child \a aIndex.
+		*/
+		void SOLAIRE_DEFAULT_CALL BorrowFromLeft(Inner& aParent, const uint32_t aIndex) throw() {
+			Node* const child = aParent.Children[aIndex];
+			Node* const sibling = aParent.Children[aIndex - 1];
+
+			if(child->IsLeaf) {
+				Leaf& right = *static_cast<Leaf*>(child);
+				Leaf& left = *static_cast<Leaf*>(sibling);
+				LeafKeys::Relocate(right.Keys, 1, right.Keys, 0, right.Count);
+				LeafValues::Relocate(right.Values, 1, right.Values, 0, right.Count);
+				LeafKeys::Relocate(right.Keys, 0, left.Keys, left.Count - 1, 1);
+				LeafValues::Relocate(right.Values, 0, left.Values, left.Count - 1, 1);
+				aParent.Keys[aIndex - 1] = right.Keys[0];
+			}else {
+				Inner& right = *static_cast<Inner*>(child);
+				Inner& left = *static_cast<Inner*>(sibling);
+				InnerKeys::Relocate(right.Keys, 1, right.Keys, 0, right.Count);
+				std::memmove(right.Children + 1, right.Children, sizeof(Node*) * (right.Count + 1));
+				InnerKeys::Relocate(right.Keys, 0, aParent.Keys, aIndex - 1, 1);
+				right.Children[0] = left.Children[left.Count];
+				InnerKeys::Relocate(aParent.Keys, aIndex - 1, left.Keys, left.Count - 1, 1);
+			}
+
+			++child->Count;
+			--sibling->Count;
+		}
+
+		/*!
+			\brief Merge child \a aIndex + 1 into child \a aIndex and remove it from \a aParent.
+		*/
+		void SOLAIRE_DEFAULT_CALL Merge(Inner& aParent, const uint32_t aIndex) throw() {
+			Node* const child = aParent.Children[aIndex];
+			Node* const sibling = aParent.Children[aIndex + 1];
+
+			if(child->IsLeaf) {
+				Leaf& left = *static_cast<Leaf*>(child);
+				Leaf& right = *static_cast<Leaf*>(sibling);
+				LeafKeys::Relocate(left.Keys, left.Count, right.Keys, 0, right.Count);
+				LeafValues::Relocate(left.Values, left.Count, right.Values, 0, right.Count);
+				left.Count += right.Count;
+
+				left.Next = right.Next;
+				if(right.Next) right.Next->Prev = &left;
+				else mLast = &left;
+
+				aParent.Keys.Destroy(aIndex);
+			}else {
+				Inner& left = *static_cast<Inner*>(child);
+				Inner& right = *static_cast<Inner*>(sibling);
+				InnerKeys::Relocate(left.Keys, left.Count, aParent.Keys, aIndex, 1);
+				InnerKeys::Relocate(left.Keys, left.Count + 1, right.Keys, 0, right.Count);
+				std::memcpy(left.Children + left.Count + 1, right.Children, sizeof(Node*) * (right.Count + 1));
+				left.Count += right.Count + 1;
+			}
+
+			InnerKeys::Relocate(aParent.Keys, aIndex, aParent.Keys, aIndex + 1, aParent.Count - aIndex - 1);
+			std::memmove(aParent.Children + aIndex + 1, aParent.Children + aIndex + 2, sizeof(Node*) * (aParent.Count - aIndex - 1));
+			--aParent.Count;
+			mPool.Deallocate(sibling);
+		}
+
+		void SOLAIRE_DEFAULT_CALL Rebalance(Inner& aParent, const uint32_t aIndex) throw() {
+			if(aIndex > 0 && aParent.Children[aIndex - 1]->Count > MinCount(aParent.Children[aIndex - 1])) {
+				BorrowFromLeft(aParent, aIndex);
+			}else if(aIndex < aParent.Count && aParent.Children[aIndex + 1]->Count > MinCount(aParent.Children[aIndex + 1])) {
+				BorrowFromRight(aParent, aIndex);
+			}else if(aIndex > 0) {
+				Merge(aParent, aIndex - 1);
+			}else {
+				Merge(aParent, aIndex);
+			}
+		}
+
+		bool SOLAIRE_DEFAULT_CALL EraseFrom(Node* const aNode, const K& aKey) throw() {
+			if(aNode->IsLeaf) {
+				Leaf& leaf = *static_cast<Leaf*>(aNode);
+				const uint32_t index = Search::LowerBound(leaf.Keys.GetPtr(), leaf.Count, aKey);
+				if(index == leaf.Count || aKey < leaf.Keys[index]) return false;
+				leaf.Keys.Destroy(index);
+				leaf.Values.Destroy(index);
+				LeafKeys::Relocate(leaf.Keys, index, leaf.Keys, index + 1, leaf.Count - index - 1);
+				LeafValues::Relocate(leaf.Values, index, leaf.Values, index + 1, leaf.Count - index - 1);
+				--leaf.Count;
+				return true;
+			}else {
+				Inner& inner = *static_cast<Inner*>(aNode);
+				const uint32_t index = Search::UpperBound(inner.Keys.GetPtr(), inner.Count, aKey);
+				Node* const child = inner.Children[index];
+				if(! EraseFrom(child, aKey)) return false;
+				if(child->Count < MinCount(child)) Rebalance(inner, index);
+				return true;
+			}
+		}
+	protected:
+		/*!
+			\brief Find the position that a key is or would be stored at.
+			\param aKey The key to search for.
+			\param aLeaf Set to the leaf that contains the position, or nullptr if the tree is empty.
+			\return The index of the first key in \a aLeaf that is not less than \a aKey, this may be the leaf's count.
+		*/
+		uint32_t SOLAIRE_DEFAULT_CALL FindPosition(const K& aKey, Leaf*& aLeaf) const throw() {
+			Node* node = mRoot;
+			if(node == nullptr) {
+				aLeaf = nullptr;
+				return 0;
+			}
+			while(! node->IsLeaf) {
+				const Inner& inner = *static_cast<const Inner*>(node);
+				node = inner.Children[Search::UpperBound(inner.Keys.GetPtr(), inner.Count, aKey)];
+			}
+			aLeaf = static_cast<Leaf*>(node);
+			return Search::LowerBound(aLeaf->Keys.GetPtr(), aLeaf->Count, aKey);
+		}
+
+		SOLAIRE_FORCE_INLINE uint32_t SOLAIRE_DEFAULT_CALL FindUpperPosition(const K& aKey, Leaf*& aLeaf) const throw() {
+			Node* node = mRoot;
+			if(node == nullptr) {
+				aLeaf = nullptr;
+				return 0;
+			}
+			while(! node->IsLeaf) {
+				const Inner& inner = *static_cast<const Inner*>(node);
+				node = inner.Children[Search::UpperBound(inner.Keys.GetPtr(), inner.Count, aKey)];
+			}
+			aLeaf = static_cast<Leaf*>(node);
+			return Search::UpperBound(aLeaf->Keys.GetPtr(), aLeaf->Count, aKey);
+		}
+
+		SOLAIRE_FORCE_INLINE bool SOLAIRE_DEFAULT_CALL FindExact(const K& aKey, Leaf*& aLeaf, uint32_t& aIndex) const throw() {
+			aIndex = FindPosition(aKey, aLeaf);
+			return aLeaf && aIndex < aLeaf->Count && ! (aKey < aLeaf->Keys[aIndex]);
+		}
+
+		/*!
+			\brief Insert a key that is not already in the tree.
+			\detail
+			Full nodes are split on the way down, so the insertion never has to travel back up the tree.
+			Splitting moves elements, so \a aParams must not reference an element of the tree.
+			\param aKey The key to insert.
+			\param aLeaf Set to the leaf that contains the key.
+			\param aIndex Set to the index of the key in \a aLeaf.
+			\param aParams The parameters to pass to the value's constructor.
+		*/
+		template<class ...PARAMS>
+		void SOLAIRE_DEFAULT_CALL InsertKey(const K& aKey, Leaf*& aLeaf, uint32_t& aIndex, PARAMS&&... aParams) {
+			// aKey may reference a key in the tree
+			const K key(aKey);
+
+			if(mRoot == nullptr) {
+				mRoot = mFirst = mLast = CreateLeaf();
+			}else if(IsFull(mRoot)) {
+				Inner* const root = CreateInner();
+				root->Children[0] = mRoot;
+				mRoot = root;
+				SplitChild(*root, 0);
+			}
+
+			Node* node = mRoot;
+			while(! node->IsLeaf) {
+				Inner& inner = *static_cast<Inner*>(node);
+				uint32_t index = Search::UpperBound(inner.Keys.GetPtr(), inner.Count, key);
+				if(IsFull(inner.Children[index])) {
+					SplitChild(inner, index);
+					if(! (key < inner.Keys[index])) ++index;
+				}
+				node = inner.Children[index];
+			}
+
+			Leaf& leaf = *static_cast<Leaf*>(node);
+			const uint32_t index = Search::LowerBound(leaf.Keys.GetPtr(), leaf.Count, key);
+			LeafKeys::Relocate(leaf.Keys, index + 1, leaf.Keys, index, leaf.Count - index);
+			LeafValues::Relocate(leaf.Values, index + 1, leaf.Values, index, leaf.Count - index);
+			leaf.Keys.Construct(index, key);
+			leaf.Values.Construct(index, std::forward<PARAMS>(aParams)...);
+			++leaf.Count;
+			++mSize;
+
+			aLeaf = &leaf;
+			aIndex = index;
+		}
+
+		SOLAIRE_FORCE_INLINE Leaf* SOLAIRE_DEFAULT_CALL GetFirstLeaf() const throw() {
+			return mFirst;
+		}
+
+		SOLAIRE_FORCE_INLINE Leaf* SOLAIRE_DEFAULT_CALL GetLastLeaf() const throw() {
+			return mLast;
+		}
+	public:
+		/*!
+			\brief Create an empty tree, no memory is allocated until the first element is inserted.
+			\param aAllocator The allocator that nodes will be allocated from.
+		*/
+		BPlusTreeBase(AllocatorI& aAllocator) throw() :
+			mPool(aAllocator, NODE_SIZE, CACHE_LINE),
+			mRoot(nullptr),
+			mFirst(nullptr),
+			mLast(nullptr),
+			mSize(0)
+		{}
+
+		~BPlusTreeBase() throw() {
+			Clear();
+		}
+
+		/*!
+			\brief Remove a key from the tree.
+			\param aKey The key to remove.
+			\return True if the key was in the tree.
+		*/
+		bool SOLAIRE_DEFAULT_CALL Erase(const K& aKey) throw() {
+			if(mRoot == nullptr || ! EraseFrom(mRoot, aKey)) return false;
+			--mSize;
+
+			if(mRoot->Count == 0) {
+				Node* const root = mRoot;
+				if(root->IsLeaf) {
+					mRoot = nullptr;
+					mFirst = nullptr;
+					mLast = nullptr;
+				}else {
+					mRoot = static_cast<Inner*>(root)->Children[0];
+				}
+				mPool.Deallocate(root);
+			}
+			return true;
+		}
+
+		/*!
+			\brief Remove every element and return all nodes to the allocator.
+		*/
+		void SOLAIRE_DEFAULT_CALL Clear() throw() {
+			if(mRoot == nullptr) return;
+			if(! (std::is_trivially_destructible<K>::value && std::is_trivially_destructible<typename std::conditional<std::is_void<V>::value, K, V>::type>::value)) {
+				DestroyNode(mRoot);
+			}
+			mPool.DeallocateAll();
+			mRoot = nullptr;
+			mFirst = nullptr;
+			mLast = nullptr;
+			mSize = 0;
+		}
+
+		SOLAIRE_FORCE_INLINE bool SOLAIRE_DEFAULT_CALL Contains(const K& aKey) const throw() {
+			Leaf* leaf;
+			uint32_t index;
+			return FindExact(aKey, leaf, index);
+		}
+
+		SOLAIRE_FORCE_INLINE uint32_t SOLAIRE_DEFAULT_CALL Size() const throw() {
+			return mSize;
+		}
+
+		SOLAIRE_FORCE_INLINE bool SOLAIRE_DEFAULT_CALL IsEmpty() const throw() {
+			return mSize == 0;
+		}
+
+		SOLAIRE_FORCE_INLINE AllocatorI& SOLAIRE_DEFAULT_CALL GetAllocator() const throw() {
+			return mPool.GetParent();
+		}
+	};
+
+	/*!
+		\class BPlusTree
+		\brief An ordered map from keys of type \a K to values of type \a V.
+		\detail
+		Integer keys of 32 bits are searched 4 at a time when SSE2 is available.
+		\tparam K The key type, must be copyable and comparable with operator<.
+		\tparam V The value type.
+		\tparam NODE_BYTES The approximate size of a node in bytes.
+		\author Adam Smith
+		\date Created : 18th October 2026
+		\date Modified : 18th October 2026
+		\version 1.0
+		\see BPlusTreeBase
+	*/
+	template<class K, class V, uint32_t NODE_BYTES = BPLUS_TREE_CACHE_LINE * BPLUS_TREE_NODE_LINES>
+	class BPlusTree : public BPlusTreeBase<K, V, NODE_BYTES> {
+	private:
+		typedef BPlusTreeBase<K, V, NODE_BYTES> Base;
+		typedef typename Base::Leaf Leaf;
+	public:
+		typedef BPlusTreeIterator<Leaf, V, false> Iterator;
+		typedef BPlusTreeIterator<Leaf, const V, false> ConstIterator;
+	public:
+		BPlusTree(AllocatorI& aAllocator) throw() :
+			Base(aAllocator)
+		{}
+
+		/*!
+			\brief Find the value mapped to a key.
+			\param aKey The key to search for.
+			\return The address of the value, or nullptr if the key is not in the tree.
+		*/
+		V* SOLAIRE_DEFAULT_CALL Find(const K& aKey) throw() {
+			Leaf* leaf;
+			uint32_t index;
+			return Base::FindExact(aKey, leaf, index) ? &leaf->Values[index] : nullptr;
+		}
+
+		const V* SOLAIRE_DEFAULT_CALL Find(const K& aKey) const throw() {
+			Leaf* leaf;
+			uint32_t index;
+			return Base::FindExact(aKey, leaf, index) ? &leaf->Values[index] : nullptr;
+		}
+
+		/*!
+			\brief Map a key to a value constructed in place.
+			\detail If the key is already in the tree the existing value is returned and \a aParams are not used.
+			\tparam PARAMS The parameter types to pass to the value's constructor.
+			\param aKey The key to insert.
+			\param aParams The parameters to pass to the value's constructor.
+			\return The value mapped to \a aKey.
+		*/
+		template<class ...PARAMS>
+		V& SOLAIRE_DEFAULT_CALL Emplace(const K& aKey, PARAMS&&... aParams) {
+			Leaf* leaf;
+			uint32_t index;
+			if(Base::FindExact(aKey, leaf, index)) return leaf->Values[index];
+			// Construct the new value first in case a parameter references an existing element
+			V tmp(std::forward<PARAMS>(aParams)...);
+			Base::InsertKey(aKey, leaf, index, std::move(tmp));
+			return leaf->Values[index];
+		}
+
+		/*!
+			\brief Map a key to a value, replacing the existing value if there is one.
+			\param aKey The key to insert.
+			\param aValue The value to map to \a aKey.
+			\return The value mapped to \a aKey.
+		*/
+		V& SOLAIRE_DEFAULT_CALL Insert(const K& aKey, const V& aValue) {
+			Leaf* leaf;
+			uint32_t index;
+			if(Base::FindExact(aKey, leaf, index)) return leaf->Values[index] = aValue;
+			V tmp(aValue);
+			Base::InsertKey(aKey, leaf, index, std::move(tmp));
+			return leaf->Values[index];
+		}
+
+		V& SOLAIRE_DEFAULT_CALL Insert(const K& aKey, V&& aValue) {
+			Leaf* leaf;
+			uint32_t index;
+			if(Base::FindExact(aKey, leaf, index)) return leaf->Values[index] = std::move(aValue);
+			V tmp(std::move(aValue));
+			Base::InsertKey(aKey, leaf, index, std::move(tmp));
+			return leaf->Values[index];
+		}
+
+		SOLAIRE_FORCE_INLINE V& SOLAIRE_DEFAULT_CALL operator[](const K& aKey) {
+			return Emplace(aKey);
+		}
+
+		/*!
+			\brief Call a function on each element with a key in the range [\a aBegin, \a aEnd), in key order.
+			\param aBegin The first key in the range.
+			\param aEnd The key after the range.
+			\param aFunction A function with the signature void(const K& aKey, V& aValue).
+		*/
+		template<class F>
+		void SOLAIRE_DEFAULT_CALL ForEachInRange(const K& aBegin, const K& aEnd, F aFunction) {
+			Leaf* leaf;
+			uint32_t index = Base::FindPosition(aBegin, leaf);
+			while(leaf) {
+				for(; index < leaf->Count; ++index) {
+					if(! (leaf->Keys[index] < aEnd)) return;
+					aFunction(static_cast<const K&>(leaf->Keys[index]), leaf->Values[index]);
+				}
+				leaf = leaf->Next;
+				index = 0;
+			}
+		}
+
+		template<class F>
+		void SOLAIRE_DEFAULT_CALL ForEachInRange(const K& aBegin, const K& aEnd, F aFunction) const {
+			Leaf* leaf;
+			uint32_t index = Base::FindPosition(aBegin, leaf);
+			while(leaf) {
+				for(; index < leaf->Count; ++index) {
+					if(! (leaf->Keys[index] < aEnd)) return;
+					aFunction(static_cast<const K&>(leaf->Keys[index]), static_cast<const V&>(leaf->Values[index]));
+				}
+				leaf = leaf->Next;
+				index = 0;
+			}
+		}
+
+		/*!
+			\brief Call a function on each element, in key order.
+			\param aFunction A function with the signature void(const K& aKey, V& aValue).
+		*/
+		template<class F>
+		void SOLAIRE_DEFAULT_CALL ForEach(F aFunction) {
+			for(Leaf* leaf = Base::GetFirstLeaf(); leaf; leaf = leaf->Next) {
+				for(uint32_t i = 0; i < leaf->Count; ++i) aFunction(static_cast<const K&>(leaf->Keys[i]), leaf->Values[i]);
+			}
+		}
+
+		template<class F>
+		void SOLAIRE_DEFAULT_CALL ForEach(F aFunction) const {
+			for(const Leaf* leaf = Base::GetFirstLeaf(); leaf; leaf = leaf->Next) {
+				for(uint32_t i = 0; i < leaf->Count; ++i) aFunction(leaf->Keys[i], leaf->Values[i]);
+			}
+		}
+
+		// The iterator of the first element with a key that is not less than aKey
+		Iterator SOLAIRE_DEFAULT_CALL LowerBound(const K& aKey) throw() {
+			Leaf* leaf;
+			const uint32_t index = Base::FindPosition(aKey, leaf);
+			return Iterator(leaf, Base::GetLastLeaf(), index);
+		}
+
+		ConstIterator SOLAIRE_DEFAULT_CALL LowerBound(const K& aKey) const throw() {
+			Leaf* leaf;
+			const uint32_t index = Base::FindPosition(aKey, leaf);
+			return ConstIterator(leaf, Base::GetLastLeaf(), index);
+		}
+
+		// The iterator of the first element with a key that is greater than aKey
+		Iterator SOLAIRE_DEFAULT_CALL UpperBound(const K& aKey) throw() {
+			Leaf* leaf;
+			const uint32_t index = Base::FindUpperPosition(aKey, leaf);
+			return Iterator(leaf, Base::GetLastLeaf(), index);
+		}
+
+		ConstIterator SOLAIRE_DEFAULT_CALL UpperBound(const K& aKey) const throw() {
+			Leaf* leaf;
+			const uint32_t index = Base::FindUpperPosition(aKey, leaf);
+			return ConstIterator(leaf, Base::GetLastLeaf(), index);
+		}
+
+		SOLAIRE_FORCE_INLINE Iterator SOLAIRE_DEFAULT_CALL begin() throw() {
+			return Iterator(Base::GetFirstLeaf(), Base::GetLastLeaf(), 0);
+		}
+
+		SOLAIRE_FORCE_INLINE Iterator SOLAIRE_DEFAULT_CALL end() throw() {
+			return Iterator(nullptr, Base::GetLastLeaf(), 0);
+		}
+
+		SOLAIRE_FORCE_INLINE ConstIterator SOLAIRE_DEFAULT_CALL begin() const throw() {
+			return ConstIterator(Base::GetFirstLeaf(), Base::GetLastLeaf(), 0);
+		}
+
+		SOLAIRE_FORCE_INLINE ConstIterator SOLAIRE_DEFAULT_CALL end() const throw() {
+			return ConstIterator(nullptr, Base::GetLastLeaf(), 0);
+		}
+	};
+
+	/*!
+		\class BPlusTreeSet
+		\brief An ordered set of keys of type \a K.
+		\tparam K The key type, must be copyable and comparable with operator<.
+		\tparam NODE_BYTES The approximate size of a node in bytes.
+		\author Adam Smith
+		\date Created : 18th October 2026
+		\date Modified : 18th October 2026
+		\version 1.0
+		\see BPlusTreeBase
+	*/
+	template<class K, uint32_t NODE_BYTES = BPLUS_TREE_CACHE_LINE * BPLUS_TREE_NODE_LINES>
+	class BPlusTreeSet : public BPlusTreeBase<K, void, NODE_BYTES> {
+	private:
+		typedef BPlusTreeBase<K, void, NODE_BYTES> Base;
+		typedef typename Base::Leaf Leaf;
+	public:
+		typedef BPlusTreeIterator<Leaf, const K, true> ConstIterator;
+		typedef ConstIterator Iterator;
+	public:
+		BPlusTreeSet(AllocatorI& aAllocator) throw() :
+			Base(aAllocator)
+		{}
+
+		/*!
+			\brief Insert a key into the set.
+			\param aKey The key to insert.
+			\return True if the key was inserted, false if it was already in the set.
+		*/
+		bool SOLAIRE_DEFAULT_CALL Insert(const K& aKey) {
+			Leaf* leaf;
+			uint32_t index;
+			if(Base::FindExact(aKey, leaf, index)) return false;
+			Base::InsertKey(aKey, leaf, index);
+			return true;
+		}
+
+		/*!
+			\brief Call a function on each key in the range [\a aBegin, \a aEnd), in order.
+			\param aBegin The first key in the range.
+			\param aEnd The key after the range.
+			\param aFunction A function with the signature void(const K& aKey).
+		*/
+		template<class F>
+		void SOLAIRE_DEFAULT_CALL ForEachInRange(const K& aBegin, const K& aEnd, F aFunction) const {
+			Leaf* leaf;
+			uint32_t index = Base::FindPosition(aBegin, leaf);
+			while(leaf) {
+				for(; index < leaf->Count; ++index) {
+					if(! (leaf->Keys[index] < aEnd)) return;
+					aFunction(static_cast<const K&>(leaf->Keys[index]));
+				}
+				leaf = leaf->Next;
+				index = 0;
+			}
+		}
+
+		/*!
+			\brief Call a function on each key, in order.
+			\param aFunction A function with the signature void(const K& aKey).
+		*/
+		template<class F>
+		void SOLAIRE_DEFAULT_CALL ForEach(F aFunction) const {
+			for(const Leaf* leaf = Base::GetFirstLeaf(); leaf; leaf = leaf->Next) {
+				for(uint32_t i = 0; i < leaf->Count; ++i) aFunction(static_cast<const K&>(leaf->Keys[i]));
+			}
+		}
+
+		// The iterator of the first key that is not less than aKey
+		ConstIterator SOLAIRE_DEFAULT_CALL LowerBound(const K& aKey) const throw() {
+			Leaf* leaf;
+			const uint32_t index = Base::FindPosition(aKey, leaf);
+			return ConstIterator(leaf, Base::GetLastLeaf(), index);
+		}
+
+		// The iterator of the first key that is greater than aKey
+		ConstIterator SOLAIRE_DEFAULT_CALL UpperBound(const K& aKey) const throw() {
+			Leaf* leaf;
+			const uint32_t index = Base::FindUpperPosition(aKey, leaf);
+			return ConstIterator(leaf, Base::GetLastLeaf(), index);
+		}
+
+		SOLAIRE_FORCE_INLINE ConstIterator SOLAIRE_DEFAULT_CALL begin() const throw() {
+			return ConstIterator(Base::GetFirstLeaf(), Base::GetLastLeaf(), 0);
+		}
+
+		SOLAIRE_FORCE_INLINE ConstIterator SOLAIRE_DEFAULT_CALL end() const throw() {
+			return ConstIterator(nullptr, Base::GetLastLeaf(), 0);
+		}
+	};
+}
+
+#endif
@@ -0,0 +1,556 @@
+#ifndef SOLAIRE_CHUNKED_DEQUE_HPP
+#define SOLAIRE_CHUNKED_DEQUE_HPP
+
+//Copyright 2015 Adam Smith
+//
+//Licensed under the Apache License, Version 2.0 (the "License");
+//you may not use this file except in compliance with the License.
+//You may obtain a copy of the License at
+//
+//    http://www.apache.org/licenses/LICENSE-2.0
+//
+//Unless required by applicable law or agreed to in writing, software
+//distributed under the License is distributed on an "AS IS" BASIS,
+//WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//See the License for the specific language governing permissions and
+//limitations under the License.
+
+// Contact :
+// Email             : solairelibrary@mail.com
+// GitHub repository : https://github.com/SolaireLibrary/SolaireCPP
+
+/*!
+	\file ChunkedDeque.hpp
+	\brief
+	\author
+	Created			: Adam Smith
+	Last modified	: Adam Smith
+	\version 1.0
+	\date
+	Created			: 18th October 2026
+	Last Modified	: 18th October 2026
+*/
+
+#include <new>
+#include <cstring>
+#include <utility>
+#include <stdexcept>
+#include <type_traits>
+#include "Allocator.hpp"
+#include "Container.hpp"
+#include "Maths.hpp"
+
+namespace Solaire {
+
+	namespace Implementation {
+		template<class T>
+		static constexpr uint32_t DefaultDequeChunkElements() throw() {
+			return NextPowerOfTwo(Max<uint32_t>(4096 / sizeof(T), 16));
+		}
+	}
+
+	template<class T, const uint32_t CHUNK_ELEMENTS>
+	class ChunkedDequeIterator : public Iterator<T>{
+	public:
+		typedef typename Iterator<T>::Type Type;
+		typedef typename Iterator<T>::Offset Offset;
+	private:
+		T* const* mChunks;
+		uint32_t mFront;
+		Offset mOffset;
+	protected:
+		//Inherited from Iterator
+		Offset SOLAIRE_EXPORT_CALL GetOffset() const throw() override {
+			return mOffset;
+		}
+	public:
+		ChunkedDequeIterator() :
+			mChunks(nullptr),
+			mFront(0),
+			mOffset(0)
+		{}
+
+		ChunkedDequeIterator(T* const* const aChunks, const uint32_t aFront) :
+			mChunks(aChunks),
+			mFront(aFront),
+			mOffset(0)
+		{}
+
+		SOLAIRE_EXPORT_CALL ~ChunkedDequeIterator() {
+
+		}
+
+		// Inherited from Iterator
+
+		Type* SOLAIRE_EXPORT_CALL operator->() throw() override {
+			const Offset index = mFront + mOffset;
+			return mChunks[index / CHUNK_ELEMENTS] + (index & (CHUNK_ELEMENTS - 1));
+		}
+
+		Iterator<Type>& SOLAIRE_EXPORT_CALL operator++() throw() override {
+			++mOffset;
+			return *this;
+		}
+
+		Iterator<Type>& SOLAIRE_EXPORT_CALL operator--() throw() override {
+			--mOffset;
+			return *this;
+		}
+
+		Iterator<Type>& SOLAIRE_EXPORT_CALL operator+=(const Offset aOffset) throw() override {
+			mOffset += aOffset;
+			return *this;
+		}
+
+		Iterator<Type>& SOLAIRE_EXPORT_CALL operator-=(const Offset aOffset) throw() override {
+			mOffset -= aOffset;
+			return *this;
+		}
+	};
+
+	/*!
+		\class ChunkedDeque
+		\brief A List that stores its elements in fixed size chunks.
+		\detail
+		Chunks of \a CHUNK_ELEMENTS elements are allocated from an Allocator and tracked by a map of chunk pointers, which
+		makes operator[] O(1). Pushing or popping at either end never moves an existing element, so pointers to elements
+		stay valid until the element is removed. Inserting or erasing in the middle shifts the elements between the
+		position and the nearest end.
+		\tparam T The type of element stored in the deque.
+		\tparam CHUNK_ELEMENTS The number of elements in each chunk, must be a power of two.
+		\author Adam Smith
+		\date Created : 18th October 2026
+		\date Modified : 18th October 2026
+		\version 1.0
+	*/
+	template<class T, const uint32_t CHUNK_ELEMENTS = Implementation::DefaultDequeChunkElements<T>()>
+	class ChunkedDeque : public List<T> {
+	public:
+		typedef typename List<T>::Type Type;
+		typedef typename List<T>::ConstIterator ConstIterator;
+
+		static_assert(IsPowerOfTwo(CHUNK_ELEMENTS), "SolaireCPP : ChunkedDeque chunk size must be a power of two");
+
+		enum : uint32_t {
+			CHUNK_MASK = CHUNK_ELEMENTS - 1,
+			MIN_MAP_CAPACITY = 8
+		};
+	private:
+		Allocator* mAllocator;
+		T** mMap;
+		T* mSpareChunk;
+		uint32_t mMapCapacity;
+		uint32_t mMapBegin;
+		uint32_t mChunkCount;
+		uint32_t mFront;
+		uint32_t mSize;
+		ChunkedDequeIterator<T, CHUNK_ELEMENTS> mBeginIterator;
+	private:
+		SOLAIRE_FORCE_INLINE T* SOLAIRE_DEFAULT_CALL GetElement(const uint32_t aIndex) const throw() {
+			const uint32_t index = mFront + aIndex;
+			return mMap[mMapBegin + index / CHUNK_ELEMENTS] + (index & CHUNK_MASK);
+		}
+
+		static void SOLAIRE_DEFAULT_CALL CopyElements(const T* const aSrc, T* const aDst, const uint32_t aCount) {
+			if(std::is_trivially_copyable<T>::value) {
+				if(aCount > 0) std::memcpy(static_cast<void*>(aDst), aSrc, sizeof(T) * aCount);
+			}else {
+				for(uint32_t i = 0; i < aCount; ++i) {
+					new(aDst + i) T(aSrc[i]);
+				}
+			}
+		}
+
+		T* SOLAIRE_DEFAULT_CALL AllocateChunk() throw() {
+			if(mSpareChunk) {
+				T* const chunk = mSpareChunk;
+				mSpareChunk = nullptr;
+				return chunk;
+			}
+			return static_cast<T*>(mAllocator->Allocate(sizeof(T) * CHUNK_ELEMENTS));
+		}
+
+		void SOLAIRE_DEFAULT_CALL DeallocateChunk(T* const aChunk) throw() {
+			if(mSpareChunk) mAllocator->Deallocate(mSpareChunk);
+			mSpareChunk = aChunk;
+		}
+
+		bool SOLAIRE_DEFAULT_CALL MakeMapRoom(const bool aAtFront) throw() {
+			if(aAtFront ? mMapBegin > 0 : mMapBegin + mChunkCount < mMapCapacity) return true;
+
+			// Only the chunk pointers are moved, the elements stay where they are
+			const uint32_t required = mChunkCount + 1;
+			if(required * 2 <= mMapCapacity) {
+				const uint32_t begin = (mMapCapacity - required) / 2 + (aAtFront ? 1 : 0);
+				std::memmove(mMap + begin, mMap + mMapBegin, sizeof(T*) * mChunkCount);
+				mMapBegin = begin;
+				return true;
+			}
+
+			const uint32_t capacity = Max<uint32_t>(mMapCapacity * 2, MIN_MAP_CAPACITY);
+			T** const map = static_cast<T**>(mAllocator->Allocate(sizeof(T*) * capacity));
+			if(map == nullptr) return false;
+			const uint32_t begin = (capacity - required) / 2 + (aAtFront ? 1 : 0);
+			if(mChunkCount > 0) std::memcpy(map + begin, mMap + mMapBegin, sizeof(T*) * mChunkCount);
+			if(mMap) mAllocator->Deallocate(mMap);
+			mMap = map;
+			mMapCapacity = capacity;
+			mMapBegin = begin;
+			return true;
+		}
+
+		bool SOLAIRE_DEFAULT_CALL AddChunkBack() throw() {
+			if(! MakeMapRoom(false)) return false;
+			T* const chunk = AllocateChunk();
+			if(chunk == nullptr) return false;
+			mMap[mMapBegin + mChunkCount] = chunk;
+			++mChunkCount;
+			return true;
+		}
+
+		bool SOLAIRE_DEFAULT_CALL AddChunkFront() throw() {
+			if(! MakeMapRoom(true)) return false;
+			T* const chunk = AllocateChunk();
+			if(chunk == nullptr) return false;
+			--mMapBegin;
+			mMap[mMapBegin] = chunk;
+			++mChunkCount;
+			mFront += CHUNK_ELEMENTS;
+			return true;
+		}
+
+		SOLAIRE_FORCE_INLINE uint32_t SOLAIRE_DEFAULT_CALL GetBackCapacity() const throw() {
+			return mChunkCount * CHUNK_ELEMENTS - mFront;
+		}
+
+		T* SOLAIRE_DEFAULT_CALL AllocateBack() {
+			if(mSize == GetBackCapacity()) {
+				SolaireRuntimeAssert(AddChunkBack(), "SolaireCPP : ChunkedDeque failed to allocate memory");
+			}
+			return GetElement(mSize);
+		}
+
+		T* SOLAIRE_DEFAULT_CALL AllocateFront() {
+			if(mFront == 0) {
+				SolaireRuntimeAssert(AddChunkFront(), "SolaireCPP : ChunkedDeque failed to allocate memory");
+			}
+			const uint32_t index = mFront - 1;
+			return mMap[mMapBegin + index / CHUNK_ELEMENTS] + (index & CHUNK_MASK);
+		}
+
+		void SOLAIRE_DEFAULT_CALL TrimBack() throw() {
+			while(mChunkCount > 0 && (mChunkCount - 1) * CHUNK_ELEMENTS >= mFront + mSize) {
+				--mChunkCount;
+				DeallocateChunk(mMap[mMapBegin + mChunkCount]);
+			}
+		}
+
+		void SOLAIRE_DEFAULT_CALL TrimFront() throw() {
+			while(mFront >= CHUNK_ELEMENTS) {
+				DeallocateChunk(mMap[mMapBegin]);
+				++mMapBegin;
+				--mChunkCount;
+				mFront -= CHUNK_ELEMENTS;
+			}
+		}
+
+		uint32_t SOLAIRE_DEFAULT_CALL GetIndex(const ConstIterator aPosition) {
+			return static_cast<uint32_t>(aPosition - this->begin());
+		}
+
+		template<class ...PARAMS>
+		T& SOLAIRE_DEFAULT_CALL EmplaceAt(const uint32_t aIndex, PARAMS&&... aParams) {
+			SolaireRuntimeAssert(aIndex <= mSize, "SolaireCPP : ChunkedDeque insert position is out of bounds");
+			if(aIndex == 0) return EmplaceFront(std::forward<PARAMS>(aParams)...);
+			if(aIndex == mSize) return EmplaceBack(std::forward<PARAMS>(aParams)...);
+
+			T tmp(std::forward<PARAMS>(aParams)...);
+			if(aIndex < mSize / 2) {
+				EmplaceFront(std::move(*GetElement(0)));
+				for(uint32_t i = 1; i < aIndex; ++i) {
+					*GetElement(i) = std::move(*GetElement(i + 1));
+				}
+			}else {
+				EmplaceBack(std::move(*GetElement(mSize - 1)));
+				for(uint32_t i = mSize - 2; i > aIndex; --i) {
+					*GetElement(i) = std::move(*GetElement(i - 1));
+				}
+			}
+			T& element = *GetElement(aIndex);
+			element = std::move(tmp);
+			return element;
+		}
+
+		void SOLAIRE_DEFAULT_CALL Reverse(uint32_t aBegin, uint32_t aEnd) {
+			while(aBegin + 1 < aEnd) {
+				--aEnd;
+				std::swap(*GetElement(aBegin), *GetElement(aEnd));
+				++aBegin;
+			}
+		}
+
+		void SOLAIRE_DEFAULT_CALL RemoveAt(const uint32_t aIndex) {
+			if(aIndex < mSize / 2) {
+				for(uint32_t i = aIndex; i > 0; --i) {
+					*GetElement(i) = std::move(*GetElement(i - 1));
+				}
+				PopFront();
+			}else {
+				for(uint32_t i = aIndex + 1; i < mSize; ++i) {
+					*GetElement(i - 1) = std::move(*GetElement(i));
+				}
+				PopBack();
+			}
+		}
+
+		void SOLAIRE_DEFAULT_CALL Destroy() throw() {
+			Clear();
+			DeallocateChunk(nullptr);
+			if(mMap) mAllocator->Deallocate(mMap);
+			mMap = nullptr;
+			mMapCapacity = 0;
+			mMapBegin = 0;
+		}
+	public:
+		ChunkedDeque(Allocator& aAllocator) throw() :
+			mAllocator(&aAllocator),
+			mMap(nullptr),
+			mSpareChunk(nullptr),
+			mMapCapacity(0),
+			mMapBegin(0),
+			mChunkCount(0),
+			mFront(0),
+			mSize(0)
+		{}
+
+		ChunkedDeque(const ChunkedDeque<T, CHUNK_ELEMENTS>& aOther) :
+			mAllocator(aOther.mAllocator),
+			mMap(nullptr),
+			mSpareChunk(nullptr),
+			mMapCapacity(0),
+			mMapBegin(0),
+			mChunkCount(0),
+			mFront(0),
+			mSize(0)
+		{
+			operator=(static_cast<const FixedContainer<T>&>(aOther));
+		}
+
+		ChunkedDeque(ChunkedDeque<T, CHUNK_ELEMENTS>&& aOther) throw() :
+			mAllocator(aOther.mAllocator),
+			mMap(aOther.mMap),
+			mSpareChunk(aOther.mSpareChunk),
+			mMapCapacity(aOther.mMapCapacity),
+			mMapBegin(aOther.mMapBegin),
+			mChunkCount(aOther.mChunkCount),
+			mFront(aOther.mFront),
+			mSize(aOther.mSize)
+		{
+			aOther.mMap = nullptr;
+			aOther.mSpareChunk = nullptr;
+			aOther.mMapCapacity = 0;
+			aOther.mMapBegin = 0;
+			aOther.mChunkCount = 0;
+			aOther.mFront = 0;
+			aOther.mSize = 0;
+		}
+
+		SOLAIRE_EXPORT_CALL ~ChunkedDeque() {
+			Destroy();
+		}
+
+		ChunkedDeque<T, CHUNK_ELEMENTS>& SOLAIRE_DEFAULT_CALL operator=(const ChunkedDeque<T, CHUNK_ELEMENTS>& aOther) {
+			operator=(static_cast<const FixedContainer<T>&>(aOther));
+			return *this;
+		}
+
+		ChunkedDeque<T, CHUNK_ELEMENTS>& SOLAIRE_DEFAULT_CALL operator=(ChunkedDeque<T, CHUNK_ELEMENTS>&& aOther) throw() {
+			if(&aOther == this) return *this;
+			Destroy();
+			std::swap(mAllocator, aOther.mAllocator);
+			std::swap(mMap, aOther.mMap);
+			std::swap(mSpareChunk, aOther.mSpareChunk);
+			std::swap(mMapCapacity, aOther.mMapCapacity);
+			std::swap(mMapBegin, aOther.mMapBegin);
+			std::swap(mChunkCount, aOther.mChunkCount);
+			std::swap(mFront, aOther.mFront);
+			std::swap(mSize, aOther.mSize);
+			return *this;
+		}
+
+		/*!
+			\brief Construct a new element at the back of the deque.
+			\tparam PARAMS The parameter types to pass to the element's constructor.
+			\param aParams The parameters to pass to the element's constructor.
+			\return The new element.
+		*/
+		template<class ...PARAMS>
+		T& SOLAIRE_DEFAULT_CALL EmplaceBack(PARAMS&&... aParams) {
+			T* const element = new(AllocateBack()) T(std::forward<PARAMS>(aParams)...);
+			++mSize;
+			return *element;
+		}
+
+		/*!
+			\brief Construct a new element at the front of the deque.
+			\tparam PARAMS The parameter types to pass to the element's constructor.
+			\param aParams The parameters to pass to the element's constructor.
+			\return The new element.
+		*/
+		template<class ...PARAMS>
+		T& SOLAIRE_DEFAULT_CALL EmplaceFront(PARAMS&&... aParams) {
+			T* const element = new(AllocateFront()) T(std::forward<PARAMS>(aParams)...);
+			--mFront;
+			++mSize;
+			return *element;
+		}
+
+		using List<T>::PushBackRange;
+
+		SOLAIRE_FORCE_INLINE const T& SOLAIRE_DEFAULT_CALL operator[](const uint32_t aIndex) const throw() {
+			return *GetElement(aIndex);
+		}
+
+		// Inherited from FixedContainer
+
+		uint32_t SOLAIRE_EXPORT_CALL Size() const override {
+			return mSize;
+		}
+
+		Type& SOLAIRE_EXPORT_CALL operator[](const uint32_t aIndex) override {
+			return *GetElement(aIndex);
+		}
+
+		bool SOLAIRE_EXPORT_CALL IsContiguous() const override {
+			return false;
+		}
+
+		Allocator& SOLAIRE_EXPORT_CALL GetAllocator() const override {
+			return *mAllocator;
+		}
+
+		bool SOLAIRE_EXPORT_CALL Reserve(const uint32_t aCapacity) override {
+			while(GetBackCapacity() < aCapacity) {
+				if(! AddChunkBack()) return false;
+			}
+			return true;
+		}
+
+		Solaire::Iterator<T>& SOLAIRE_EXPORT_CALL GetBeginIterator() override {
+			mBeginIterator = ChunkedDequeIterator<T, CHUNK_ELEMENTS>(mMap + mMapBegin, mFront);
+			return mBeginIterator;
+		}
+
+		Type* SOLAIRE_EXPORT_CALL GetChunk(const uint32_t aIndex, uint32_t& aLength) override {
+			const uint32_t index = mFront + aIndex;
+			aLength = Min<uint32_t>(mSize - aIndex, CHUNK_ELEMENTS - (index & CHUNK_MASK));
+			return mMap[mMapBegin + index / CHUNK_ELEMENTS] + (index & CHUNK_MASK);
+		}
+
+		// Inherited from Stack
+
+		Type& SOLAIRE_EXPORT_CALL PushBack(const Type& aValue) override {
+			return EmplaceBack(aValue);
+		}
+
+		Type& SOLAIRE_EXPORT_CALL PushBack(Type&& aValue) override {
+			return EmplaceBack(std::move(aValue));
+		}
+
+		void SOLAIRE_EXPORT_CALL PushBackRange(const Type* const aValues, const uint32_t aCount) override {
+			// Chunks never move, so the new elements can be elements of this deque
+			SolaireRuntimeAssert(Reserve(mSize + aCount), "SolaireCPP : ChunkedDeque failed to allocate memory");
+			uint32_t i = 0;
+			while(i < aCount) {
+				const uint32_t index = mFront + mSize;
+				const uint32_t length = Min<uint32_t>(aCount - i, CHUNK_ELEMENTS - (index & CHUNK_MASK));
+				CopyElements(aValues + i, mMap[mMapBegin + index / CHUNK_ELEMENTS] + (index & CHUNK_MASK), length);
+				mSize += length;
+				i += length;
+			}
+		}
+
+		Type SOLAIRE_EXPORT_CALL PopBack() override {
+			SolaireRuntimeAssert(mSize > 0, "SolaireCPP : ChunkedDeque::PopBack called on an empty deque");
+			T& element = *GetElement(mSize - 1);
+			T tmp(std::move(element));
+			element.~T();
+			--mSize;
+			TrimBack();
+			return tmp;
+		}
+
+		Stack<T>& SOLAIRE_EXPORT_CALL operator=(const FixedContainer<T>& aOther) override {
+			if(&aOther == this) return *this;
+			Clear();
+			PushBackRange(aOther);
+			return *this;
+		}
+
+		void SOLAIRE_EXPORT_CALL Clear() override {
+			if(! std::is_trivially_destructible<T>::value) {
+				for(uint32_t i = 0; i < mSize; ++i) {
+					GetElement(i)->~T();
+				}
+			}
+			mSize = 0;
+			mFront = 0;
+			TrimBack();
+		}
+
+		// Inherited from DoubleEndedStack
+
+		Type& SOLAIRE_EXPORT_CALL PushFront(const Type& aValue) override {
+			return EmplaceFront(aValue);
+		}
+
+		Type& SOLAIRE_EXPORT_CALL PushFront(Type&& aValue) override {
+			return EmplaceFront(std::move(aValue));
+		}
+
+		Type SOLAIRE_EXPORT_CALL PopFront() override {
+			SolaireRuntimeAssert(mSize > 0, "SolaireCPP : ChunkedDeque::PopFront called on an empty deque");
+			T& element = *GetElement(0);
+			T tmp(std::move(element));
+			element.~T();
+			++mFront;
+			--mSize;
+			TrimFront();
+			return tmp;
+		}
+
+		// Inherited from List
+
+		Type& SOLAIRE_EXPORT_CALL InsertBefore(const ConstIterator aPosition, const Type& aValue) override {
+			return EmplaceAt(GetIndex(aPosition), aValue);
+		}
+
+		Type& SOLAIRE_EXPORT_CALL InsertAfter(const ConstIterator aPosition, const Type& aValue) override {
+			const uint32_t index = GetIndex(aPosition);
+			SolaireRuntimeAssert(index < mSize, "SolaireCPP : ChunkedDeque::InsertAfter called with the end iterator");
+			return EmplaceAt(index + 1, aValue);
+		}
+
+		bool SOLAIRE_EXPORT_CALL Erase(const ConstIterator aPosition) override {
+			const uint32_t index = GetIndex(aPosition);
+			if(index >= mSize) return false;
+			RemoveAt(index);
+			return true;
+		}
+
+		void SOLAIRE_EXPORT_CALL InsertRange(const ConstIterator aPosition, const Type* const aValues, const uint32_t aCount) override {
+			// Append the new elements, then rotate them into position
+			const uint32_t index = GetIndex(aPosition);
+			const uint32_t size = mSize;
+			PushBackRange(aValues, aCount);
+			if(index < size) {
+				Reverse(index, size);
+				Reverse(size, mSize);
+				Reverse(index, mSize);
+			}
+		}
+	};
+
+}
+
+#endif
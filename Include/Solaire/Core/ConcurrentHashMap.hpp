@@ -0,0 +1,674 @@
+#ifndef SOLAIRE_CONCURRENT_HASH_MAP_HPP
+#define SOLAIRE_CONCURRENT_HASH_MAP_HPP
+
+//Copyright 2015 Adam Smith
+//
+//Licensed under the Apache License, Version 2.0 (the "License");
+//you may not use this file except in compliance with the License.
+//You may obtain a copy of the License at
+//
+//    http://www.apache.org/licenses/LICENSE-2.0
+//
+//Unless required by applicable law or agreed to in writing, software
+//distributed under the License is distributed on an "AS IS" BASIS,
+//WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//See the License for the specific language governing permissions and
+//limitations under the License.
+
+// Contact :
+// Email             : solairelibrary@mail.com
+// GitHub repository : https://github.com/SolaireLibrary/SolaireCPP
+
+/*!
+	\file ConcurrentHashMap.hpp
+	\brief
+	\author
+	Created			: Adam Smith
+	Last modified	: Adam Smith
+	\version 1.0
+	\date
+	Created			: 18th October 2026
+	Last Modified	: 18th October 2026
+*/
+
+#include <new>
+#include <atomic>
+#include <cstring>
+#include <utility>
+#include <stdexcept>
+#include <type_traits>
+#ifndef SOLAIRE_DISABLE_MULTITHREADING
+	#include <mutex>
+#endif
+#include "HashMap.hpp"
+
+namespace Solaire {
+
+	/*!
+		\class ConcurrentHashMap
+		\brief A hash map that can be read and modified by many threads at once.
+		\detail
+		Keys are split between \a SHARD_COUNT shards by their hash, each shard is an open addressing table with its own
+		lock, so writers only contend when they modify the same shard. Shards grow independently of each other.
+
+		If \a K and \a V are trivially copyable then reads do not lock. Each shard has a sequence number that is odd while
+		a writer is modifying it, a reader copies the slots it probes and retries if the sequence number changed. Slots are
+		stored as relaxed atomic words so that these copies never race with a writer, values are returned by copy for this
+		reason. Key comparison may see a partially written key, so operator== must not follow pointers stored in \a K.
+		A table replaced by growth may still be probed by a reader, so it is retired rather than freed. Each shard has an
+		epoch and counts its lock free readers by the parity of the epoch they entered in. Writers advance the epoch once
+		the readers of the previous epoch have left, and free a retired table two epochs after it was replaced, so at most
+		the tables replaced during the last two epochs are kept.
+
+		If either type is not trivially copyable then readers take the shard's lock.
+		\tparam K The key type, must be comparable with operator==. Keys are hashed with HashKey.
+		\tparam V The value type.
+		\tparam SHARD_COUNT The number of independently locked shards, must be a power of two.
+		\author Adam Smith
+		\date Created : 18th October 2026
+		\date Modified : 18th October 2026
+		\version 1.0
+		\see HashMap
+		\see HashKey
+	*/
+	template<class K, class V, const uint32_t SHARD_COUNT = 16>
+	class ConcurrentHashMap {
+	public:
+		static_assert(IsPowerOfTwo(SHARD_COUNT), "SolaireCPP : ConcurrentHashMap shard count must be a power of two");
+
+		enum : uint32_t {
+			MIN_SHARD_CAPACITY = 16
+		};
+
+		enum : bool {
+			LOCK_FREE_READS = std::is_trivially_copyable<K>::value && std::is_trivially_copyable<V>::value
+		};
+	private:
+		enum : uint8_t {
+			SLOT_EMPTY,
+			SLOT_FULL,
+			SLOT_DELETED
+		};
+
+		enum : uint32_t {
+			CACHE_LINE = 64
+		};
+
+		struct Slot {
+			K Key;
+			V Value;
+
+			template<class ...PARAMS>
+			Slot(const K& aKey, PARAMS&&... aParams) :
+				Key(aKey),
+				Value(std::forward<PARAMS>(aParams)...)
+			{}
+		};
+
+		typedef typename std::aligned_storage<sizeof(Slot), std::alignment_of<Slot>::value>::type SlotStorage;
+		typedef std::atomic<uint64_t> SlotWord;
+
+		enum : uint32_t {
+			SLOT_WORDS = (sizeof(Slot) + sizeof(uint64_t) - 1) / sizeof(uint64_t),
+			SLOT_BYTES = LOCK_FREE_READS ? SLOT_WORDS * sizeof(SlotWord) : sizeof(Slot),
+			SLOT_ALIGNMENT = LOCK_FREE_READS ? std::alignment_of<SlotWord>::value : std::alignment_of<Slot>::value
+		};
+
+		static_assert(sizeof(std::atomic<uint8_t>) == 1, "SolaireCPP : ConcurrentHashMap requires single byte atomics");
+
+		struct Table {
+			Table* Retired;
+			uint32_t Epoch;
+			uint32_t Capacity;
+			std::atomic<uint8_t>* States;
+			uint8_t* Slots;
+		};
+
+		struct alignas(CACHE_LINE) Shard {
+			std::atomic<uint32_t> Sequence;
+			std::atomic<uint32_t> Epoch;
+			std::atomic<uint32_t> Readers[2];
+			std::atomic<Table*> Current;
+			std::atomic<uint32_t> Size;
+			uint32_t Deleted;
+			Table* Retired;
+			#ifndef SOLAIRE_DISABLE_MULTITHREADING
+				std::mutex Lock;
+			#endif
+		};
+
+		/*!
+			\brief Counts a lock free reader of a shard while it is in scope, so that the tables it probes are not freed.
+			\detail The reader is counted in the epoch that it entered, if the epoch advances while it is being counted it retries.
+		*/
+		class ReadGuard {
+		private:
+			std::atomic<uint32_t>* mReaders;
+		private:
+			ReadGuard(const ReadGuard&) = delete;
+			ReadGuard(ReadGuard&&) = delete;
+			ReadGuard& operator=(const ReadGuard&) = delete;
+			ReadGuard& operator=(ReadGuard&&) = delete;
+		public:
+			ReadGuard(Shard& aShard) throw() {
+				while(true) {
+					const uint32_t epoch = aShard.Epoch.load(std::memory_order_seq_cst);
+					mReaders = aShard.Readers + (epoch & 1);
+					mReaders->fetch_add(1, std::memory_order_seq_cst);
+					if(aShard.Epoch.load(std::memory_order_seq_cst) == epoch) break;
+					mReaders->fetch_sub(1, std::memory_order_relaxed);
+				}
+			}
+
+			~ReadGuard() throw() {
+				mReaders->fetch_sub(1, std::memory_order_release);
+			}
+		};
+	private:
+		AllocatorI& mAllocator;
+		const HashFunction<uint32_t>& mHashFunction;
+		mutable Shard mShards[SHARD_COUNT];
+	private:
+		ConcurrentHashMap(const ConcurrentHashMap<K, V, SHARD_COUNT>&) = delete;
+		ConcurrentHashMap(ConcurrentHashMap<K, V, SHARD_COUNT>&&) = delete;
+		ConcurrentHashMap<K, V, SHARD_COUNT>& operator=(const ConcurrentHashMap<K, V, SHARD_COUNT>&) = delete;
+		ConcurrentHashMap<K, V, SHARD_COUNT>& operator=(ConcurrentHashMap<K, V, SHARD_COUNT>&&) = delete;
+
+		static SOLAIRE_FORCE_INLINE uint32_t SOLAIRE_DEFAULT_CALL TableHeaderBytes(const uint32_t aCapacity) throw() {
+			return CeilToMultiple<uint32_t>(sizeof(Table) + aCapacity, SLOT_ALIGNMENT);
+		}
+
+		SOLAIRE_FORCE_INLINE Shard& SOLAIRE_DEFAULT_CALL GetShard(const uint32_t aHash) const throw() {
+			// Mix the hash so that shards do not depend on the same bits as slot indices
+			return mShards[((aHash * 0x9E3779B1) >> 16) & (SHARD_COUNT - 1)];
+		}
+
+		static SOLAIRE_FORCE_INLINE void SOLAIRE_DEFAULT_CALL BeginWrite(Shard& aShard) throw() {
+			aShard.Sequence.store(aShard.Sequence.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+			std::atomic_thread_fence(std::memory_order_release);
+		}
+
+		static SOLAIRE_FORCE_INLINE void SOLAIRE_DEFAULT_CALL EndWrite(Shard& aShard) throw() {
+			aShard.Sequence.store(aShard.Sequence.load(std::memory_order_relaxed) + 1, std::memory_order_release);
+		}
+
+		static SOLAIRE_FORCE_INLINE uint8_t SOLAIRE_DEFAULT_CALL GetState(const Table& aTable, const uint32_t aIndex) throw() {
+			return aTable.States[aIndex].load(std::memory_order_relaxed);
+		}
+
+		static SOLAIRE_FORCE_INLINE void SOLAIRE_DEFAULT_CALL SetState(Table& aTable, const uint32_t aIndex, const uint8_t aState) throw() {
+			aTable.States[aIndex].store(aState, std::memory_order_relaxed);
+		}
+
+		// Slots of a table without lock free reads are constructed in place
+
+		static SOLAIRE_FORCE_INLINE Slot& SOLAIRE_DEFAULT_CALL GetSlot(const Table& aTable, const uint32_t aIndex) throw() {
+			return reinterpret_cast<Slot*>(aTable.Slots)[aIndex];
+		}
+
+		// Slots of a table with lock free reads are copied in and out of SLOT_WORDS atomic words
+
+		static SOLAIRE_FORCE_INLINE SlotWord* SOLAIRE_DEFAULT_CALL GetSlotWords(const Table& aTable, const uint32_t aIndex) throw() {
+			return reinterpret_cast<SlotWord*>(aTable.Slots) + aIndex * SLOT_WORDS;
+		}
+
+		static Slot& SOLAIRE_DEFAULT_CALL LoadSlot(const Table& aTable, const uint32_t aIndex, SlotStorage& aStorage) throw() {
+			const SlotWord* const src = GetSlotWords(aTable, aIndex);
+			uint64_t words[SLOT_WORDS];
+			for(uint32_t i = 0; i < SLOT_WORDS; ++i) words[i] = src[i].load(std::memory_order_relaxed);
+			std::memcpy(&aStorage, words, sizeof(Slot));
+			return *reinterpret_cast<Slot*>(&aStorage);
+		}
+
+		static void SOLAIRE_DEFAULT_CALL StoreSlot(Table& aTable, const uint32_t aIndex, const Slot& aSlot) throw() {
+			SlotWord* const dst = GetSlotWords(aTable, aIndex);
+			uint64_t words[SLOT_WORDS] = {};
+			std::memcpy(words, static_cast<const void*>(&aSlot), sizeof(Slot));
+			for(uint32_t i = 0; i < SLOT_WORDS; ++i) dst[i].store(words[i], std::memory_order_relaxed);
+		}
+
+		Table* SOLAIRE_DEFAULT_CALL AllocateTable(const uint32_t aCapacity) {
+			void* const block = mAllocator.Allocate(TableHeaderBytes(aCapacity) + SLOT_BYTES * aCapacity);
+			SolaireRuntimeAssert(block != nullptr, "SolaireCPP : ConcurrentHashMap failed to allocate memory");
+			Table* const table = static_cast<Table*>(block);
+			table->Retired = nullptr;
+			table->Epoch = 0;
+			table->Capacity = aCapacity;
+			table->States = reinterpret_cast<std::atomic<uint8_t>*>(static_cast<uint8_t*>(block) + sizeof(Table));
+			table->Slots = static_cast<uint8_t*>(block) + TableHeaderBytes(aCapacity);
+			for(uint32_t i = 0; i < aCapacity; ++i) new(table->States + i) std::atomic<uint8_t>(SLOT_EMPTY);
+			if(LOCK_FREE_READS) {
+				SlotWord* const words = GetSlotWords(*table, 0);
+				for(uint32_t i = 0; i < aCapacity * SLOT_WORDS; ++i) new(words + i) SlotWord(0);
+			}
+			return table;
+		}
+
+		void SOLAIRE_DEFAULT_CALL DestroyEntries(Table& aTable) throw() {
+			if(std::is_trivially_destructible<Slot>::value) return;
+			for(uint32_t i = 0; i < aTable.Capacity; ++i) {
+				if(GetState(aTable, i) == SLOT_FULL) GetSlot(aTable, i).~Slot();
+			}
+		}
+
+		void SOLAIRE_DEFAULT_CALL FreeRetired(Table*& aRetired) throw() {
+			while(aRetired) {
+				Table* const next = aRetired->Retired;
+				mAllocator.Deallocate(aRetired);
+				aRetired = next;
+			}
+		}
+
+		/*!
+			\brief Free the retired tables of a locked shard that no lock free reader could be probing.
+			\detail
+			While the epoch is E every reader of epoch E - 2 has left, so the counter of E + 1 only counts readers of E - 1.
+			When that counter is zero the epoch can advance. A reader loads Current after it is counted, so a table that
+			was replaced in epoch E can only be probed by readers of epoch E or earlier, and is freed once the epoch is E + 2.
+		*/
+		void SOLAIRE_DEFAULT_CALL ReclaimRetired(Shard& aShard) throw() {
+			if(aShard.Retired == nullptr) return;
+
+			uint32_t epoch = aShard.Epoch.load(std::memory_order_relaxed);
+			for(uint32_t i = 0; i < 2; ++i) {
+				if(aShard.Readers[(epoch + 1) & 1].load(std::memory_order_seq_cst) != 0) break;
+				++epoch;
+				aShard.Epoch.store(epoch, std::memory_order_seq_cst);
+			}
+
+			// Tables are retired in order, so every table after the first one that can be freed can also be freed
+			Table** retired = &aShard.Retired;
+			while(*retired && epoch - (*retired)->Epoch < 2) retired = &(*retired)->Retired;
+			FreeRetired(*retired);
+		}
+
+		/*!
+			\brief Find the slot that contains a key.
+			\param aStorage If the table has lock free reads, set to a copy of the slot that was found.
+			\return The index of the slot, or UINT32_MAX if the key is not in the table.
+		*/
+		static uint32_t SOLAIRE_DEFAULT_CALL FindIndex(const Table& aTable, const K& aKey, const uint32_t aHash, SlotStorage& aStorage) throw() {
+			const uint32_t mask = aTable.Capacity - 1;
+			uint32_t index = aHash & mask;
+			for(uint32_t i = 0; i < aTable.Capacity; ++i) {
+				const uint8_t state = GetState(aTable, index);
+				if(state == SLOT_EMPTY) break;
+				if(state == SLOT_FULL) {
+					const Slot& slot = LOCK_FREE_READS ? LoadSlot(aTable, index, aStorage) : GetSlot(aTable, index);
+					if(slot.Key == aKey) return index;
+				}
+				index = (index + 1) & mask;
+			}
+			return UINT32_MAX;
+		}
+
+		static uint32_t SOLAIRE_DEFAULT_CALL FindInsertIndex(const Table& aTable, const uint32_t aHash) throw() {
+			const uint32_t mask = aTable.Capacity - 1;
+			uint32_t index = aHash & mask;
+			while(GetState(aTable, index) == SLOT_FULL) index = (index + 1) & mask;
+			return index;
+		}
+
+		void SOLAIRE_DEFAULT_CALL Grow(Shard& aShard, const uint32_t aSize) {
+			Table* const old = aShard.Current.load(std::memory_order_relaxed);
+			const uint32_t capacity = Max<uint32_t>(NextPowerOfTwo(aSize * 2), MIN_SHARD_CAPACITY);
+			Table* const table = AllocateTable(capacity);
+
+			// Readers can keep using the old table while the new one is built
+			if(old) {
+				SlotStorage storage;
+				for(uint32_t i = 0; i < old->Capacity; ++i) {
+					if(GetState(*old, i) != SLOT_FULL) continue;
+					if(LOCK_FREE_READS) {
+						const Slot& slot = LoadSlot(*old, i, storage);
+						const uint32_t index = FindInsertIndex(*table, HashKey(mHashFunction, slot.Key));
+						StoreSlot(*table, index, slot);
+						SetState(*table, index, SLOT_FULL);
+					}else {
+						Slot& slot = GetSlot(*old, i);
+						const uint32_t index = FindInsertIndex(*table, HashKey(mHashFunction, slot.Key));
+						new(&GetSlot(*table, index)) Slot(std::move(slot));
+						SetState(*table, index, SLOT_FULL);
+					}
+				}
+			}
+
+			BeginWrite(aShard);
+			aShard.Current.store(table, std::memory_order_seq_cst);
+			aShard.Deleted = 0;
+			EndWrite(aShard);
+
+			if(old) {
+				if(LOCK_FREE_READS) {
+					old->Retired = aShard.Retired;
+					old->Epoch = aShard.Epoch.load(std::memory_order_relaxed);
+					aShard.Retired = old;
+					ReclaimRetired(aShard);
+				}else {
+					DestroyEntries(*old);
+					mAllocator.Deallocate(old);
+				}
+			}
+		}
+
+		template<class ...PARAMS>
+		bool SOLAIRE_DEFAULT_CALL InsertLocked(Shard& aShard, const bool aOverwrite, const K& aKey, const uint32_t aHash, PARAMS&&... aParams) {
+			ReclaimRetired(aShard);
+
+			Table* table = aShard.Current.load(std::memory_order_relaxed);
+			if(table) {
+				SlotStorage storage;
+				const uint32_t index = FindIndex(*table, aKey, aHash, storage);
+				if(index != UINT32_MAX) {
+					if(aOverwrite) {
+						if(LOCK_FREE_READS) {
+							// Build the value before the write begins, a throw must not leave the sequence odd
+							Slot& slot = *reinterpret_cast<Slot*>(&storage);
+							slot.Value = V(std::forward<PARAMS>(aParams)...);
+							BeginWrite(aShard);
+							StoreSlot(*table, index, slot);
+							EndWrite(aShard);
+						}else {
+							// Readers take the shard's lock, so the sequence is not needed
+							GetSlot(*table, index).Value = V(std::forward<PARAMS>(aParams)...);
+						}
+					}
+					return false;
+				}
+			}
+
+			const uint32_t size = aShard.Size.load(std::memory_order_relaxed);
+			if(table == nullptr || (size + aShard.Deleted + 1) * 4 > table->Capacity * 3) {
+				Grow(aShard, size + 1);
+				table = aShard.Current.load(std::memory_order_relaxed);
+			}
+
+			const uint32_t index = FindInsertIndex(*table, aHash);
+			const bool reused = GetState(*table, index) == SLOT_DELETED;
+			if(LOCK_FREE_READS) {
+				const Slot slot(aKey, std::forward<PARAMS>(aParams)...);
+				BeginWrite(aShard);
+				StoreSlot(*table, index, slot);
+				SetState(*table, index, SLOT_FULL);
+				EndWrite(aShard);
+			}else {
+				new(&GetSlot(*table, index)) Slot(aKey, std::forward<PARAMS>(aParams)...);
+				SetState(*table, index, SLOT_FULL);
+			}
+			if(reused) --aShard.Deleted;
+			aShard.Size.store(size + 1, std::memory_order_relaxed);
+			return true;
+		}
+	public:
+		/*!
+			\brief Create an empty map, no memory is allocated until the first element is inserted.
+			\param aAllocator The allocator that tables will be allocated from, it must be safe to call from multiple threads.
+			\param aHashFunction The function used to hash keys, it must outlive the map.
+		*/
+		ConcurrentHashMap(AllocatorI& aAllocator, const HashFunction<uint32_t>& aHashFunction) throw() :
+			mAllocator(aAllocator),
+			mHashFunction(aHashFunction)
+		{
+			for(Shard& shard : mShards) {
+				shard.Sequence.store(0, std::memory_order_relaxed);
+				shard.Epoch.store(0, std::memory_order_relaxed);
+				shard.Readers[0].store(0, std::memory_order_relaxed);
+				shard.Readers[1].store(0, std::memory_order_relaxed);
+				shard.Current.store(nullptr, std::memory_order_relaxed);
+				shard.Size.store(0, std::memory_order_relaxed);
+				shard.Deleted = 0;
+				shard.Retired = nullptr;
+			}
+		}
+
+		~ConcurrentHashMap() throw() {
+			for(Shard& shard : mShards) {
+				Table* const table = shard.Current.load(std::memory_order_relaxed);
+				if(table) {
+					DestroyEntries(*table);
+					mAllocator.Deallocate(table);
+				}
+				FreeRetired(shard.Retired);
+			}
+		}
+
+		/*!
+			\brief Copy the value mapped to a key.
+			\param aKey The key to search for.
+			\param aValue Set to the value mapped to \a aKey, unchanged if the key is not in the map.
+			\return True if the key was in the map.
+		*/
+		bool SOLAIRE_DEFAULT_CALL Find(const K& aKey, V& aValue) const {
+			const uint32_t hash = HashKey(mHashFunction, aKey);
+			Shard& shard = GetShard(hash);
+			SlotStorage storage;
+
+			if(! LOCK_FREE_READS) {
+				bool found = false;
+				SolaireSynchronized(shard.Lock,
+					const Table* const table = shard.Current.load(std::memory_order_relaxed);
+					const uint32_t index = table ? FindIndex(*table, aKey, hash, storage) : UINT32_MAX;
+					if(index != UINT32_MAX) {
+						aValue = GetSlot(*table, index).Value;
+						found = true;
+					}
+				)
+				return found;
+			}
+
+			const ReadGuard guard(shard);
+			while(true) {
+				const uint32_t sequence = shard.Sequence.load(std::memory_order_acquire);
+				if(sequence & 1) continue;
+
+				const Table* const table = shard.Current.load(std::memory_order_seq_cst);
+				const uint32_t index = table ? FindIndex(*table, aKey, hash, storage) : UINT32_MAX;
+
+				std::atomic_thread_fence(std::memory_order_acquire);
+				if(shard.Sequence.load(std::memory_order_relaxed) != sequence) continue;
+
+				if(index == UINT32_MAX) return false;
+				std::memcpy(static_cast<void*>(&aValue), &reinterpret_cast<const Slot*>(&storage)->Value, sizeof(V));
+				return true;
+			}
+		}
+
+		bool SOLAIRE_DEFAULT_CALL Contains(const K& aKey) const {
+			const uint32_t hash = HashKey(mHashFunction, aKey);
+			Shard& shard = GetShard(hash);
+			SlotStorage storage;
+
+			if(! LOCK_FREE_READS) {
+				bool found = false;
+				SolaireSynchronized(shard.Lock,
+					const Table* const table = shard.Current.load(std::memory_order_relaxed);
+					found = table != nullptr && FindIndex(*table, aKey, hash, storage) != UINT32_MAX;
+				)
+				return found;
+			}
+
+			const ReadGuard guard(shard);
+			while(true) {
+				const uint32_t sequence = shard.Sequence.load(std::memory_order_acquire);
+				if(sequence & 1) continue;
+
+				const Table* const table = shard.Current.load(std::memory_order_seq_cst);
+				const bool found = table != nullptr && FindIndex(*table, aKey, hash, storage) != UINT32_MAX;
+
+				std::atomic_thread_fence(std::memory_order_acquire);
+				if(shard.Sequence.load(std::memory_order_relaxed) == sequence) return found;
+			}
+		}
+
+		/*!
+			\brief Map a key to a value, replacing the existing value if there is one.
+			\param aKey The key to insert.
+			\param aValue The value to map to \a aKey.
+			\return True if the key was not already in the map.
+		*/
+		bool SOLAIRE_DEFAULT_CALL Insert(const K& aKey, const V& aValue) {
+			const uint32_t hash = HashKey(mHashFunction, aKey);
+			Shard& shard = GetShard(hash);
+			bool inserted;
+			SolaireSynchronized(shard.Lock,
+				inserted = InsertLocked(shard, true, aKey, hash, aValue);
+			)
+			return inserted;
+		}
+
+		/*!
+			\brief Map a key to a value constructed in place, if the key is not already in the map.
+			\tparam PARAMS The parameter types to pass to the value's constructor.
+			\param aKey The key to insert.
+			\param aParams The parameters to pass to the value's constructor.
+			\return True if the key was not already in the map.
+		*/
+		template<class ...PARAMS>
+		bool SOLAIRE_DEFAULT_CALL Emplace(const K& aKey, PARAMS&&... aParams) {
+			const uint32_t hash = HashKey(mHashFunction, aKey);
+			Shard& shard = GetShard(hash);
+			bool inserted;
+			SolaireSynchronized(shard.Lock,
+				inserted = InsertLocked(shard, false, aKey, hash, std::forward<PARAMS>(aParams)...);
+			)
+			return inserted;
+		}
+
+		/*!
+			\brief Modify the value mapped to a key while its shard is locked.
+			\detail Lock free readers will not see the value until \a aFunction returns.
+			\param aKey The key to search for.
+			\param aFunction A function with the signature void(V& aValue).
+			\return True if the key was in the map.
+		*/
+		template<class F>
+		bool SOLAIRE_DEFAULT_CALL Update(const K& aKey, F aFunction) {
+			const uint32_t hash = HashKey(mHashFunction, aKey);
+			Shard& shard = GetShard(hash);
+			bool found = false;
+			SolaireSynchronized(shard.Lock,
+				Table* const table = shard.Current.load(std::memory_order_relaxed);
+				SlotStorage storage;
+				const uint32_t index = table ? FindIndex(*table, aKey, hash, storage) : UINT32_MAX;
+				if(index != UINT32_MAX) {
+					if(LOCK_FREE_READS) {
+						// Modify a copy so that a throwing function cannot leave the sequence odd
+						Slot& slot = *reinterpret_cast<Slot*>(&storage);
+						aFunction(slot.Value);
+						BeginWrite(shard);
+						StoreSlot(*table, index, slot);
+						EndWrite(shard);
+					}else {
+						aFunction(GetSlot(*table, index).Value);
+					}
+					found = true;
+				}
+			)
+			return found;
+		}
+
+		/*!
+			\brief Remove a key and its value from the map.
+			\param aKey The key to remove.
+			\return True if the key was in the map.
+		*/
+		bool SOLAIRE_DEFAULT_CALL Erase(const K& aKey) {
+			const uint32_t hash = HashKey(mHashFunction, aKey);
+			Shard& shard = GetShard(hash);
+			bool found = false;
+			SolaireSynchronized(shard.Lock,
+				ReclaimRetired(shard);
+				Table* const table = shard.Current.load(std::memory_order_relaxed);
+				SlotStorage storage;
+				const uint32_t index = table ? FindIndex(*table, aKey, hash, storage) : UINT32_MAX;
+				if(index != UINT32_MAX) {
+					BeginWrite(shard);
+					if(! LOCK_FREE_READS) GetSlot(*table, index).~Slot();
+					SetState(*table, index, SLOT_DELETED);
+					EndWrite(shard);
+					++shard.Deleted;
+					shard.Size.store(shard.Size.load(std::memory_order_relaxed) - 1, std::memory_order_relaxed);
+					found = true;
+				}
+			)
+			return found;
+		}
+
+		/*!
+			\brief Remove every element, and free the memory of replaced tables that no reader can be probing.
+		*/
+		void SOLAIRE_DEFAULT_CALL Clear() {
+			for(Shard& shard : mShards) {
+				SolaireSynchronized(shard.Lock,
+					Table* const table = shard.Current.load(std::memory_order_relaxed);
+					if(table) {
+						BeginWrite(shard);
+						DestroyEntries(*table);
+						for(uint32_t i = 0; i < table->Capacity; ++i) SetState(*table, i, SLOT_EMPTY);
+						EndWrite(shard);
+					}
+					shard.Size.store(0, std::memory_order_relaxed);
+					shard.Deleted = 0;
+					ReclaimRetired(shard);
+				)
+			}
+		}
+
+		/*!
+			\brief Grow every shard so that \a aCount evenly distributed elements can be inserted without growing.
+			\param aCount The number of elements to reserve space for.
+		*/
+		void SOLAIRE_DEFAULT_CALL Reserve(const uint32_t aCount) {
+			const uint32_t perShard = (aCount + SHARD_COUNT - 1) / SHARD_COUNT;
+			for(Shard& shard : mShards) {
+				SolaireSynchronized(shard.Lock,
+					const Table* const table = shard.Current.load(std::memory_order_relaxed);
+					if(table == nullptr || perShard * 4 > table->Capacity * 3) {
+						Grow(shard, Max<uint32_t>(perShard, shard.Size.load(std::memory_order_relaxed)));
+					}
+				)
+			}
+		}
+
+		/*!
+			\brief Call a function on each element, locking one shard at a time.
+			\param aFunction A function with the signature void(const K& aKey, const V& aValue).
+		*/
+		template<class F>
+		void SOLAIRE_DEFAULT_CALL ForEach(F aFunction) const {
+			for(Shard& shard : mShards) {
+				SolaireSynchronized(shard.Lock,
+					const Table* const table = shard.Current.load(std::memory_order_relaxed);
+					if(table) {
+						SlotStorage storage;
+						for(uint32_t i = 0; i < table->Capacity; ++i) {
+							if(GetState(*table, i) != SLOT_FULL) continue;
+							const Slot& slot = LOCK_FREE_READS ? LoadSlot(*table, i, storage) : GetSlot(*table, i);
+							aFunction(slot.Key, static_cast<const V&>(slot.Value));
+						}
+					}
+				)
+			}
+		}
+
+		/*!
+			\brief Return the number of elements in the map.
+			\detail The count is exact only if no other thread is modifying the map.
+		*/
+		uint32_t SOLAIRE_DEFAULT_CALL Size() const throw() {
+			uint32_t size = 0;
+			for(const Shard& shard : mShards) size += shard.Size.load(std::memory_order_relaxed);
+			return size;
+		}
+
+		SOLAIRE_FORCE_INLINE AllocatorI& SOLAIRE_DEFAULT_CALL GetAllocator() const throw() {
+			return mAllocator;
+		}
+
+		SOLAIRE_FORCE_INLINE const HashFunction<uint32_t>& SOLAIRE_DEFAULT_CALL GetHashFunction() const throw() {
+			return mHashFunction;
+		}
+	};
+}
+
+#endif
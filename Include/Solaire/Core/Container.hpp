@@ -28,19 +28,31 @@
 	\version 1.0
 	\date
 	Created			: 3rd December 2015
-	Last Modified	: 3rd December 2015
+	Last Modified	: 18th October 2026
 */
 
+#include <utility>
+#include <stdexcept>
 #include "Iterator.hpp"
 
 namespace Solaire {
 
 	class Allocator;
 
+	template<class T, class ITERATOR>
+	class ContainerConstIterator;
+
 	template<class T>
 	class ContainerIterator : public Iterator<T>{
+	public:
+		template<class T2, class ITERATOR>
+		friend class ContainerConstIterator;
+
+		typedef typename Iterator<T>::Type Type;
+		typedef typename Iterator<T>::Offset Offset;
 	private:
 		Iterator<T>* mIterator;
+		T* mPointer;
 		uint32_t mOffset;
 	protected:
 		//Inherited from Iterator
@@ -48,8 +60,16 @@ namespace Solaire {
 			return mOffset;
 		}
 	public:
-		ContainerIterator(Iterator<T>& aIterator, uint32_t aOffset = 0) :
+		/*!
+			\brief Create an iterator.
+			\param aIterator An iterator to the first element of the container.
+			\param aOffset The index of the element to point at.
+			\param aPointer The address of the first element if all of the elements are contiguous, otherwise nullptr.
+			If set, elements are accessed through this pointer instead of \a aIterator.
+		*/
+		ContainerIterator(Iterator<T>& aIterator, uint32_t aOffset = 0, T* const aPointer = nullptr) :
 			mIterator(&aIterator),
+			mPointer(aPointer),
 			mOffset(aOffset)
 		{}
 
@@ -59,38 +79,50 @@ namespace Solaire {
 
 		// Inherited from Iterator
 
-		Type* SOLAIRE_EXPORT_CALL operator->() throw() override{
+		Type* SOLAIRE_EXPORT_CALL operator->() throw() override final {
+			if(mPointer) return mPointer + mOffset;
 			mIterator->operator+=(mOffset);
 			Type* const tmp = mIterator->operator->();
 			mIterator->operator-=(mOffset);
 			return tmp;
 		}
 
-		Iterator<Type>& SOLAIRE_EXPORT_CALL operator++() throw() override {
+		Iterator<Type>& SOLAIRE_EXPORT_CALL operator++() throw() override final {
 			++mOffset;
 			return *this;
 		}
 
-		Iterator<Type>& SOLAIRE_EXPORT_CALL operator--() throw() override {
+		Iterator<Type>& SOLAIRE_EXPORT_CALL operator--() throw() override final {
 			--mOffset;
 			return *this;
 		}
 
-		Iterator<Type>& SOLAIRE_EXPORT_CALL operator+=(const Offset aOffset) throw() override {
+		Iterator<Type>& SOLAIRE_EXPORT_CALL operator+=(const Offset aOffset) throw() override final {
 			mOffset += aOffset;
 			return *this;
 		}
 
-		Iterator<Type>& SOLAIRE_EXPORT_CALL operator-=(const Offset aOffset) throw() override {
+		Iterator<Type>& SOLAIRE_EXPORT_CALL operator-=(const Offset aOffset) throw() override final {
 			mOffset -= aOffset;
 			return *this;
 		}
+
+		SOLAIRE_FORCE_INLINE Type& SOLAIRE_DEFAULT_CALL operator*() throw() {
+			return *operator->();
+		}
 	};
 
 	template<class T>
 	class ContainerReverseIterator : public Iterator<T>{
+	public:
+		template<class T2, class ITERATOR>
+		friend class ContainerConstIterator;
+
+		typedef typename Iterator<T>::Type Type;
+		typedef typename Iterator<T>::Offset Offset;
 	private:
 		Iterator<T>* mIterator;
+		T* mPointer;
 		uint32_t mOffset;
 	protected:
 		//Inherited from Iterator
@@ -98,8 +130,16 @@ namespace Solaire {
 			return mOffset;
 		}
 	public:
-		ContainerReverseIterator(Iterator<T>& aIterator, uint32_t aOffset = 0) :
+		/*!
+			\brief Create an iterator.
+			\param aIterator An iterator to the first element of the container.
+			\param aOffset The index of the element to point at.
+			\param aPointer The address of the first element if all of the elements are contiguous, otherwise nullptr.
+			If set, elements are accessed through this pointer instead of \a aIterator.
+		*/
+		ContainerReverseIterator(Iterator<T>& aIterator, uint32_t aOffset = 0, T* const aPointer = nullptr) :
 			mIterator(&aIterator),
+			mPointer(aPointer),
 			mOffset(aOffset)
 		{}
 
@@ -109,36 +149,44 @@ namespace Solaire {
 
 		// Inherited from Iterator
 
-		Type* SOLAIRE_EXPORT_CALL operator->() throw() override{
+		Type* SOLAIRE_EXPORT_CALL operator->() throw() override final {
+			if(mPointer) return mPointer + mOffset;
 			mIterator->operator+=(mOffset);
 			Type* const tmp = mIterator->operator->();
 			mIterator->operator-=(mOffset);
 			return tmp;
 		}
 
-		Iterator<Type>& SOLAIRE_EXPORT_CALL operator++() throw() override {
+		Iterator<Type>& SOLAIRE_EXPORT_CALL operator++() throw() override final {
 			--mOffset;
 			return *this;
 		}
 
-		Iterator<Type>& SOLAIRE_EXPORT_CALL operator--() throw() override {
+		Iterator<Type>& SOLAIRE_EXPORT_CALL operator--() throw() override final {
 			++mOffset;
 			return *this;
 		}
 
-		Iterator<Type>& SOLAIRE_EXPORT_CALL operator+=(const Offset aOffset) throw() override {
+		Iterator<Type>& SOLAIRE_EXPORT_CALL operator+=(const Offset aOffset) throw() override final {
 			mOffset -= aOffset;
 			return *this;
 		}
 
-		Iterator<Type>& SOLAIRE_EXPORT_CALL operator-=(const Offset aOffset) throw() override {
+		Iterator<Type>& SOLAIRE_EXPORT_CALL operator-=(const Offset aOffset) throw() override final {
 			mOffset += aOffset;
 			return *this;
 		}
+
+		SOLAIRE_FORCE_INLINE Type& SOLAIRE_DEFAULT_CALL operator*() throw() {
+			return *operator->();
+		}
 	};
 
 	template<class T, class ITERATOR>
 	class ContainerConstIterator : public Iterator<const T>{
+	public:
+		typedef typename Iterator<const T>::Type Type;
+		typedef typename Iterator<const T>::Offset Offset;
 	private:
 		ITERATOR mIterator;
 	protected:
@@ -147,8 +195,12 @@ namespace Solaire {
 			return mIterator.GetOffset();
 		}
 	public:
-		ContainerConstIterator(Iterator<T>& aIterator, const Offset aOffset = 0) :
-			ITERATOR(aIterator, aOffset)
+		ContainerConstIterator(Iterator<T>& aIterator, const Offset aOffset = 0, T* const aPointer = nullptr) :
+			mIterator(aIterator, aOffset, aPointer)
+		{}
+
+		ContainerConstIterator(const ITERATOR& aIterator) :
+			mIterator(aIterator)
 		{}
 
 		SOLAIRE_EXPORT_CALL ~ContainerConstIterator() {
@@ -157,29 +209,33 @@ namespace Solaire {
 
 		// Inherited from Iterator
 
-		Type* SOLAIRE_EXPORT_CALL operator->() throw() override {
+		Type* SOLAIRE_EXPORT_CALL operator->() throw() override final {
 			return mIterator.operator->();
 		}
 
-		Iterator<Type>& SOLAIRE_EXPORT_CALL operator++() throw() override {
+		Iterator<Type>& SOLAIRE_EXPORT_CALL operator++() throw() override final {
 			++mIterator;
 			return *this;
 		}
 
-		Iterator<Type>& SOLAIRE_EXPORT_CALL operator--() throw() override {
+		Iterator<Type>& SOLAIRE_EXPORT_CALL operator--() throw() override final {
 			--mIterator;
 			return *this;
 		}
 
-		Iterator<Type>& SOLAIRE_EXPORT_CALL operator+=(const Offset aOffset) throw() override {
+		Iterator<Type>& SOLAIRE_EXPORT_CALL operator+=(const Offset aOffset) throw() override final {
 			mIterator += aOffset;
 			return *this;
 		}
 
-		Iterator<Type>& SOLAIRE_EXPORT_CALL operator-=(const Offset aOffset) throw() override {
+		Iterator<Type>& SOLAIRE_EXPORT_CALL operator-=(const Offset aOffset) throw() override final {
 			mIterator -= aOffset;
 			return *this;
 		}
+
+		SOLAIRE_FORCE_INLINE Type& SOLAIRE_DEFAULT_CALL operator*() throw() {
+			return *operator->();
+		}
 	};
 
 	template<class T>
@@ -190,6 +246,14 @@ namespace Solaire {
 		typedef ContainerConstIterator<Type, Iterator> ConstIterator;
 		typedef ContainerReverseIterator<Type> ReverseIterator;
 		typedef ContainerConstIterator<Type, ReverseIterator> ConstReverseIterator;
+	private:
+		T* SOLAIRE_DEFAULT_CALL GetIteratorPtr() {
+			const uint32_t size = Size();
+			if(size == 0) return nullptr;
+			uint32_t length;
+			T* const chunk = GetChunk(0, length);
+			return length == size ? chunk : nullptr;
+		}
 	public:
 		virtual uint32_t SOLAIRE_EXPORT_CALL Size() const = 0;
 		virtual Type& SOLAIRE_EXPORT_CALL operator[](const uint32_t) = 0;
@@ -197,8 +261,69 @@ namespace Solaire {
 		virtual Allocator& SOLAIRE_EXPORT_CALL GetAllocator() const = 0;
 		virtual bool SOLAIRE_EXPORT_CALL Reserve(const uint32_t) = 0;
 		virtual Solaire::Iterator<T>& SOLAIRE_EXPORT_CALL GetBeginIterator() = 0;
+
+		/*!
+			\brief Get the run of contiguous elements that starts at an index.
+			\param aIndex The index of the first element in the run, must be less than Size().
+			\param aLength Set to the number of elements in the run, at least 1.
+			\return The address of the element at \a aIndex.
+			\see ForEachChunk
+		*/
+		virtual Type* SOLAIRE_EXPORT_CALL GetChunk(const uint32_t aIndex, uint32_t& aLength) = 0;
+
 		virtual SOLAIRE_EXPORT_CALL ~FixedContainer(){}
 
+		/*!
+			\brief Call a function on each contiguous run of elements, in order.
+			\detail
+			A contiguous container passes all of its elements in a single call, a segmented container passes one call per segment.
+			This takes one virtual call per run rather than several per element.
+			\param aFunction A function with the signature void(T* aChunk, uint32_t aLength).
+			\see GetChunk
+		*/
+		template<class F>
+		void SOLAIRE_DEFAULT_CALL ForEachChunk(F aFunction) {
+			const uint32_t size = Size();
+			uint32_t i = 0;
+			while(i < size) {
+				uint32_t length;
+				T* const chunk = GetChunk(i, length);
+				aFunction(chunk, length);
+				i += length;
+			}
+		}
+
+		template<class F>
+		void SOLAIRE_DEFAULT_CALL ForEachChunk(F aFunction) const {
+			const uint32_t size = Size();
+			uint32_t i = 0;
+			while(i < size) {
+				uint32_t length;
+				const T* const chunk = const_cast<FixedContainer<T>*>(this)->GetChunk(i, length);
+				aFunction(chunk, length);
+				i += length;
+			}
+		}
+
+		/*!
+			\brief Call a function on each element, in order.
+			\param aFunction A function with the signature void(T& aElement).
+			\see ForEachChunk
+		*/
+		template<class F>
+		void SOLAIRE_DEFAULT_CALL ForEach(F aFunction) {
+			ForEachChunk([&aFunction](T* const aChunk, const uint32_t aLength) {
+				for(uint32_t i = 0; i < aLength; ++i) aFunction(aChunk[i]);
+			});
+		}
+
+		template<class F>
+		void SOLAIRE_DEFAULT_CALL ForEach(F aFunction) const {
+			ForEachChunk([&aFunction](const T* const aChunk, const uint32_t aLength) {
+				for(uint32_t i = 0; i < aLength; ++i) aFunction(aChunk[i]);
+			});
+		}
+
 		SOLAIRE_FORCE_INLINE const Type& SOLAIRE_DEFAULT_CALL operator[](const uint32_t aIndex) const {
 			return const_cast<FixedContainer<T>*>(this)->operator[](aIndex);
 		}
@@ -212,78 +337,141 @@ namespace Solaire {
 		}
 
 		SOLAIRE_FORCE_INLINE Iterator SOLAIRE_DEFAULT_CALL begin() {
-			return Iterator(GetBeginIterator(), 0);
+			return Iterator(GetBeginIterator(), 0, GetIteratorPtr());
 		}
 
 		SOLAIRE_FORCE_INLINE Iterator SOLAIRE_DEFAULT_CALL end() {
-			return Iterator(GetBeginIterator(), Size());
+			return Iterator(GetBeginIterator(), Size(), GetIteratorPtr());
 		}
 
 		SOLAIRE_FORCE_INLINE ConstIterator SOLAIRE_DEFAULT_CALL begin() const {
-			return ContainerConstIterator<T>(const_cast<FixedContainer<T>*>(this)->GetBeginIterator(), 0);
+			FixedContainer<T>* const self = const_cast<FixedContainer<T>*>(this);
+			return ConstIterator(self->GetBeginIterator(), 0, self->GetIteratorPtr());
 		}
 
 		SOLAIRE_FORCE_INLINE ConstIterator SOLAIRE_DEFAULT_CALL end() const {
-			return ContainerConstIterator<T>(const_cast<FixedContainer<T>*>(this)->GetBeginIterator(), Size());
+			FixedContainer<T>* const self = const_cast<FixedContainer<T>*>(this);
+			return ConstIterator(self->GetBeginIterator(), Size(), self->GetIteratorPtr());
 		}
 
 		SOLAIRE_FORCE_INLINE ReverseIterator SOLAIRE_DEFAULT_CALL rbegin() {
-			return ReverseIterator(GetBeginIterator(), Size() - 1);
+			return ReverseIterator(GetBeginIterator(), Size() - 1, GetIteratorPtr());
 		}
 
 		SOLAIRE_FORCE_INLINE ReverseIterator SOLAIRE_DEFAULT_CALL rend() {
-			return ReverseIterator(GetBeginIterator(), -1);
+			return ReverseIterator(GetBeginIterator(), -1, GetIteratorPtr());
 		}
 
 		SOLAIRE_FORCE_INLINE ConstReverseIterator SOLAIRE_DEFAULT_CALL rbegin() const {
-			return ReverseIterator(const_cast<FixedContainer<T>*>(this)->GetBeginIterator(), Size() - 1);
+			FixedContainer<T>* const self = const_cast<FixedContainer<T>*>(this);
+			return ConstReverseIterator(self->GetBeginIterator(), Size() - 1, self->GetIteratorPtr());
 		}
 
 		SOLAIRE_FORCE_INLINE ConstReverseIterator SOLAIRE_DEFAULT_CALL rend() const {
-			return ReverseIterator(const_cast<FixedContainer<T>*>(this)->GetBeginIterator(), -1);
+			FixedContainer<T>* const self = const_cast<FixedContainer<T>*>(this);
+			return ConstReverseIterator(self->GetBeginIterator(), -1, self->GetIteratorPtr());
 		}
 	};
 
 	template<class T>
 	SOLAIRE_EXPORT_INTERFACE Stack : public FixedContainer<T> {
+	public:
+		typedef typename FixedContainer<T>::Type Type;
 	public:
 		virtual Type& SOLAIRE_EXPORT_CALL PushBack(const Type&) = 0;
+		virtual Type& SOLAIRE_EXPORT_CALL PushBack(Type&&) = 0;
 		virtual Type SOLAIRE_EXPORT_CALL PopBack() = 0;
 		virtual Stack<T>& SOLAIRE_EXPORT_CALL operator=(const FixedContainer<T>&) = 0;
 		virtual void SOLAIRE_EXPORT_CALL Clear() = 0;
+
+		/*!
+			\brief Copy an array of elements onto the back of the stack.
+			\param aValues The address of the first element to copy.
+			\param aCount The number of elements to copy.
+		*/
+		virtual void SOLAIRE_EXPORT_CALL PushBackRange(const Type* const aValues, const uint32_t aCount) = 0;
+
 		virtual  SOLAIRE_EXPORT_CALL ~Stack(){}
 
+		/*!
+			\brief Construct a new element at the back of the stack.
+			\detail Implementations hide this with a version that constructs the element in place.
+			\tparam PARAMS The parameter types to pass to the element's constructor.
+			\param aParams The parameters to pass to the element's constructor.
+			\return The new element.
+		*/
+		template<class ...PARAMS>
+		SOLAIRE_FORCE_INLINE T& SOLAIRE_DEFAULT_CALL EmplaceBack(PARAMS&&... aParams) {
+			return PushBack(Type(std::forward<PARAMS>(aParams)...));
+		}
+
+		/*!
+			\brief Copy the elements of another container onto the back of the stack.
+			\detail Memory is reserved once, then each contiguous run of \a aOther is copied with a single call.
+			\param aOther The container to copy from.
+			\see PushBackRange(const Type* const, const uint32_t)
+		*/
+		void SOLAIRE_DEFAULT_CALL PushBackRange(const FixedContainer<T>& aOther) {
+			const uint32_t size = this->Size();
+			SolaireRuntimeAssert(this->Reserve(size + aOther.Size()), "SolaireCPP : Stack failed to allocate memory");
+			if(&aOther == this) {
+				// The runs of this container change as elements are added
+				for(uint32_t i = 0; i < size; ++i) {
+					PushBack(static_cast<const Type&>(this->operator[](i)));
+				}
+			}else {
+				aOther.ForEachChunk([this](const T* const aChunk, const uint32_t aLength) {
+					PushBackRange(aChunk, aLength);
+				});
+			}
+		}
+
 		SOLAIRE_FORCE_INLINE T& SOLAIRE_DEFAULT_CALL Back() {
-			return operator[](Size() - 1);
+			return this->operator[](this->Size() - 1);
 		}
 
 		SOLAIRE_FORCE_INLINE const T& SOLAIRE_DEFAULT_CALL Back() const {
-			return operator[](Size() - 1);
+			return this->operator[](this->Size() - 1);
 		}
 	};
 
 	template<class T>
 	SOLAIRE_EXPORT_INTERFACE DoubleEndedStack : public Stack<T> {
+	public:
+		typedef typename Stack<T>::Type Type;
 	public:
 		virtual Type& SOLAIRE_EXPORT_CALL PushFront(const Type&) = 0;
+		virtual Type& SOLAIRE_EXPORT_CALL PushFront(Type&&) = 0;
 		virtual Type SOLAIRE_EXPORT_CALL PopFront() = 0;
 		virtual SOLAIRE_EXPORT_CALL ~DoubleEndedStack(){}
 
 		SOLAIRE_FORCE_INLINE T& SOLAIRE_DEFAULT_CALL Front() {
-			return operator[](0);
+			return this->operator[](0);
 		}
 
 		SOLAIRE_FORCE_INLINE const T& SOLAIRE_DEFAULT_CALL Front() const {
-			return operator[](0);
+			return this->operator[](0);
 		}
 	};
 
 	template<class T>
 	SOLAIRE_EXPORT_INTERFACE List : public DoubleEndedStack<T> {
+	public:
+		typedef typename DoubleEndedStack<T>::Type Type;
+		typedef typename DoubleEndedStack<T>::ConstIterator ConstIterator;
 	public:
 		virtual Type& SOLAIRE_EXPORT_CALL InsertBefore(const ConstIterator, const Type&) = 0;
 		virtual Type& SOLAIRE_EXPORT_CALL InsertAfter(const ConstIterator, const Type&) = 0;
 		virtual bool SOLAIRE_EXPORT_CALL Erase(const ConstIterator) = 0;
+
+		/*!
+			\brief Copy an array of elements into the list.
+			\param aPosition The new elements are inserted before this position.
+			\param aValues The address of the first element to copy.
+			\param aCount The number of elements to copy.
+		*/
+		virtual void SOLAIRE_EXPORT_CALL InsertRange(const ConstIterator aPosition, const Type* const aValues, const uint32_t aCount) = 0;
+
 		virtual SOLAIRE_EXPORT_CALL ~List(){}
 	};
 
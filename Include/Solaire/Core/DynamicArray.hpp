@@ -0,0 +1,467 @@
+#ifndef SOLAIRE_DYNAMIC_ARRAY_HPP
+#define SOLAIRE_DYNAMIC_ARRAY_HPP
+
+//Copyright 2015 Adam Smith
+//
+//Licensed under the Apache License, Version 2.0 (the "License");
+//you may not use this file except in compliance with the License.
+//You may obtain a copy of the License at
+//
+//    http://www.apache.org/licenses/LICENSE-2.0
+//
+//Unless required by applicable law or agreed to in writing, software
+//distributed under the License is distributed on an "AS IS" BASIS,
+//WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//See the License for the specific language governing permissions and
+//limitations under the License.
+
+// Contact :
+// Email             : solairelibrary@mail.com
+// GitHub repository : https://github.com/SolaireLibrary/SolaireCPP
+
+/*!
+	\file DynamicArray.hpp
+	\brief
+	\author
+	Created			: Adam Smith
+	Last modified	: Adam Smith
+	\version 1.0
+	\date
+	Created			: 18th October 2026
+	Last Modified	: 18th October 2026
+*/
+
+#include <new>
+#include <cstring>
+#include <utility>
+#include <stdexcept>
+#include <type_traits>
+#include "Allocator.hpp"
+#include "Container.hpp"
+
+namespace Solaire {
+
+	/*!
+		\class DynamicArray
+		\brief A List that stores its elements in a single contiguous block of memory.
+		\detail
+		Memory is allocated from an Allocator, when the array is full its capacity grows by half (with a minimum of MIN_CAPACITY).
+		Trivially copyable elements are relocated with memcpy, all other elements are move constructed.
+		\tparam T The type of element stored in the array.
+		\author Adam Smith
+		\date Created : 18th October 2026
+		\date Modified : 18th October 2026
+		\version 1.0
+	*/
+	template<class T>
+	class DynamicArray : public List<T> {
+	public:
+		typedef typename List<T>::Type Type;
+		typedef typename List<T>::ConstIterator ConstIterator;
+
+		enum : uint32_t {
+			MIN_CAPACITY = 4
+		};
+	private:
+		Allocator* mAllocator;
+		T* const mInlineData;
+		T* mData;
+		uint32_t mSize;
+		uint32_t mCapacity;
+		const uint32_t mInlineCapacity;
+		IteratorPtr<T> mBeginIterator;
+	private:
+		static SOLAIRE_FORCE_INLINE uint32_t SOLAIRE_DEFAULT_CALL GrowCapacity(const uint32_t aCapacity, const uint32_t aRequired) throw() {
+			return Max<uint32_t>(aRequired, Max<uint32_t>(aCapacity + (aCapacity >> 1), MIN_CAPACITY));
+		}
+
+		static void SOLAIRE_DEFAULT_CALL MoveElements(T* const aSrc, T* const aDst, const uint32_t aCount) throw() {
+			if(std::is_trivially_copyable<T>::value) {
+				if(aCount > 0) std::memcpy(static_cast<void*>(aDst), aSrc, sizeof(T) * aCount);
+			}else {
+				for(uint32_t i = 0; i < aCount; ++i) {
+					new(aDst + i) T(std::move(aSrc[i]));
+					aSrc[i].~T();
+				}
+			}
+		}
+
+		static void SOLAIRE_DEFAULT_CALL CopyElements(const T* const aSrc, T* const aDst, const uint32_t aCount) {
+			if(std::is_trivially_copyable<T>::value) {
+				if(aCount > 0) std::memcpy(static_cast<void*>(aDst), aSrc, sizeof(T) * aCount);
+			}else {
+				for(uint32_t i = 0; i < aCount; ++i) {
+					new(aDst + i) T(aSrc[i]);
+				}
+			}
+		}
+
+		T* SOLAIRE_DEFAULT_CALL AllocateData(const uint32_t aCapacity) {
+			T* const data = static_cast<T*>(mAllocator->Allocate(sizeof(T) * aCapacity));
+			SolaireRuntimeAssert(data != nullptr, "SolaireCPP : DynamicArray failed to allocate memory");
+			return data;
+		}
+
+		void SOLAIRE_DEFAULT_CALL ReplaceData(T* const aData, const uint32_t aCapacity) throw() {
+			if(mData != nullptr && mData != mInlineData) mAllocator->Deallocate(mData);
+			mData = aData;
+			mCapacity = aCapacity;
+		}
+
+		void SOLAIRE_DEFAULT_CALL ResetData() throw() {
+			ReplaceData(mInlineData, mInlineCapacity);
+		}
+
+		uint32_t SOLAIRE_DEFAULT_CALL GetIndex(const ConstIterator aPosition) {
+			return static_cast<uint32_t>(aPosition - this->begin());
+		}
+
+		template<class ...PARAMS>
+		T& SOLAIRE_DEFAULT_CALL EmplaceAt(const uint32_t aIndex, PARAMS&&... aParams) {
+			SolaireRuntimeAssert(aIndex <= mSize, "SolaireCPP : DynamicArray insert position is out of bounds");
+			if(aIndex == mSize) return EmplaceBack(std::forward<PARAMS>(aParams)...);
+
+			if(mSize == mCapacity) {
+				// Construct the new element first in case a parameter references an existing element
+				const uint32_t capacity = GrowCapacity(mCapacity, mSize + 1);
+				T* const data = AllocateData(capacity);
+				new(data + aIndex) T(std::forward<PARAMS>(aParams)...);
+				MoveElements(mData, data, aIndex);
+				MoveElements(mData + aIndex, data + aIndex + 1, mSize - aIndex);
+				ReplaceData(data, capacity);
+			}else {
+				T tmp(std::forward<PARAMS>(aParams)...);
+				new(mData + mSize) T(std::move(mData[mSize - 1]));
+				for(uint32_t i = mSize - 1; i > aIndex; --i) {
+					mData[i] = std::move(mData[i - 1]);
+				}
+				mData[aIndex] = std::move(tmp);
+			}
+
+			++mSize;
+			return mData[aIndex];
+		}
+
+		void SOLAIRE_DEFAULT_CALL InsertRangeAt(const uint32_t aIndex, const T* const aValues, const uint32_t aCount) {
+			SolaireRuntimeAssert(aIndex <= mSize, "SolaireCPP : DynamicArray insert position is out of bounds");
+			if(aCount == 0) return;
+			const uint32_t size = mSize + aCount;
+
+			if(size > mCapacity) {
+				// Copy the new elements first in case they are elements of this array
+				const uint32_t capacity = GrowCapacity(mCapacity, size);
+				T* const data = AllocateData(capacity);
+				CopyElements(aValues, data + aIndex, aCount);
+				MoveElements(mData, data, aIndex);
+				MoveElements(mData + aIndex, data + aIndex + aCount, mSize - aIndex);
+				ReplaceData(data, capacity);
+			}else if(aIndex < mSize && aValues < mData + mSize && aValues + aCount > mData) {
+				// The new elements would be moved while they are being copied
+				DynamicArray<T> tmp(*mAllocator);
+				tmp.InsertRangeAt(0, aValues, aCount);
+				InsertRangeAt(aIndex, tmp.mData, aCount);
+				return;
+			}else if(std::is_trivially_copyable<T>::value) {
+				std::memmove(static_cast<void*>(mData + aIndex + aCount), mData + aIndex, sizeof(T) * (mSize - aIndex));
+				std::memcpy(static_cast<void*>(mData + aIndex), aValues, sizeof(T) * aCount);
+			}else {
+				// Elements moved past the old size are constructed, the others are assigned
+				for(uint32_t i = mSize; i > aIndex; --i) {
+					const uint32_t dst = i - 1 + aCount;
+					if(dst >= mSize) {
+						new(mData + dst) T(std::move(mData[i - 1]));
+					}else {
+						mData[dst] = std::move(mData[i - 1]);
+					}
+				}
+				for(uint32_t i = 0; i < aCount; ++i) {
+					const uint32_t dst = aIndex + i;
+					if(dst >= mSize) {
+						new(mData + dst) T(aValues[i]);
+					}else {
+						mData[dst] = aValues[i];
+					}
+				}
+			}
+
+			mSize = size;
+		}
+
+		T SOLAIRE_DEFAULT_CALL RemoveAt(const uint32_t aIndex) {
+			T tmp(std::move(mData[aIndex]));
+			--mSize;
+			for(uint32_t i = aIndex; i < mSize; ++i) {
+				mData[i] = std::move(mData[i + 1]);
+			}
+			mData[mSize].~T();
+			return tmp;
+		}
+	protected:
+		/*!
+			\brief Create an array that stores its first elements in a buffer owned by the caller.
+			\detail The allocator is only used once the array grows past \a aCapacity elements.
+			\param aAllocator The allocator to use when the buffer is full.
+			\param aBuffer Uninitialised memory for \a aCapacity elements, it must outlive the array.
+			\param aCapacity The number of elements that fit into \a aBuffer.
+		*/
+		DynamicArray(Allocator& aAllocator, T* const aBuffer, const uint32_t aCapacity) throw() :
+			mAllocator(&aAllocator),
+			mInlineData(aBuffer),
+			mData(aBuffer),
+			mSize(0),
+			mCapacity(aCapacity),
+			mInlineCapacity(aCapacity)
+		{}
+
+		SOLAIRE_FORCE_INLINE bool SOLAIRE_DEFAULT_CALL IsInline() const throw() {
+			return mData == mInlineData;
+		}
+	public:
+		DynamicArray(Allocator& aAllocator) throw() :
+			mAllocator(&aAllocator),
+			mInlineData(nullptr),
+			mData(nullptr),
+			mSize(0),
+			mCapacity(0),
+			mInlineCapacity(0)
+		{}
+
+		DynamicArray(Allocator& aAllocator, const uint32_t aCapacity) :
+			mAllocator(&aAllocator),
+			mInlineData(nullptr),
+			mData(nullptr),
+			mSize(0),
+			mCapacity(0),
+			mInlineCapacity(0)
+		{
+			Reserve(aCapacity);
+		}
+
+		DynamicArray(const DynamicArray<T>& aOther) :
+			mAllocator(aOther.mAllocator),
+			mInlineData(nullptr),
+			mData(nullptr),
+			mSize(0),
+			mCapacity(0),
+			mInlineCapacity(0)
+		{
+			operator=(static_cast<const FixedContainer<T>&>(aOther));
+		}
+
+		DynamicArray(DynamicArray<T>&& aOther) :
+			mAllocator(aOther.mAllocator),
+			mInlineData(nullptr),
+			mData(nullptr),
+			mSize(0),
+			mCapacity(0),
+			mInlineCapacity(0)
+		{
+			operator=(std::move(aOther));
+		}
+
+		SOLAIRE_EXPORT_CALL ~DynamicArray() {
+			Clear();
+			ResetData();
+		}
+
+		DynamicArray<T>& SOLAIRE_DEFAULT_CALL operator=(const DynamicArray<T>& aOther) {
+			operator=(static_cast<const FixedContainer<T>&>(aOther));
+			return *this;
+		}
+
+		DynamicArray<T>& SOLAIRE_DEFAULT_CALL operator=(DynamicArray<T>&& aOther) {
+			if(&aOther == this) return *this;
+			Clear();
+
+			if(aOther.IsInline()) {
+				// Elements in a caller owned buffer cannot change owner, so they are moved individually
+				SolaireRuntimeAssert(Reserve(aOther.mSize), "SolaireCPP : DynamicArray failed to allocate memory");
+				for(uint32_t i = 0; i < aOther.mSize; ++i) {
+					new(mData + i) T(std::move(aOther.mData[i]));
+				}
+				mSize = aOther.mSize;
+				aOther.Clear();
+			}else {
+				ResetData();
+				mAllocator = aOther.mAllocator;
+				mData = aOther.mData;
+				mSize = aOther.mSize;
+				mCapacity = aOther.mCapacity;
+				aOther.mData = nullptr;
+				aOther.mSize = 0;
+				aOther.ResetData();
+			}
+
+			return *this;
+		}
+
+		/*!
+			\brief Construct a new element at the back of the array.
+			\tparam PARAMS The parameter types to pass to the element's constructor.
+			\param aParams The parameters to pass to the element's constructor.
+			\return The new element.
+		*/
+		template<class ...PARAMS>
+		T& SOLAIRE_DEFAULT_CALL EmplaceBack(PARAMS&&... aParams) {
+			if(mSize == mCapacity) {
+				// Construct the new element first in case a parameter references an existing element
+				const uint32_t capacity = GrowCapacity(mCapacity, mSize + 1);
+				T* const data = AllocateData(capacity);
+				new(data + mSize) T(std::forward<PARAMS>(aParams)...);
+				MoveElements(mData, data, mSize);
+				ReplaceData(data, capacity);
+			}else {
+				new(mData + mSize) T(std::forward<PARAMS>(aParams)...);
+			}
+			return mData[mSize++];
+		}
+
+		using List<T>::PushBackRange;
+
+		SOLAIRE_FORCE_INLINE const T& SOLAIRE_DEFAULT_CALL operator[](const uint32_t aIndex) const throw() {
+			return mData[aIndex];
+		}
+
+		SOLAIRE_FORCE_INLINE uint32_t SOLAIRE_DEFAULT_CALL GetCapacity() const throw() {
+			return mCapacity;
+		}
+
+		/*!
+			\brief Reduce the capacity of the array to its size.
+			\detail If the elements fit into the array's inline buffer they are moved back into it.
+			\return True if the memory was reallocated.
+		*/
+		bool SOLAIRE_DEFAULT_CALL ShrinkToFit() {
+			if(mSize == mCapacity || IsInline()) return false;
+			if(mSize <= mInlineCapacity) {
+				T* const data = mData;
+				mData = nullptr;
+				MoveElements(data, mInlineData, mSize);
+				mAllocator->Deallocate(data);
+				ResetData();
+				return true;
+			}
+			T* const data = static_cast<T*>(mAllocator->Allocate(sizeof(T) * mSize));
+			if(data == nullptr) return false;
+			MoveElements(mData, data, mSize);
+			ReplaceData(data, mSize);
+			return true;
+		}
+
+		// Inherited from FixedContainer
+
+		uint32_t SOLAIRE_EXPORT_CALL Size() const override {
+			return mSize;
+		}
+
+		Type& SOLAIRE_EXPORT_CALL operator[](const uint32_t aIndex) override {
+			return mData[aIndex];
+		}
+
+		bool SOLAIRE_EXPORT_CALL IsContiguous() const override {
+			return true;
+		}
+
+		Allocator& SOLAIRE_EXPORT_CALL GetAllocator() const override {
+			return *mAllocator;
+		}
+
+		bool SOLAIRE_EXPORT_CALL Reserve(const uint32_t aCapacity) override {
+			if(aCapacity <= mCapacity) return true;
+			T* const data = static_cast<T*>(mAllocator->Allocate(sizeof(T) * aCapacity));
+			if(data == nullptr) return false;
+			MoveElements(mData, data, mSize);
+			ReplaceData(data, aCapacity);
+			return true;
+		}
+
+		Solaire::Iterator<T>& SOLAIRE_EXPORT_CALL GetBeginIterator() override {
+			mBeginIterator = IteratorPtr<T>(mData);
+			return mBeginIterator;
+		}
+
+		Type* SOLAIRE_EXPORT_CALL GetChunk(const uint32_t aIndex, uint32_t& aLength) override {
+			aLength = mSize - aIndex;
+			return mData + aIndex;
+		}
+
+		// Inherited from Stack
+
+		Type& SOLAIRE_EXPORT_CALL PushBack(const Type& aValue) override {
+			return EmplaceBack(aValue);
+		}
+
+		Type& SOLAIRE_EXPORT_CALL PushBack(Type&& aValue) override {
+			return EmplaceBack(std::move(aValue));
+		}
+
+		void SOLAIRE_EXPORT_CALL PushBackRange(const Type* const aValues, const uint32_t aCount) override {
+			InsertRangeAt(mSize, aValues, aCount);
+		}
+
+		Type SOLAIRE_EXPORT_CALL PopBack() override {
+			SolaireRuntimeAssert(mSize > 0, "SolaireCPP : DynamicArray::PopBack called on an empty array");
+			--mSize;
+			T tmp(std::move(mData[mSize]));
+			mData[mSize].~T();
+			return tmp;
+		}
+
+		Stack<T>& SOLAIRE_EXPORT_CALL operator=(const FixedContainer<T>& aOther) override {
+			if(&aOther == this) return *this;
+			Clear();
+			PushBackRange(aOther);
+			return *this;
+		}
+
+		void SOLAIRE_EXPORT_CALL Clear() override {
+			if(! std::is_trivially_destructible<T>::value) {
+				for(uint32_t i = 0; i < mSize; ++i) {
+					mData[i].~T();
+				}
+			}
+			mSize = 0;
+		}
+
+		// Inherited from DoubleEndedStack
+
+		Type& SOLAIRE_EXPORT_CALL PushFront(const Type& aValue) override {
+			return EmplaceAt(0, aValue);
+		}
+
+		Type& SOLAIRE_EXPORT_CALL PushFront(Type&& aValue) override {
+			return EmplaceAt(0, std::move(aValue));
+		}
+
+		Type SOLAIRE_EXPORT_CALL PopFront() override {
+			SolaireRuntimeAssert(mSize > 0, "SolaireCPP : DynamicArray::PopFront called on an empty array");
+			return RemoveAt(0);
+		}
+
+		// Inherited from List
+
+		Type& SOLAIRE_EXPORT_CALL InsertBefore(const ConstIterator aPosition, const Type& aValue) override {
+			return EmplaceAt(GetIndex(aPosition), aValue);
+		}
+
+		Type& SOLAIRE_EXPORT_CALL InsertAfter(const ConstIterator aPosition, const Type& aValue) override {
+			const uint32_t index = GetIndex(aPosition);
+			SolaireRuntimeAssert(index < mSize, "SolaireCPP : DynamicArray::InsertAfter called with the end iterator");
+			return EmplaceAt(index + 1, aValue);
+		}
+
+		bool SOLAIRE_EXPORT_CALL Erase(const ConstIterator aPosition) override {
+			const uint32_t index = GetIndex(aPosition);
+			if(index >= mSize) return false;
+			RemoveAt(index);
+			return true;
+		}
+
+		void SOLAIRE_EXPORT_CALL InsertRange(const ConstIterator aPosition, const Type* const aValues, const uint32_t aCount) override {
+			InsertRangeAt(GetIndex(aPosition), aValues, aCount);
+		}
+	};
+
+}
+
+#endif
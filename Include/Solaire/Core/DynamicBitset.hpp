@@ -0,0 +1,520 @@
+#ifndef SOLAIRE_DYNAMIC_BITSET_HPP
+#define SOLAIRE_DYNAMIC_BITSET_HPP
+
+//Copyright 2015 Adam Smith
+//
+//Licensed under the Apache License, Version 2.0 (the "License");
+//you may not use this file except in compliance with the License.
+//You may obtain a copy of the License at
+//
+//    http://www.apache.org/licenses/LICENSE-2.0
+//
+//Unless required by applicable law or agreed to in writing, software
+//distributed under the License is distributed on an "AS IS" BASIS,
+//WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//See the License for the specific language governing permissions and
+//limitations under the License.
+
+// Contact :
+// Email             : solairelibrary@mail.com
+// GitHub repository : https://github.com/SolaireLibrary/SolaireCPP
+
+/*!
+	\file DynamicBitset.hpp
+	\brief
+	\author
+	Created			: Adam Smith
+	Last modified	: Adam Smith
+	\version 1.0
+	\date
+	Created			: 18th October 2026
+	Last Modified	: 18th October 2026
+*/
+
+#include <cstring>
+#include <stdexcept>
+#include "AllocatorI.hpp"
+#include "Iterator.hpp"
+#include "Maths.hpp"
+#include "..\Maths\PopCount.hpp"
+
+#ifdef __AVX2__
+	#include <immintrin.h>
+	#define SOLAIRE_DYNAMIC_BITSET_AVX2
+#endif
+
+namespace Solaire {
+
+	namespace Implementation {
+		enum : uint32_t {
+			BITSET_WORD_BITS = 64,
+			BITSET_WORD_SHIFT = 6,
+			BITSET_WORD_MASK = 63
+		};
+
+		enum BitsetOperation {
+			BITSET_OR,
+			BITSET_AND,
+			BITSET_XOR,
+			BITSET_AND_NOT
+		};
+
+		template<BitsetOperation OPERATION>
+		inline uint64_t SOLAIRE_DEFAULT_CALL BitsetApply(const uint64_t aFirst, const uint64_t aSecond) throw() {
+			return
+				OPERATION == BITSET_OR ? aFirst | aSecond :
+				OPERATION == BITSET_AND ? aFirst & aSecond :
+				OPERATION == BITSET_XOR ? aFirst ^ aSecond :
+				aFirst & ~aSecond;
+		}
+
+		#ifdef SOLAIRE_DYNAMIC_BITSET_AVX2
+			template<BitsetOperation OPERATION>
+			inline __m256i SOLAIRE_DEFAULT_CALL BitsetApply(const __m256i aFirst, const __m256i aSecond) throw() {
+				return
+					OPERATION == BITSET_OR ? _mm256_or_si256(aFirst, aSecond) :
+					OPERATION == BITSET_AND ? _mm256_and_si256(aFirst, aSecond) :
+					OPERATION == BITSET_XOR ? _mm256_xor_si256(aFirst, aSecond) :
+					_mm256_andnot_si256(aSecond, aFirst);
+			}
+		#endif
+
+		/*!
+			\brief Combine two arrays of words, with AVX2 4 words are combined at once.
+		*/
+		template<BitsetOperation OPERATION>
+		static void SOLAIRE_DEFAULT_CALL BitsetApply(uint64_t* const aDst, const uint64_t* const aSrc, const uint32_t aCount) throw() {
+			uint32_t i = 0;
+			#ifdef SOLAIRE_DYNAMIC_BITSET_AVX2
+				for(; i + 4 <= aCount; i += 4) {
+					const __m256i dst = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(aDst + i));
+					const __m256i src = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(aSrc + i));
+					_mm256_storeu_si256(reinterpret_cast<__m256i*>(aDst + i), BitsetApply<OPERATION>(dst, src));
+				}
+			#endif
+			for(; i < aCount; ++i) aDst[i] = BitsetApply<OPERATION>(aDst[i], aSrc[i]);
+		}
+	}
+
+	/*!
+		\class DynamicBitsetIterator
+		\brief Iterates over the indices of the set bits in a DynamicBitset, in ascending order.
+		\author Adam Smith
+		\date Created : 18th October 2026
+		\date Modified : 18th October 2026
+		\version 1.0
+	*/
+	template<class BITSET>
+	class DynamicBitsetIterator : public Iterator<const uint32_t> {
+	public:
+		typedef typename Iterator<const uint32_t>::Type Type;
+		typedef typename Iterator<const uint32_t>::Offset Offset;
+	private:
+		const BITSET* mBitset;
+		uint32_t mIndex;
+	protected:
+		//Inherited from Iterator
+		Offset SOLAIRE_EXPORT_CALL GetOffset() const throw() override {
+			return mIndex;
+		}
+	public:
+		DynamicBitsetIterator(const BITSET& aBitset, const uint32_t aIndex) :
+			mBitset(&aBitset),
+			mIndex(aIndex)
+		{}
+
+		SOLAIRE_EXPORT_CALL ~DynamicBitsetIterator() {
+
+		}
+
+		// Inherited from Iterator
+
+		Type* SOLAIRE_EXPORT_CALL operator->() throw() override final {
+			return &mIndex;
+		}
+
+		Iterator<Type>& SOLAIRE_EXPORT_CALL operator++() throw() override final {
+			mIndex = mBitset->FindNext(mIndex);
+			return *this;
+		}
+
+		Iterator<Type>& SOLAIRE_EXPORT_CALL operator--() throw() override final {
+			mIndex = mBitset->FindPrevious(mIndex);
+			return *this;
+		}
+
+		Iterator<Type>& SOLAIRE_EXPORT_CALL operator+=(const Offset aOffset) throw() override final {
+			for(Offset i = 0; i < aOffset; ++i) operator++();
+			return *this;
+		}
+
+		Iterator<Type>& SOLAIRE_EXPORT_CALL operator-=(const Offset aOffset) throw() override final {
+			for(Offset i = 0; i < aOffset; ++i) operator--();
+			return *this;
+		}
+
+		SOLAIRE_FORCE_INLINE Type& SOLAIRE_DEFAULT_CALL operator*() throw() {
+			return *operator->();
+		}
+	};
+
+	/*!
+		\class DynamicBitset
+		\brief A resizable array of bits packed into 64 bit words.
+		\detail
+		Bits past the end of the last word are always 0, so whole word operations never need to mask the last word.
+		Bulk operations between bitsets work on 4 words at once when AVX2 is available.
+		\author Adam Smith
+		\date Created : 18th October 2026
+		\date Modified : 18th October 2026
+		\version 1.0
+	*/
+	class DynamicBitset {
+	public:
+		typedef DynamicBitsetIterator<DynamicBitset> ConstIterator;
+
+		enum : uint32_t {
+			NOT_FOUND = UINT32_MAX
+		};
+	private:
+		enum : uint32_t {
+			WORD_BITS = Implementation::BITSET_WORD_BITS,
+			WORD_SHIFT = Implementation::BITSET_WORD_SHIFT,
+			WORD_MASK = Implementation::BITSET_WORD_MASK
+		};
+	private:
+		AllocatorI* mAllocator;
+		uint64_t* mWords;
+		uint32_t mSize;
+		uint32_t mCapacity;
+	private:
+		static SOLAIRE_FORCE_INLINE uint32_t SOLAIRE_DEFAULT_CALL WordCount(const uint32_t aBits) throw() {
+			return (aBits + WORD_MASK) >> WORD_SHIFT;
+		}
+
+		static SOLAIRE_FORCE_INLINE uint64_t SOLAIRE_DEFAULT_CALL BitMask(const uint32_t aIndex) throw() {
+			return 1ULL << (aIndex & WORD_MASK);
+		}
+
+		SOLAIRE_FORCE_INLINE void SOLAIRE_DEFAULT_CALL ClearUnusedBits() throw() {
+			const uint32_t used = mSize & WORD_MASK;
+			if(used != 0) mWords[mSize >> WORD_SHIFT] &= (1ULL << used) - 1;
+		}
+
+		template<Implementation::BitsetOperation OPERATION>
+		DynamicBitset& SOLAIRE_DEFAULT_CALL Apply(const DynamicBitset& aOther) {
+			SolaireRuntimeAssert(mSize == aOther.mSize, "SolaireCPP : DynamicBitset sizes do not match");
+			Implementation::BitsetApply<OPERATION>(mWords, aOther.mWords, WordCount(mSize));
+			return *this;
+		}
+
+		uint32_t SOLAIRE_DEFAULT_CALL FindFrom(uint32_t aWord, uint64_t aBits) const throw() {
+			const uint32_t words = WordCount(mSize);
+			while(aBits == 0) {
+				if(++aWord >= words) return NOT_FOUND;
+				aBits = mWords[aWord];
+			}
+			return (aWord << WORD_SHIFT) + CountTrailingZeros(aBits);
+		}
+	public:
+		/*!
+			\brief Create an empty bitset, no memory is allocated until bits are added.
+			\param aAllocator The allocator that the words will be allocated from.
+		*/
+		DynamicBitset(AllocatorI& aAllocator) throw() :
+			mAllocator(&aAllocator),
+			mWords(nullptr),
+			mSize(0),
+			mCapacity(0)
+		{}
+
+		/*!
+			\brief Create a bitset with every bit set to the same value.
+			\param aAllocator The allocator that the words will be allocated from.
+			\param aSize The number of bits.
+			\param aValue The value of each bit.
+		*/
+		DynamicBitset(AllocatorI& aAllocator, const uint32_t aSize, const bool aValue = false) :
+			mAllocator(&aAllocator),
+			mWords(nullptr),
+			mSize(0),
+			mCapacity(0)
+		{
+			Resize(aSize, aValue);
+		}
+
+		DynamicBitset(const DynamicBitset& aOther) :
+			mAllocator(aOther.mAllocator),
+			mWords(nullptr),
+			mSize(0),
+			mCapacity(0)
+		{
+			operator=(aOther);
+		}
+
+		DynamicBitset(DynamicBitset&& aOther) throw() :
+			mAllocator(aOther.mAllocator),
+			mWords(aOther.mWords),
+			mSize(aOther.mSize),
+			mCapacity(aOther.mCapacity)
+		{
+			aOther.mWords = nullptr;
+			aOther.mSize = 0;
+			aOther.mCapacity = 0;
+		}
+
+		~DynamicBitset() throw() {
+			if(mWords) mAllocator->Deallocate(mWords);
+		}
+
+		DynamicBitset& SOLAIRE_DEFAULT_CALL operator=(const DynamicBitset& aOther) {
+			if(&aOther == this) return *this;
+			ResetAll();
+			mSize = 0;
+			Reserve(aOther.mSize);
+			if(aOther.mSize > 0) std::memcpy(mWords, aOther.mWords, WordCount(aOther.mSize) * sizeof(uint64_t));
+			mSize = aOther.mSize;
+			return *this;
+		}
+
+		DynamicBitset& SOLAIRE_DEFAULT_CALL operator=(DynamicBitset&& aOther) throw() {
+			if(&aOther == this) return *this;
+			if(mWords) mAllocator->Deallocate(mWords);
+			mAllocator = aOther.mAllocator;
+			mWords = aOther.mWords;
+			mSize = aOther.mSize;
+			mCapacity = aOther.mCapacity;
+			aOther.mWords = nullptr;
+			aOther.mSize = 0;
+			aOther.mCapacity = 0;
+			return *this;
+		}
+
+		/*!
+			\brief Allocate enough words to hold \a aBits bits without reallocating.
+			\param aBits The number of bits to reserve space for.
+		*/
+		void SOLAIRE_DEFAULT_CALL Reserve(const uint32_t aBits) {
+			const uint32_t words = WordCount(aBits);
+			if(words <= mCapacity) return;
+
+			uint64_t* const data = static_cast<uint64_t*>(mAllocator->Allocate(words * sizeof(uint64_t)));
+			SolaireRuntimeAssert(data != nullptr, "SolaireCPP : DynamicBitset failed to allocate memory");
+
+			const uint32_t used = WordCount(mSize);
+			if(used > 0) std::memcpy(data, mWords, used * sizeof(uint64_t));
+			std::memset(data + used, 0, (words - used) * sizeof(uint64_t));
+
+			if(mWords) mAllocator->Deallocate(mWords);
+			mWords = data;
+			mCapacity = words;
+		}
+
+		/*!
+			\brief Change the number of bits.
+			\param aSize The new number of bits.
+			\param aValue The value of any bits that are added.
+		*/
+		void SOLAIRE_DEFAULT_CALL Resize(const uint32_t aSize, const bool aValue = false) {
+			if(aSize > mSize) {
+				if(WordCount(aSize) > mCapacity) Reserve(Max<uint32_t>(aSize, mCapacity * WORD_BITS * 2));
+				const uint32_t oldWords = WordCount(mSize);
+				const uint32_t newWords = WordCount(aSize);
+				if(aValue) {
+					if(mSize & WORD_MASK) mWords[oldWords - 1] |= ~0ULL << (mSize & WORD_MASK);
+					std::memset(mWords + oldWords, 0xFF, (newWords - oldWords) * sizeof(uint64_t));
+				}else {
+					std::memset(mWords + oldWords, 0, (newWords - oldWords) * sizeof(uint64_t));
+				}
+				mSize = aSize;
+				ClearUnusedBits();
+			}else if(aSize < mSize) {
+				const uint32_t newWords = WordCount(aSize);
+				std::memset(mWords + newWords, 0, (WordCount(mSize) - newWords) * sizeof(uint64_t));
+				mSize = aSize;
+				if(mSize > 0) ClearUnusedBits();
+			}
+		}
+
+		SOLAIRE_FORCE_INLINE void SOLAIRE_DEFAULT_CALL PushBack(const bool aValue) {
+			Resize(mSize + 1, aValue);
+		}
+
+		SOLAIRE_FORCE_INLINE bool SOLAIRE_DEFAULT_CALL Get(const uint32_t aIndex) const throw() {
+			return (mWords[aIndex >> WORD_SHIFT] & BitMask(aIndex)) != 0;
+		}
+
+		SOLAIRE_FORCE_INLINE bool SOLAIRE_DEFAULT_CALL operator[](const uint32_t aIndex) const throw() {
+			return Get(aIndex);
+		}
+
+		SOLAIRE_FORCE_INLINE void SOLAIRE_DEFAULT_CALL Set(const uint32_t aIndex) throw() {
+			mWords[aIndex >> WORD_SHIFT] |= BitMask(aIndex);
+		}
+
+		SOLAIRE_FORCE_INLINE void SOLAIRE_DEFAULT_CALL Set(const uint32_t aIndex, const bool aValue) throw() {
+			uint64_t& word = mWords[aIndex >> WORD_SHIFT];
+			word = (word & ~BitMask(aIndex)) | (static_cast<uint64_t>(aValue) << (aIndex & WORD_MASK));
+		}
+
+		SOLAIRE_FORCE_INLINE void SOLAIRE_DEFAULT_CALL Reset(const uint32_t aIndex) throw() {
+			mWords[aIndex >> WORD_SHIFT] &= ~BitMask(aIndex);
+		}
+
+		SOLAIRE_FORCE_INLINE void SOLAIRE_DEFAULT_CALL Flip(const uint32_t aIndex) throw() {
+			mWords[aIndex >> WORD_SHIFT] ^= BitMask(aIndex);
+		}
+
+		void SOLAIRE_DEFAULT_CALL SetAll() throw() {
+			if(mSize == 0) return;
+			std::memset(mWords, 0xFF, WordCount(mSize) * sizeof(uint64_t));
+			ClearUnusedBits();
+		}
+
+		void SOLAIRE_DEFAULT_CALL ResetAll() throw() {
+			if(mSize == 0) return;
+			std::memset(mWords, 0, WordCount(mSize) * sizeof(uint64_t));
+		}
+
+		void SOLAIRE_DEFAULT_CALL FlipAll() throw() {
+			if(mSize == 0) return;
+			const uint32_t words = WordCount(mSize);
+			for(uint32_t i = 0; i < words; ++i) mWords[i] = ~mWords[i];
+			ClearUnusedBits();
+		}
+
+		// Bulk operations, both bitsets must have the same size
+
+		SOLAIRE_FORCE_INLINE DynamicBitset& SOLAIRE_DEFAULT_CALL operator|=(const DynamicBitset& aOther) {
+			return Apply<Implementation::BITSET_OR>(aOther);
+		}
+
+		SOLAIRE_FORCE_INLINE DynamicBitset& SOLAIRE_DEFAULT_CALL operator&=(const DynamicBitset& aOther) {
+			return Apply<Implementation::BITSET_AND>(aOther);
+		}
+
+		SOLAIRE_FORCE_INLINE DynamicBitset& SOLAIRE_DEFAULT_CALL operator^=(const DynamicBitset& aOther) {
+			return Apply<Implementation::BITSET_XOR>(aOther);
+		}
+
+		/*!
+			\brief Clear every bit that is set in \a aOther.
+			\param aOther The bits to clear, must have the same size as this bitset.
+			\return This bitset.
+		*/
+		SOLAIRE_FORCE_INLINE DynamicBitset& SOLAIRE_DEFAULT_CALL AndNot(const DynamicBitset& aOther) {
+			return Apply<Implementation::BITSET_AND_NOT>(aOther);
+		}
+
+		bool SOLAIRE_DEFAULT_CALL operator==(const DynamicBitset& aOther) const throw() {
+			return mSize == aOther.mSize && (mSize == 0 || std::memcmp(mWords, aOther.mWords, WordCount(mSize) * sizeof(uint64_t)) == 0);
+		}
+
+		SOLAIRE_FORCE_INLINE bool SOLAIRE_DEFAULT_CALL operator!=(const DynamicBitset& aOther) const throw() {
+			return ! operator==(aOther);
+		}
+
+		/*!
+			\brief Count the set bits.
+			\return The number of set bits.
+			\see PopCountWords
+		*/
+		SOLAIRE_FORCE_INLINE uint32_t SOLAIRE_DEFAULT_CALL Count() const throw() {
+			return static_cast<uint32_t>(PopCountWords(mWords, WordCount(mSize)));
+		}
+
+		SOLAIRE_FORCE_INLINE bool SOLAIRE_DEFAULT_CALL Any() const throw() {
+			return FindFirst() != NOT_FOUND;
+		}
+
+		SOLAIRE_FORCE_INLINE bool SOLAIRE_DEFAULT_CALL None() const throw() {
+			return FindFirst() == NOT_FOUND;
+		}
+
+		SOLAIRE_FORCE_INLINE bool SOLAIRE_DEFAULT_CALL All() const throw() {
+			return Count() == mSize;
+		}
+
+		/*!
+			\brief Find the first set bit.
+			\return The index of the bit, or NOT_FOUND if no bits are set.
+		*/
+		SOLAIRE_FORCE_INLINE uint32_t SOLAIRE_DEFAULT_CALL FindFirst() const throw() {
+			return mSize == 0 ? static_cast<uint32_t>(NOT_FOUND) : FindFrom(0, mWords[0]);
+		}
+
+		/*!
+			\brief Find the first set bit after a given bit.
+			\param aIndex The index to search after.
+			\return The index of the bit, or NOT_FOUND if no later bits are set.
+		*/
+		uint32_t SOLAIRE_DEFAULT_CALL FindNext(const uint32_t aIndex) const throw() {
+			const uint32_t next = aIndex + 1;
+			if(next >= mSize) return NOT_FOUND;
+			const uint32_t word = next >> WORD_SHIFT;
+			return FindFrom(word, mWords[word] & (~0ULL << (next & WORD_MASK)));
+		}
+
+		/*!
+			\brief Find the last set bit before a given bit.
+			\param aIndex The index to search before, NOT_FOUND searches from the end of the bitset.
+			\return The index of the bit, or NOT_FOUND if no earlier bits are set.
+		*/
+		uint32_t SOLAIRE_DEFAULT_CALL FindPrevious(const uint32_t aIndex) const throw() {
+			const uint32_t end = Min<uint32_t>(aIndex, mSize);
+			if(end == 0) return NOT_FOUND;
+			const uint32_t previous = end - 1;
+			uint32_t word = previous >> WORD_SHIFT;
+			uint64_t bits = mWords[word] & (~0ULL >> (WORD_MASK - (previous & WORD_MASK)));
+			while(bits == 0) {
+				if(word == 0) return NOT_FOUND;
+				bits = mWords[--word];
+			}
+			return (word << WORD_SHIFT) + WORD_MASK - CountLeadingZeros(bits);
+		}
+
+		/*!
+			\brief Call a function with the index of each set bit, in ascending order.
+			\param aFunction A function with the signature void(uint32_t aIndex).
+		*/
+		template<class F>
+		void SOLAIRE_DEFAULT_CALL ForEachSetBit(F aFunction) const {
+			const uint32_t words = WordCount(mSize);
+			for(uint32_t i = 0; i < words; ++i) {
+				uint64_t bits = mWords[i];
+				while(bits) {
+					aFunction((i << WORD_SHIFT) + CountTrailingZeros(bits));
+					bits &= bits - 1;
+				}
+			}
+		}
+
+		SOLAIRE_FORCE_INLINE uint32_t SOLAIRE_DEFAULT_CALL Size() const throw() {
+			return mSize;
+		}
+
+		SOLAIRE_FORCE_INLINE uint32_t SOLAIRE_DEFAULT_CALL GetWordCount() const throw() {
+			return WordCount(mSize);
+		}
+
+		SOLAIRE_FORCE_INLINE const uint64_t* SOLAIRE_DEFAULT_CALL GetWords() const throw() {
+			return mWords;
+		}
+
+		SOLAIRE_FORCE_INLINE AllocatorI& SOLAIRE_DEFAULT_CALL GetAllocator() const throw() {
+			return *mAllocator;
+		}
+
+		// Iterates over the indices of the set bits
+
+		SOLAIRE_FORCE_INLINE ConstIterator SOLAIRE_DEFAULT_CALL begin() const throw() {
+			return ConstIterator(*this, FindFirst());
+		}
+
+		SOLAIRE_FORCE_INLINE ConstIterator SOLAIRE_DEFAULT_CALL end() const throw() {
+			return ConstIterator(*this, NOT_FOUND);
+		}
+	};
+}
+
+#endif
@@ -0,0 +1,654 @@
+#ifndef SOLAIRE_FLAT_MAP_HPP
+#define SOLAIRE_FLAT_MAP_HPP
+
+//Copyright 2015 Adam Smith
+//
+//Licensed under the Apache License, Version 2.0 (the "License");
+//you may not use this file except in compliance with the License.
+//You may obtain a copy of the License at
+//
+//    http://www.apache.org/licenses/LICENSE-2.0
+//
+//Unless required by applicable law or agreed to in writing, software
+//distributed under the License is distributed on an "AS IS" BASIS,
+//WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//See the License for the specific language governing permissions and
+//limitations under the License.
+
+// Contact :
+// Email             : solairelibrary@mail.com
+// GitHub repository : https://github.com/SolaireLibrary/SolaireCPP
+
+/*!
+	\file FlatMap.hpp
+	\brief
+	\author
+	Created			: Adam Smith
+	Last modified	: Adam Smith
+	\version 1.0
+	\date
+	Created			: 18th October 2026
+	Last Modified	: 18th October 2026
+*/
+
+#include <utility>
+#include "Init.hpp"
+#include "Maths.hpp"
+#include "Allocator.hpp"
+#include "Container.hpp"
+#include "DynamicArray.hpp"
+#include "Sort.hpp"
+
+namespace Solaire {
+
+	namespace Implementation {
+
+		/*!
+			\brief Searches the sorted keys of a flat container directly.
+		*/
+		template<class K, bool EYTZINGER>
+		class FlatIndex {
+		public:
+			FlatIndex(Allocator&) throw() {}
+
+			SOLAIRE_FORCE_INLINE void SOLAIRE_DEFAULT_CALL Build(const K* const, const uint32_t) throw() {}
+
+			SOLAIRE_FORCE_INLINE void SOLAIRE_DEFAULT_CALL Clear() throw() {}
+
+			// Index of the first key that is not less than aKey
+			static uint32_t SOLAIRE_DEFAULT_CALL LowerBound(const K* const aKeys, const uint32_t aCount, const K& aKey) throw() {
+				if(aCount == 0) return 0;
+
+				// Each step halves the range with arithmetic instead of a branch, so there are no mispredictions
+				const K* base = aKeys;
+				uint32_t count = aCount;
+				while(count > 1) {
+					const uint32_t half = count / 2;
+					base += static_cast<uint32_t>(base[half - 1] < aKey) * half;
+					count -= half;
+				}
+				return static_cast<uint32_t>(base - aKeys) + (*base < aKey ? 1 : 0);
+			}
+		};
+
+		/*!
+			\brief Keeps a copy of the keys of a flat container in Eytzinger order.
+			\detail
+			The keys are stored as an implicit binary search tree, node N has children 2N and 2N + 1. The first levels of the
+			search are then in the same few cache lines for every lookup, and each step reads the next level sequentially.
+			The index costs a copy of every key plus 4 bytes per key, and is rebuilt every time the container changes.
+		*/
+		template<class K>
+		class FlatIndex<K, true> {
+		private:
+			DynamicArray<K> mKeys;
+			DynamicArray<uint32_t> mRanks;
+		private:
+			uint32_t SOLAIRE_DEFAULT_CALL Fill(const K* const aSorted, uint32_t aIndex, const uint32_t aNode, const uint32_t aCount) {
+				if(aNode > aCount) return aIndex;
+				aIndex = Fill(aSorted, aIndex, aNode * 2, aCount);
+				mKeys[aNode] = aSorted[aIndex];
+				mRanks[aNode] = aIndex;
+				return Fill(aSorted, aIndex + 1, aNode * 2 + 1, aCount);
+			}
+		public:
+			FlatIndex(Allocator& aAllocator) :
+				mKeys(aAllocator),
+				mRanks(aAllocator)
+			{}
+
+			void SOLAIRE_DEFAULT_CALL Build(const K* const aSorted, const uint32_t aCount) {
+				mKeys.Clear();
+				mRanks.Clear();
+				if(aCount == 0) return;
+
+				// Node 0 is unused so that the children of node N are 2N and 2N + 1
+				mKeys.Reserve(aCount + 1);
+				mRanks.Reserve(aCount + 1);
+				for(uint32_t i = 0; i <= aCount; ++i) {
+					mKeys.PushBack(aSorted[0]);
+					mRanks.PushBack(0);
+				}
+				Fill(aSorted, 0, 1, aCount);
+			}
+
+			SOLAIRE_FORCE_INLINE void SOLAIRE_DEFAULT_CALL Clear() {
+				mKeys.Clear();
+				mRanks.Clear();
+			}
+
+			// Index of the first key that is not less than aKey
+			uint32_t SOLAIRE_DEFAULT_CALL LowerBound(const K* const, const uint32_t aCount, const K& aKey) const throw() {
+				if(aCount == 0) return 0;
+				const K* const keys = &mKeys[0];
+				uint32_t node = 1;
+				while(node <= aCount) node = node * 2 + (keys[node] < aKey ? 1 : 0);
+
+				// Undo the right turns taken after the last left turn, the node reached by that left turn is the answer
+				node >>= CountTrailingZeros(~node) + 1;
+				return node == 0 ? aCount : mRanks[node];
+			}
+		};
+
+		/*!
+			\brief Sort a batch of keys and remove duplicates, the last occurrence of each key is kept.
+			\param aKeys The keys of the batch.
+			\param aCount The number of keys.
+			\param aOrder Set to the indices of the unique keys, in key order.
+		*/
+		template<class K>
+		void SOLAIRE_DEFAULT_CALL SortFlatBatch(const K* const aKeys, const uint32_t aCount, DynamicArray<uint32_t>& aOrder) {
+			aOrder.Clear();
+			aOrder.Reserve(aCount);
+			for(uint32_t i = 0; i < aCount; ++i) aOrder.PushBack(i);
+			if(aCount == 0) return;
+
+			// Equal keys are ordered by descending index, so the first of each run is the one that was added last
+			uint32_t* const order = &aOrder[0];
+			Sort(order, aCount, [aKeys](const uint32_t aFirst, const uint32_t aSecond) {
+				if(aKeys[aFirst] < aKeys[aSecond]) return true;
+				if(aKeys[aSecond] < aKeys[aFirst]) return false;
+				return aFirst > aSecond;
+			});
+
+			uint32_t unique = 1;
+			for(uint32_t i = 1; i < aCount; ++i) {
+				if(aKeys[order[unique - 1]] < aKeys[order[i]]) order[unique++] = order[i];
+			}
+			while(aOrder.Size() > unique) aOrder.PopBack();
+		}
+
+		/*!
+			\brief Insert an element into an array, moving the elements after it back by one.
+		*/
+		template<class T, class V>
+		void SOLAIRE_DEFAULT_CALL FlatInsertAt(DynamicArray<T>& aArray, const uint32_t aIndex, V&& aValue) {
+			aArray.EmplaceBack(std::forward<V>(aValue));
+			const uint32_t last = aArray.Size() - 1;
+			if(aIndex == last) return;
+			T* const data = &aArray[0];
+			T tmp = std::move(data[last]);
+			for(uint32_t i = last; i > aIndex; --i) data[i] = std::move(data[i - 1]);
+			data[aIndex] = std::move(tmp);
+		}
+
+		/*!
+			\brief Remove an element from an array, moving the elements after it forward by one.
+		*/
+		template<class T>
+		void SOLAIRE_DEFAULT_CALL FlatEraseAt(DynamicArray<T>& aArray, const uint32_t aIndex) {
+			const uint32_t last = aArray.Size() - 1;
+			T* const data = &aArray[0];
+			for(uint32_t i = aIndex; i < last; ++i) data[i] = std::move(data[i + 1]);
+			aArray.PopBack();
+		}
+
+		/*!
+			\brief Get the elements of a container as an array, copying them into a buffer if the container is not contiguous.
+		*/
+		template<class T>
+		const T* SOLAIRE_DEFAULT_CALL GetFlatRange(const FixedContainer<T>& aContainer, DynamicArray<T>& aBuffer) {
+			const uint32_t size = aContainer.Size();
+			if(size == 0) return nullptr;
+			uint32_t length;
+			const T* const data = const_cast<FixedContainer<T>&>(aContainer).GetChunk(0, length);
+			if(length == size) return data;
+
+			aBuffer.Reserve(size);
+			aContainer.ForEachChunk([&aBuffer](const T* const aChunk, const uint32_t aLength) {
+				aBuffer.PushBackRange(aChunk, aLength);
+			});
+			return &aBuffer[0];
+		}
+	}
+
+	/*!
+		\class FlatSet
+		\brief An ordered set of keys stored in a sorted DynamicArray.
+		\detail
+		Intended for read mostly tables of up to around ten thousand keys, where a node or hash based set would waste memory.
+		Lookups are a branchless binary search, or a search of a copy of the keys in Eytzinger order if \a EYTZINGER is true.
+		Inserting or erasing a single key is O(n), so large changes should be made with InsertRange, which sorts the new keys
+		and merges them with the existing keys in one pass.
+		\tparam K The key type, must be copyable and comparable with operator<.
+		\tparam EYTZINGER True if lookups should use an Eytzinger ordered index.
+		\author Adam Smith
+		\date Created : 18th October 2026
+		\date Modified : 18th October 2026
+		\version 1.0
+		\see FlatMap
+	*/
+	template<class K, bool EYTZINGER = false>
+	class FlatSet {
+	private:
+		DynamicArray<K> mKeys;
+		Implementation::FlatIndex<K, EYTZINGER> mIndex;
+	private:
+		SOLAIRE_FORCE_INLINE const K* SOLAIRE_DEFAULT_CALL GetKeyPtr() const throw() {
+			return mKeys.Size() == 0 ? nullptr : &mKeys[0];
+		}
+
+		SOLAIRE_FORCE_INLINE void SOLAIRE_DEFAULT_CALL Rebuild() {
+			mIndex.Build(GetKeyPtr(), mKeys.Size());
+		}
+	public:
+		FlatSet(Allocator& aAllocator) :
+			mKeys(aAllocator),
+			mIndex(aAllocator)
+		{}
+
+		/*!
+			\brief Get the index of the first key that is not less than a key.
+			\param aKey The key to search for.
+			\return The index, or Size() if every key is less than \a aKey.
+		*/
+		SOLAIRE_FORCE_INLINE uint32_t SOLAIRE_DEFAULT_CALL LowerBound(const K& aKey) const throw() {
+			return mIndex.LowerBound(GetKeyPtr(), mKeys.Size(), aKey);
+		}
+
+		/*!
+			\brief Get the index of a key.
+			\param aKey The key to search for.
+			\return The index of the key, or Size() if it is not in the set.
+		*/
+		SOLAIRE_FORCE_INLINE uint32_t SOLAIRE_DEFAULT_CALL IndexOf(const K& aKey) const throw() {
+			const uint32_t size = mKeys.Size();
+			const uint32_t index = LowerBound(aKey);
+			return index < size && ! (aKey < mKeys[index]) ? index : size;
+		}
+
+		SOLAIRE_FORCE_INLINE bool SOLAIRE_DEFAULT_CALL Contains(const K& aKey) const throw() {
+			return IndexOf(aKey) != mKeys.Size();
+		}
+
+		/*!
+			\brief Insert a key into the set.
+			\param aKey The key to insert.
+			\return True if the key was inserted, false if it was already in the set.
+		*/
+		bool SOLAIRE_DEFAULT_CALL Insert(const K& aKey) {
+			const uint32_t index = LowerBound(aKey);
+			if(index < mKeys.Size() && ! (aKey < mKeys[index])) return false;
+			Implementation::FlatInsertAt(mKeys, index, aKey);
+			Rebuild();
+			return true;
+		}
+
+		/*!
+			\brief Insert several keys at once.
+			\detail The keys are sorted, then merged with the existing keys in O(n + m).
+			\param aKeys The keys to insert, they do not need to be sorted or unique.
+			\param aCount The number of keys.
+		*/
+		void SOLAIRE_DEFAULT_CALL InsertRange(const K* const aKeys, const uint32_t aCount) {
+			if(aCount == 0) return;
+			Allocator& allocator = mKeys.GetAllocator();
+			DynamicArray<uint32_t> order(allocator);
+			Implementation::SortFlatBatch(aKeys, aCount, order);
+
+			const uint32_t size = mKeys.Size();
+			const uint32_t batch = order.Size();
+			DynamicArray<K> keys(allocator, size + batch);
+			uint32_t i = 0;
+			uint32_t j = 0;
+			while(i < size && j < batch) {
+				const K& key = aKeys[order[j]];
+				if(mKeys[i] < key) {
+					keys.PushBack(std::move(mKeys[i++]));
+				}else {
+					if(! (key < mKeys[i])) ++i;
+					keys.PushBack(key);
+					++j;
+				}
+			}
+			for(; i < size; ++i) keys.PushBack(std::move(mKeys[i]));
+			for(; j < batch; ++j) keys.PushBack(aKeys[order[j]]);
+
+			mKeys = std::move(keys);
+			Rebuild();
+		}
+
+		void SOLAIRE_DEFAULT_CALL InsertRange(const FixedContainer<K>& aKeys) {
+			DynamicArray<K> buffer(mKeys.GetAllocator());
+			InsertRange(Implementation::GetFlatRange(aKeys, buffer), aKeys.Size());
+		}
+
+		/*!
+			\brief Remove a key from the set.
+			\param aKey The key to remove.
+			\return True if the key was removed, false if it was not in the set.
+		*/
+		bool SOLAIRE_DEFAULT_CALL Erase(const K& aKey) {
+			const uint32_t index = IndexOf(aKey);
+			if(index == mKeys.Size()) return false;
+			Implementation::FlatEraseAt(mKeys, index);
+			Rebuild();
+			return true;
+		}
+
+		void SOLAIRE_DEFAULT_CALL Clear() {
+			mKeys.Clear();
+			mIndex.Clear();
+		}
+
+		SOLAIRE_FORCE_INLINE bool SOLAIRE_DEFAULT_CALL Reserve(const uint32_t aCapacity) {
+			return mKeys.Reserve(aCapacity);
+		}
+
+		/*!
+			\brief Call a function on each key in the range [\a aBegin, \a aEnd), in order.
+			\param aBegin The first key in the range.
+			\param aEnd The key after the range.
+			\param aFunction A function with the signature void(const K& aKey).
+		*/
+		template<class F>
+		void SOLAIRE_DEFAULT_CALL ForEachInRange(const K& aBegin, const K& aEnd, F aFunction) const {
+			const uint32_t size = mKeys.Size();
+			for(uint32_t i = LowerBound(aBegin); i < size && mKeys[i] < aEnd; ++i) aFunction(mKeys[i]);
+		}
+
+		/*!
+			\brief Call a function on each key, in order.
+			\param aFunction A function with the signature void(const K& aKey).
+		*/
+		template<class F>
+		void SOLAIRE_DEFAULT_CALL ForEach(F aFunction) const {
+			mKeys.ForEach(aFunction);
+		}
+
+		/*!
+			\brief Get the keys in order.
+		*/
+		SOLAIRE_FORCE_INLINE const FixedContainer<K>& SOLAIRE_DEFAULT_CALL GetKeys() const throw() {
+			return mKeys;
+		}
+
+		SOLAIRE_FORCE_INLINE const K& SOLAIRE_DEFAULT_CALL operator[](const uint32_t aIndex) const throw() {
+			return mKeys[aIndex];
+		}
+
+		SOLAIRE_FORCE_INLINE uint32_t SOLAIRE_DEFAULT_CALL Size() const throw() {
+			return mKeys.Size();
+		}
+
+		SOLAIRE_FORCE_INLINE bool SOLAIRE_DEFAULT_CALL IsEmpty() const throw() {
+			return mKeys.Size() == 0;
+		}
+
+		SOLAIRE_FORCE_INLINE Allocator& SOLAIRE_DEFAULT_CALL GetAllocator() const throw() {
+			return mKeys.GetAllocator();
+		}
+	};
+
+	/*!
+		\class FlatMap
+		\brief An ordered map from keys of type \a K to values of type \a V, stored in two sorted DynamicArrays.
+		\detail
+		Keys and values are stored in separate arrays, so a lookup only reads keys. Lookups are a branchless binary search,
+		or a search of a copy of the keys in Eytzinger order if \a EYTZINGER is true.
+		Inserting or erasing a single element is O(n), so large changes should be made with InsertRange, which sorts the new
+		elements and merges them with the existing elements in one pass.
+		\tparam K The key type, must be copyable and comparable with operator<.
+		\tparam V The value type.
+		\tparam EYTZINGER True if lookups should use an Eytzinger ordered index.
+		\author Adam Smith
+		\date Created : 18th October 2026
+		\date Modified : 18th October 2026
+		\version 1.0
+		\see FlatSet
+	*/
+	template<class K, class V, bool EYTZINGER = false>
+	class FlatMap {
+	private:
+		DynamicArray<K> mKeys;
+		DynamicArray<V> mValues;
+		Implementation::FlatIndex<K, EYTZINGER> mIndex;
+	private:
+		SOLAIRE_FORCE_INLINE const K* SOLAIRE_DEFAULT_CALL GetKeyPtr() const throw() {
+			return mKeys.Size() == 0 ? nullptr : &mKeys[0];
+		}
+
+		SOLAIRE_FORCE_INLINE void SOLAIRE_DEFAULT_CALL Rebuild() {
+			mIndex.Build(GetKeyPtr(), mKeys.Size());
+		}
+
+		template<class ...PARAMS>
+		V& SOLAIRE_DEFAULT_CALL InsertAt(const uint32_t aIndex, const K& aKey, PARAMS&&... aParams) {
+			// Construct the new value first in case a parameter references an existing element
+			V tmp(std::forward<PARAMS>(aParams)...);
+			Implementation::FlatInsertAt(mKeys, aIndex, aKey);
+			Implementation::FlatInsertAt(mValues, aIndex, std::move(tmp));
+			Rebuild();
+			return mValues[aIndex];
+		}
+	public:
+		FlatMap(Allocator& aAllocator) :
+			mKeys(aAllocator),
+			mValues(aAllocator),
+			mIndex(aAllocator)
+		{}
+
+		/*!
+			\brief Get the index of the first element with a key that is not less than a key.
+			\param aKey The key to search for.
+			\return The index, or Size() if every key is less than \a aKey.
+		*/
+		SOLAIRE_FORCE_INLINE uint32_t SOLAIRE_DEFAULT_CALL LowerBound(const K& aKey) const throw() {
+			return mIndex.LowerBound(GetKeyPtr(), mKeys.Size(), aKey);
+		}
+
+		/*!
+			\brief Get the index of the element with a key.
+			\param aKey The key to search for.
+			\return The index of the element, or Size() if the key is not in the map.
+		*/
+		SOLAIRE_FORCE_INLINE uint32_t SOLAIRE_DEFAULT_CALL IndexOf(const K& aKey) const throw() {
+			const uint32_t size = mKeys.Size();
+			const uint32_t index = LowerBound(aKey);
+			return index < size && ! (aKey < mKeys[index]) ? index : size;
+		}
+
+		/*!
+			\brief Find the value mapped to a key.
+			\param aKey The key to search for.
+			\return The address of the value, or nullptr if the key is not in the map.
+		*/
+		SOLAIRE_FORCE_INLINE V* SOLAIRE_DEFAULT_CALL Find(const K& aKey) throw() {
+			const uint32_t index = IndexOf(aKey);
+			return index == mKeys.Size() ? nullptr : &mValues[index];
+		}
+
+		SOLAIRE_FORCE_INLINE const V* SOLAIRE_DEFAULT_CALL Find(const K& aKey) const throw() {
+			const uint32_t index = IndexOf(aKey);
+			return index == mKeys.Size() ? nullptr : &mValues[index];
+		}
+
+		SOLAIRE_FORCE_INLINE bool SOLAIRE_DEFAULT_CALL Contains(const K& aKey) const throw() {
+			return IndexOf(aKey) != mKeys.Size();
+		}
+
+		/*!
+			\brief Map a key to a value constructed in place.
+			\detail If the key is already in the map the existing value is returned and \a aParams are not used.
+			\tparam PARAMS The parameter types to pass to the value's constructor.
+			\param aKey The key to insert.
+			\param aParams The parameters to pass to the value's constructor.
+			\return The value mapped to \a aKey.
+		*/
+		template<class ...PARAMS>
+		V& SOLAIRE_DEFAULT_CALL Emplace(const K& aKey, PARAMS&&... aParams) {
+			const uint32_t index = LowerBound(aKey);
+			if(index < mKeys.Size() && ! (aKey < mKeys[index])) return mValues[index];
+			return InsertAt(index, aKey, std::forward<PARAMS>(aParams)...);
+		}
+
+		/*!
+			\brief Map a key to a value, replacing the existing value if there is one.
+			\param aKey The key to insert.
+			\param aValue The value to map to \a aKey.
+			\return The value mapped to \a aKey.
+		*/
+		V& SOLAIRE_DEFAULT_CALL Insert(const K& aKey, const V& aValue) {
+			const uint32_t index = LowerBound(aKey);
+			if(index < mKeys.Size() && ! (aKey < mKeys[index])) return mValues[index] = aValue;
+			return InsertAt(index, aKey, aValue);
+		}
+
+		V& SOLAIRE_DEFAULT_CALL Insert(const K& aKey, V&& aValue) {
+			const uint32_t index = LowerBound(aKey);
+			if(index < mKeys.Size() && ! (aKey < mKeys[index])) return mValues[index] = std::move(aValue);
+			return InsertAt(index, aKey, std::move(aValue));
+		}
+
+		SOLAIRE_FORCE_INLINE V& SOLAIRE_DEFAULT_CALL operator[](const K& aKey) {
+			return Emplace(aKey);
+		}
+
+		/*!
+			\brief Insert several elements at once.
+			\detail
+			The new elements are sorted, then merged with the existing elements in O(n + m). If a key appears more than once
+			the last value is kept, existing values are replaced.
+			\param aKeys The keys to insert, they do not need to be sorted or unique.
+			\param aValues The values to insert, element N is mapped to aKeys[N].
+			\param aCount The number of elements.
+		*/
+		void SOLAIRE_DEFAULT_CALL InsertRange(const K* const aKeys, const V* const aValues, const uint32_t aCount) {
+			if(aCount == 0) return;
+			Allocator& allocator = mKeys.GetAllocator();
+			DynamicArray<uint32_t> order(allocator);
+			Implementation::SortFlatBatch(aKeys, aCount, order);
+
+			const uint32_t size = mKeys.Size();
+			const uint32_t batch = order.Size();
+			DynamicArray<K> keys(allocator, size + batch);
+			DynamicArray<V> values(allocator, size + batch);
+			uint32_t i = 0;
+			uint32_t j = 0;
+			while(i < size && j < batch) {
+				const uint32_t source = order[j];
+				if(mKeys[i] < aKeys[source]) {
+					keys.PushBack(std::move(mKeys[i]));
+					values.PushBack(std::move(mValues[i]));
+					++i;
+				}else {
+					if(! (aKeys[source] < mKeys[i])) ++i;
+					keys.PushBack(aKeys[source]);
+					values.PushBack(aValues[source]);
+					++j;
+				}
+			}
+			for(; i < size; ++i) {
+				keys.PushBack(std::move(mKeys[i]));
+				values.PushBack(std::move(mValues[i]));
+			}
+			for(; j < batch; ++j) {
+				keys.PushBack(aKeys[order[j]]);
+				values.PushBack(aValues[order[j]]);
+			}
+
+			mKeys = std::move(keys);
+			mValues = std::move(values);
+			Rebuild();
+		}
+
+		void SOLAIRE_DEFAULT_CALL InsertRange(const FixedContainer<K>& aKeys, const FixedContainer<V>& aValues) {
+			SolaireRuntimeAssert(aKeys.Size() == aValues.Size(), "SolaireCPP : FlatMap::InsertRange key and value counts do not match");
+			Allocator& allocator = mKeys.GetAllocator();
+			DynamicArray<K> keyBuffer(allocator);
+			DynamicArray<V> valueBuffer(allocator);
+			InsertRange(Implementation::GetFlatRange(aKeys, keyBuffer), Implementation::GetFlatRange(aValues, valueBuffer), aKeys.Size());
+		}
+
+		/*!
+			\brief Remove the element with a key.
+			\param aKey The key to remove.
+			\return True if the element was removed, false if the key was not in the map.
+		*/
+		bool SOLAIRE_DEFAULT_CALL Erase(const K& aKey) {
+			const uint32_t index = IndexOf(aKey);
+			if(index == mKeys.Size()) return false;
+			Implementation::FlatEraseAt(mKeys, index);
+			Implementation::FlatEraseAt(mValues, index);
+			Rebuild();
+			return true;
+		}
+
+		void SOLAIRE_DEFAULT_CALL Clear() {
+			mKeys.Clear();
+			mValues.Clear();
+			mIndex.Clear();
+		}
+
+		SOLAIRE_FORCE_INLINE bool SOLAIRE_DEFAULT_CALL Reserve(const uint32_t aCapacity) {
+			return mKeys.Reserve(aCapacity) && mValues.Reserve(aCapacity);
+		}
+
+		/*!
+			\brief Call a function on each element with a key in the range [\a aBegin, \a aEnd), in key order.
+			\param aBegin The first key in the range.
+			\param aEnd The key after the range.
+			\param aFunction A function with the signature void(const K& aKey, V& aValue).
+		*/
+		template<class F>
+		void SOLAIRE_DEFAULT_CALL ForEachInRange(const K& aBegin, const K& aEnd, F aFunction) {
+			const uint32_t size = mKeys.Size();
+			for(uint32_t i = LowerBound(aBegin); i < size && mKeys[i] < aEnd; ++i) aFunction(static_cast<const K&>(mKeys[i]), mValues[i]);
+		}
+
+		template<class F>
+		void SOLAIRE_DEFAULT_CALL ForEachInRange(const K& aBegin, const K& aEnd, F aFunction) const {
+			const uint32_t size = mKeys.Size();
+			for(uint32_t i = LowerBound(aBegin); i < size && mKeys[i] < aEnd; ++i) aFunction(mKeys[i], mValues[i]);
+		}
+
+		/*!
+			\brief Call a function on each element, in key order.
+			\param aFunction A function with the signature void(const K& aKey, V& aValue).
+		*/
+		template<class F>
+		void SOLAIRE_DEFAULT_CALL ForEach(F aFunction) {
+			const uint32_t size = mKeys.Size();
+			for(uint32_t i = 0; i < size; ++i) aFunction(static_cast<const K&>(mKeys[i]), mValues[i]);
+		}
+
+		template<class F>
+		void SOLAIRE_DEFAULT_CALL ForEach(F aFunction) const {
+			const uint32_t size = mKeys.Size();
+			for(uint32_t i = 0; i < size; ++i) aFunction(mKeys[i], mValues[i]);
+		}
+
+		/*!
+			\brief Get the keys in order.
+		*/
+		SOLAIRE_FORCE_INLINE const FixedContainer<K>& SOLAIRE_DEFAULT_CALL GetKeys() const throw() {
+			return mKeys;
+		}
+
+		/*!
+			\brief Get the values in key order.
+			\detail Values can be modified in place, element N is mapped to key N.
+		*/
+		SOLAIRE_FORCE_INLINE FixedContainer<V>& SOLAIRE_DEFAULT_CALL GetValues() throw() {
+			return mValues;
+		}
+
+		SOLAIRE_FORCE_INLINE const FixedContainer<V>& SOLAIRE_DEFAULT_CALL GetValues() const throw() {
+			return mValues;
+		}
+
+		SOLAIRE_FORCE_INLINE uint32_t SOLAIRE_DEFAULT_CALL Size() const throw() {
+			return mKeys.Size();
+		}
+
+		SOLAIRE_FORCE_INLINE bool SOLAIRE_DEFAULT_CALL IsEmpty() const throw() {
+			return mKeys.Size() == 0;
+		}
+
+		SOLAIRE_FORCE_INLINE Allocator& SOLAIRE_DEFAULT_CALL GetAllocator() const throw() {
+			return mKeys.GetAllocator();
+		}
+	};
+}
+
+#endif
@@ -0,0 +1,638 @@
+#ifndef SOLAIRE_HASH_MAP_HPP
+#define SOLAIRE_HASH_MAP_HPP
+
+//Copyright 2015 Adam Smith
+//
+//Licensed under the Apache License, Version 2.0 (the "License");
+//you may not use this file except in compliance with the License.
+//You may obtain a copy of the License at
+//
+//    http://www.apache.org/licenses/LICENSE-2.0
+//
+//Unless required by applicable law or agreed to in writing, software
+//distributed under the License is distributed on an "AS IS" BASIS,
+//WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//See the License for the specific language governing permissions and
+//limitations under the License.
+
+// Contact :
+// Email             : solairelibrary@mail.com
+// GitHub repository : https://github.com/SolaireLibrary/SolaireCPP
+
+/*!
+	\file HashMap.hpp
+	\brief
+	\author
+	Created			: Adam Smith
+	Last modified	: Adam Smith
+	\version 1.0
+	\date
+	Created			: 18th October 2026
+	Last Modified	: 18th October 2026
+*/
+
+#include <new>
+#include <cstring>
+#include <utility>
+#include <stdexcept>
+#include <type_traits>
+#include "AllocatorI.hpp"
+#include "Iterator.hpp"
+#include "Maths.hpp"
+#include "..\Maths\Hash\HashFunction.hpp"
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+	#include <emmintrin.h>
+	#define SOLAIRE_HASH_MAP_SSE2
+#endif
+
+namespace Solaire {
+
+	/*!
+		\brief Hash a key for a HashMap.
+		\detail
+		The default implementation hashes the bytes of the key, so it is only correct for types where equal values have
+		equal bytes. Other key types should provide an overload of HashKey in their own namespace.
+		\param aFunction The hash function to use.
+		\param aKey The key to hash.
+		\return The hash of \a aKey.
+	*/
+	template<class K>
+	static uint32_t SOLAIRE_DEFAULT_CALL HashKey(const HashFunction<uint32_t>& aFunction, const K& aKey) throw() {
+		static_assert(std::is_trivially_copyable<K>::value, "SolaireCPP : HashKey must be overloaded for keys that are not trivially copyable");
+		return aFunction.Hash(&aKey, sizeof(K));
+	}
+
+	template<class K, class V>
+	struct HashMapEntry {
+		K Key;
+		V Value;
+
+		template<class ...PARAMS>
+		HashMapEntry(const K& aKey, PARAMS&&... aParams) :
+			Key(aKey),
+			Value(std::forward<PARAMS>(aParams)...)
+		{}
+	};
+
+	namespace Implementation {
+		enum : int8_t {
+			HASH_MAP_EMPTY = -128,
+			HASH_MAP_DELETED = -2
+		};
+
+		/*
+			A group of control bytes that are checked together, a mask has one bit (or one byte) per slot.
+			Full slots store the low 7 bits of their hash, so their control byte is never negative.
+		*/
+		#ifdef SOLAIRE_HASH_MAP_SSE2
+			class HashMapGroup {
+			public:
+				typedef uint32_t Mask;
+
+				enum : uint32_t {
+					WIDTH = 16,
+					SHIFT = 0
+				};
+			private:
+				__m128i mControl;
+			public:
+				SOLAIRE_FORCE_INLINE HashMapGroup(const int8_t* const aControl) throw() :
+					mControl(_mm_loadu_si128(reinterpret_cast<const __m128i*>(aControl)))
+				{}
+
+				SOLAIRE_FORCE_INLINE Mask SOLAIRE_DEFAULT_CALL Match(const int8_t aHash) const throw() {
+					return static_cast<Mask>(_mm_movemask_epi8(_mm_cmpeq_epi8(_mm_set1_epi8(aHash), mControl)));
+				}
+
+				SOLAIRE_FORCE_INLINE Mask SOLAIRE_DEFAULT_CALL MatchEmpty() const throw() {
+					return Match(HASH_MAP_EMPTY);
+				}
+
+				SOLAIRE_FORCE_INLINE Mask SOLAIRE_DEFAULT_CALL MatchEmptyOrDeleted() const throw() {
+					return static_cast<Mask>(_mm_movemask_epi8(mControl));
+				}
+
+				static SOLAIRE_FORCE_INLINE uint32_t SOLAIRE_DEFAULT_CALL LeadingZeros(const Mask aMask) throw() {
+					return CountLeadingZeros(aMask) - 16;
+				}
+			};
+		#else
+			class HashMapGroup {
+			public:
+				typedef uint64_t Mask;
+
+				enum : uint32_t {
+					WIDTH = 8,
+					SHIFT = 3
+				};
+			private:
+				enum : uint64_t {
+					LSBS = 0x0101010101010101L,
+					MSBS = 0x8080808080808080L
+				};
+			private:
+				uint64_t mControl;
+			public:
+				SOLAIRE_FORCE_INLINE HashMapGroup(const int8_t* const aControl) throw() {
+					std::memcpy(&mControl, aControl, sizeof(uint64_t));
+				}
+
+				SOLAIRE_FORCE_INLINE Mask SOLAIRE_DEFAULT_CALL Match(const int8_t aHash) const throw() {
+					// May report a false positive next to a real match, keys are compared afterwards anyway
+					const uint64_t x = mControl ^ (LSBS * static_cast<uint8_t>(aHash));
+					return (x - LSBS) & ~x & MSBS;
+				}
+
+				SOLAIRE_FORCE_INLINE Mask SOLAIRE_DEFAULT_CALL MatchEmpty() const throw() {
+					return mControl & (~mControl << 6) & MSBS;
+				}
+
+				SOLAIRE_FORCE_INLINE Mask SOLAIRE_DEFAULT_CALL MatchEmptyOrDeleted() const throw() {
+					return mControl & MSBS;
+				}
+
+				static SOLAIRE_FORCE_INLINE uint32_t SOLAIRE_DEFAULT_CALL LeadingZeros(const Mask aMask) throw() {
+					return CountLeadingZeros(aMask) >> SHIFT;
+				}
+			};
+		#endif
+
+		inline uint32_t SOLAIRE_DEFAULT_CALL HashMapLowestSlot(const HashMapGroup::Mask aMask) throw() {
+			return CountTrailingZeros(aMask) >> HashMapGroup::SHIFT;
+		}
+	}
+
+	template<class ENTRY>
+	class HashMapIterator : public Iterator<ENTRY> {
+	public:
+		typedef typename Iterator<ENTRY>::Type Type;
+		typedef typename Iterator<ENTRY>::Offset Offset;
+	private:
+		const int8_t* mControl;
+		ENTRY* mEntries;
+		uint32_t mCapacity;
+		uint32_t mIndex;
+	protected:
+		//Inherited from Iterator
+		Offset SOLAIRE_EXPORT_CALL GetOffset() const throw() override {
+			return mIndex;
+		}
+	public:
+		HashMapIterator(const int8_t* const aControl, ENTRY* const aEntries, const uint32_t aCapacity, const uint32_t aIndex) :
+			mControl(aControl),
+			mEntries(aEntries),
+			mCapacity(aCapacity),
+			mIndex(aIndex)
+		{
+			while(mIndex < mCapacity && mControl[mIndex] < 0) ++mIndex;
+		}
+
+		SOLAIRE_EXPORT_CALL ~HashMapIterator() {
+
+		}
+
+		// Inherited from Iterator
+
+		Type* SOLAIRE_EXPORT_CALL operator->() throw() override final {
+			return mEntries + mIndex;
+		}
+
+		Iterator<Type>& SOLAIRE_EXPORT_CALL operator++() throw() override final {
+			do {
+				++mIndex;
+			}while(mIndex < mCapacity && mControl[mIndex] < 0);
+			return *this;
+		}
+
+		Iterator<Type>& SOLAIRE_EXPORT_CALL operator--() throw() override final {
+			do {
+				--mIndex;
+			}while(mIndex > 0 && mControl[mIndex] < 0);
+			return *this;
+		}
+
+		Iterator<Type>& SOLAIRE_EXPORT_CALL operator+=(const Offset aOffset) throw() override final {
+			for(Offset i = 0; i < aOffset; ++i) operator++();
+			return *this;
+		}
+
+		Iterator<Type>& SOLAIRE_EXPORT_CALL operator-=(const Offset aOffset) throw() override final {
+			for(Offset i = 0; i < aOffset; ++i) operator--();
+			return *this;
+		}
+
+		SOLAIRE_FORCE_INLINE Type& SOLAIRE_DEFAULT_CALL operator*() throw() {
+			return *operator->();
+		}
+	};
+
+	/*!
+		\class HashMap
+		\brief An open addressing hash table that maps keys of type \a K to values of type \a V.
+		\detail
+		Each slot has a control byte that is either empty, deleted, or the low 7 bits of the hash of the slot's key.
+		Lookups compare a whole group of control bytes at once (16 with SSE2, otherwise 8 using 64 bit arithmetic),
+		so keys are usually only compared when they are likely to match.
+		Erasing an element only leaves a deleted marker if a probe could have passed over the slot, which keeps the table
+		free of most tombstones under mixed insertion and erasure.
+		Inserting into the table may move its elements, invalidating pointers and iterators.
+		\tparam K The key type, must be comparable with operator==. Keys are hashed with HashKey.
+		\tparam V The value type.
+		\author Adam Smith
+		\date Created : 18th October 2026
+		\date Modified : 18th October 2026
+		\version 1.0
+		\see HashKey
+	*/
+	template<class K, class V>
+	class HashMap {
+	public:
+		typedef HashMapEntry<K, V> Entry;
+		typedef HashMapIterator<Entry> Iterator;
+		typedef HashMapIterator<const Entry> ConstIterator;
+
+		enum : uint32_t {
+			MIN_CAPACITY = 16
+		};
+	private:
+		typedef Implementation::HashMapGroup Group;
+
+		enum : uint32_t {
+			GROUP_WIDTH = Group::WIDTH,
+			NOT_FOUND = UINT32_MAX
+		};
+	private:
+		AllocatorI* mAllocator;
+		const HashFunction<uint32_t>* mHashFunction;
+		int8_t* mControl;
+		Entry* mEntries;
+		uint32_t mSize;
+		uint32_t mCapacity;
+		uint32_t mGrowthLeft;
+	private:
+		static SOLAIRE_FORCE_INLINE uint32_t SOLAIRE_DEFAULT_CALL GrowthLimit(const uint32_t aCapacity) throw() {
+			// Maximum load factor of 7/8
+			return aCapacity - aCapacity / 8;
+		}
+
+		static SOLAIRE_FORCE_INLINE uint32_t SOLAIRE_DEFAULT_CALL ControlBytes(const uint32_t aCapacity) throw() {
+			// The first group is cloned after the last slot so that any slot can start a group
+			return CeilToMultiple<uint32_t>(aCapacity + GROUP_WIDTH, std::alignment_of<Entry>::value);
+		}
+
+		static SOLAIRE_FORCE_INLINE uint32_t SOLAIRE_DEFAULT_CALL H1(const uint32_t aHash) throw() {
+			return aHash >> 7;
+		}
+
+		static SOLAIRE_FORCE_INLINE int8_t SOLAIRE_DEFAULT_CALL H2(const uint32_t aHash) throw() {
+			return static_cast<int8_t>(aHash & 0x7F);
+		}
+
+		SOLAIRE_FORCE_INLINE uint32_t SOLAIRE_DEFAULT_CALL Hash(const K& aKey) const throw() {
+			return HashKey(*mHashFunction, aKey);
+		}
+
+		SOLAIRE_FORCE_INLINE void SOLAIRE_DEFAULT_CALL SetControl(const uint32_t aIndex, const int8_t aValue) throw() {
+			mControl[aIndex] = aValue;
+			if(aIndex < GROUP_WIDTH) mControl[mCapacity + aIndex] = aValue;
+		}
+
+		uint32_t SOLAIRE_DEFAULT_CALL FindIndex(const K& aKey, const uint32_t aHash) const throw() {
+			if(mCapacity == 0) return NOT_FOUND;
+			const uint32_t mask = mCapacity - 1;
+			const int8_t h2 = H2(aHash);
+			uint32_t position = H1(aHash) & mask;
+			uint32_t step = 0;
+			while(true) {
+				const Group group(mControl + position);
+				typename Group::Mask matches = group.Match(h2);
+				while(matches) {
+					const uint32_t index = (position + Implementation::HashMapLowestSlot(matches)) & mask;
+					if(mEntries[index].Key == aKey) return index;
+					matches &= matches - 1;
+				}
+				if(group.MatchEmpty()) return NOT_FOUND;
+				step += GROUP_WIDTH;
+				position = (position + step) & mask;
+			}
+		}
+
+		uint32_t SOLAIRE_DEFAULT_CALL FindInsertIndex(const uint32_t aHash) const throw() {
+			const uint32_t mask = mCapacity - 1;
+			uint32_t position = H1(aHash) & mask;
+			uint32_t step = 0;
+			while(true) {
+				const typename Group::Mask available = Group(mControl + position).MatchEmptyOrDeleted();
+				if(available) return (position + Implementation::HashMapLowestSlot(available)) & mask;
+				step += GROUP_WIDTH;
+				position = (position + step) & mask;
+			}
+		}
+
+		void SOLAIRE_DEFAULT_CALL Rehash(const uint32_t aCapacity) {
+			void* const block = mAllocator->Allocate(ControlBytes(aCapacity) + sizeof(Entry) * aCapacity);
+			SolaireRuntimeAssert(block != nullptr, "SolaireCPP : HashMap failed to allocate memory");
+
+			int8_t* const control = mControl;
+			Entry* const entries = mEntries;
+			const uint32_t capacity = mCapacity;
+
+			mControl = static_cast<int8_t*>(block);
+			mEntries = reinterpret_cast<Entry*>(static_cast<uint8_t*>(block) + ControlBytes(aCapacity));
+			mCapacity = aCapacity;
+			mGrowthLeft = GrowthLimit(aCapacity) - mSize;
+			std::memset(mControl, Implementation::HASH_MAP_EMPTY, aCapacity + GROUP_WIDTH);
+
+			for(uint32_t i = 0; i < capacity; ++i) {
+				if(control[i] < 0) continue;
+				Entry& entry = entries[i];
+				const uint32_t hash = Hash(entry.Key);
+				const uint32_t index = FindInsertIndex(hash);
+				SetControl(index, H2(hash));
+				new(mEntries + index) Entry(std::move(entry));
+				entry.~Entry();
+			}
+
+			if(control) mAllocator->Deallocate(control);
+		}
+
+		void SOLAIRE_DEFAULT_CALL EraseIndex(const uint32_t aIndex) throw() {
+			mEntries[aIndex].~Entry();
+			--mSize;
+
+			// If every group that contains this slot also contains an empty slot then no probe has passed over it
+			const typename Group::Mask emptyBefore = Group(mControl + ((aIndex - GROUP_WIDTH) & (mCapacity - 1))).MatchEmpty();
+			const typename Group::Mask emptyAfter = Group(mControl + aIndex).MatchEmpty();
+			const bool neverFull = emptyBefore && emptyAfter &&
+				Implementation::HashMapLowestSlot(emptyAfter) + Group::LeadingZeros(emptyBefore) < GROUP_WIDTH;
+
+			if(neverFull) {
+				SetControl(aIndex, Implementation::HASH_MAP_EMPTY);
+				++mGrowthLeft;
+			}else {
+				SetControl(aIndex, Implementation::HASH_MAP_DELETED);
+			}
+		}
+
+		template<class ...PARAMS>
+		Entry& SOLAIRE_DEFAULT_CALL EmplaceAt(const K& aKey, const uint32_t aHash, PARAMS&&... aParams) {
+			uint32_t index = mCapacity == 0 ? 0 : FindInsertIndex(aHash);
+			Entry* entry;
+
+			if(mCapacity == 0 || (mGrowthLeft == 0 && mControl[index] == Implementation::HASH_MAP_EMPTY)) {
+				// Construct the new element first in case a parameter references an existing element
+				Entry tmp(aKey, std::forward<PARAMS>(aParams)...);
+				// If deleted slots make up most of the load then clear them without growing
+				Rehash(mCapacity == 0 ? MIN_CAPACITY : mSize < GrowthLimit(mCapacity) / 2 ? mCapacity : mCapacity * 2);
+				index = FindInsertIndex(aHash);
+				entry = new(mEntries + index) Entry(std::move(tmp));
+			}else {
+				entry = new(mEntries + index) Entry(aKey, std::forward<PARAMS>(aParams)...);
+			}
+
+			if(mControl[index] == Implementation::HASH_MAP_EMPTY) --mGrowthLeft;
+			SetControl(index, H2(aHash));
+			++mSize;
+			return *entry;
+		}
+
+		void SOLAIRE_DEFAULT_CALL Destroy() throw() {
+			Clear();
+			if(mControl) mAllocator->Deallocate(mControl);
+			mControl = nullptr;
+			mEntries = nullptr;
+			mCapacity = 0;
+			mGrowthLeft = 0;
+		}
+	public:
+		/*!
+			\brief Create an empty map, no memory is allocated until the first element is inserted.
+			\param aAllocator The allocator that the table will be allocated from.
+			\param aHashFunction The function used to hash keys, it must outlive the map.
+		*/
+		HashMap(AllocatorI& aAllocator, const HashFunction<uint32_t>& aHashFunction) throw() :
+			mAllocator(&aAllocator),
+			mHashFunction(&aHashFunction),
+			mControl(nullptr),
+			mEntries(nullptr),
+			mSize(0),
+			mCapacity(0),
+			mGrowthLeft(0)
+		{}
+
+		HashMap(const HashMap<K, V>& aOther) :
+			mAllocator(aOther.mAllocator),
+			mHashFunction(aOther.mHashFunction),
+			mControl(nullptr),
+			mEntries(nullptr),
+			mSize(0),
+			mCapacity(0),
+			mGrowthLeft(0)
+		{
+			operator=(aOther);
+		}
+
+		HashMap(HashMap<K, V>&& aOther) throw() :
+			mAllocator(aOther.mAllocator),
+			mHashFunction(aOther.mHashFunction),
+			mControl(aOther.mControl),
+			mEntries(aOther.mEntries),
+			mSize(aOther.mSize),
+			mCapacity(aOther.mCapacity),
+			mGrowthLeft(aOther.mGrowthLeft)
+		{
+			aOther.mControl = nullptr;
+			aOther.mEntries = nullptr;
+			aOther.mSize = 0;
+			aOther.mCapacity = 0;
+			aOther.mGrowthLeft = 0;
+		}
+
+		~HashMap() throw() {
+			Destroy();
+		}
+
+		HashMap<K, V>& SOLAIRE_DEFAULT_CALL operator=(const HashMap<K, V>& aOther) {
+			if(&aOther == this) return *this;
+			Clear();
+			mHashFunction = aOther.mHashFunction;
+			Reserve(aOther.mSize);
+			for(uint32_t i = 0; i < aOther.mCapacity; ++i) {
+				if(aOther.mControl[i] < 0) continue;
+				const Entry& entry = aOther.mEntries[i];
+				EmplaceAt(entry.Key, Hash(entry.Key), entry.Value);
+			}
+			return *this;
+		}
+
+		HashMap<K, V>& SOLAIRE_DEFAULT_CALL operator=(HashMap<K, V>&& aOther) throw() {
+			if(&aOther == this) return *this;
+			Destroy();
+			mAllocator = aOther.mAllocator;
+			mHashFunction = aOther.mHashFunction;
+			mControl = aOther.mControl;
+			mEntries = aOther.mEntries;
+			mSize = aOther.mSize;
+			mCapacity = aOther.mCapacity;
+			mGrowthLeft = aOther.mGrowthLeft;
+			aOther.mControl = nullptr;
+			aOther.mEntries = nullptr;
+			aOther.mSize = 0;
+			aOther.mCapacity = 0;
+			aOther.mGrowthLeft = 0;
+			return *this;
+		}
+
+		/*!
+			\brief Find the value mapped to a key.
+			\param aKey The key to search for.
+			\return The address of the value, or nullptr if the key is not in the map.
+		*/
+		V* SOLAIRE_DEFAULT_CALL Find(const K& aKey) throw() {
+			const uint32_t index = FindIndex(aKey, Hash(aKey));
+			return index == NOT_FOUND ? nullptr : &mEntries[index].Value;
+		}
+
+		const V* SOLAIRE_DEFAULT_CALL Find(const K& aKey) const throw() {
+			const uint32_t index = FindIndex(aKey, Hash(aKey));
+			return index == NOT_FOUND ? nullptr : &mEntries[index].Value;
+		}
+
+		SOLAIRE_FORCE_INLINE bool SOLAIRE_DEFAULT_CALL Contains(const K& aKey) const throw() {
+			return Find(aKey) != nullptr;
+		}
+
+		/*!
+			\brief Map a key to a value constructed in place.
+			\detail If the key is already in the map the existing value is returned and \a aParams are not used.
+			\tparam PARAMS The parameter types to pass to the value's constructor.
+			\param aKey The key to insert.
+			\param aParams The parameters to pass to the value's constructor.
+			\return The value mapped to \a aKey.
+		*/
+		template<class ...PARAMS>
+		V& SOLAIRE_DEFAULT_CALL Emplace(const K& aKey, PARAMS&&... aParams) {
+			const uint32_t hash = Hash(aKey);
+			const uint32_t index = FindIndex(aKey, hash);
+			if(index != NOT_FOUND) return mEntries[index].Value;
+			return EmplaceAt(aKey, hash, std::forward<PARAMS>(aParams)...).Value;
+		}
+
+		/*!
+			\brief Map a key to a value, replacing the existing value if there is one.
+			\param aKey The key to insert.
+			\param aValue The value to map to \a aKey.
+			\return The value mapped to \a aKey.
+		*/
+		V& SOLAIRE_DEFAULT_CALL Insert(const K& aKey, const V& aValue) {
+			const uint32_t hash = Hash(aKey);
+			const uint32_t index = FindIndex(aKey, hash);
+			if(index != NOT_FOUND) return mEntries[index].Value = aValue;
+			return EmplaceAt(aKey, hash, aValue).Value;
+		}
+
+		V& SOLAIRE_DEFAULT_CALL Insert(const K& aKey, V&& aValue) {
+			const uint32_t hash = Hash(aKey);
+			const uint32_t index = FindIndex(aKey, hash);
+			if(index != NOT_FOUND) return mEntries[index].Value = std::move(aValue);
+			return EmplaceAt(aKey, hash, std::move(aValue)).Value;
+		}
+
+		SOLAIRE_FORCE_INLINE V& SOLAIRE_DEFAULT_CALL operator[](const K& aKey) {
+			return Emplace(aKey);
+		}
+
+		/*!
+			\brief Remove a key and its value from the map.
+			\param aKey The key to remove.
+			\return True if the key was in the map.
+		*/
+		bool SOLAIRE_DEFAULT_CALL Erase(const K& aKey) throw() {
+			const uint32_t index = FindIndex(aKey, Hash(aKey));
+			if(index == NOT_FOUND) return false;
+			EraseIndex(index);
+			return true;
+		}
+
+		/*!
+			\brief Remove every element, the table's memory is kept.
+		*/
+		void SOLAIRE_DEFAULT_CALL Clear() throw() {
+			if(mCapacity == 0) return;
+			if(! std::is_trivially_destructible<Entry>::value) {
+				for(uint32_t i = 0; i < mCapacity; ++i) {
+					if(mControl[i] >= 0) mEntries[i].~Entry();
+				}
+			}
+			std::memset(mControl, Implementation::HASH_MAP_EMPTY, mCapacity + GROUP_WIDTH);
+			mSize = 0;
+			mGrowthLeft = GrowthLimit(mCapacity);
+		}
+
+		/*!
+			\brief Allocate a table large enough to hold \a aCount elements without growing.
+			\param aCount The number of elements to reserve space for.
+		*/
+		void SOLAIRE_DEFAULT_CALL Reserve(const uint32_t aCount) {
+			if(aCount <= mSize + mGrowthLeft) return;
+			uint32_t capacity = Max<uint32_t>(NextPowerOfTwo(aCount), MIN_CAPACITY);
+			if(GrowthLimit(capacity) < aCount) capacity *= 2;
+			Rehash(capacity);
+		}
+
+		/*!
+			\brief Call a function on each element, in table order.
+			\param aFunction A function with the signature void(const K& aKey, V& aValue).
+		*/
+		template<class F>
+		void SOLAIRE_DEFAULT_CALL ForEach(F aFunction) {
+			for(uint32_t i = 0; i < mCapacity; ++i) {
+				if(mControl[i] >= 0) aFunction(static_cast<const K&>(mEntries[i].Key), mEntries[i].Value);
+			}
+		}
+
+		template<class F>
+		void SOLAIRE_DEFAULT_CALL ForEach(F aFunction) const {
+			for(uint32_t i = 0; i < mCapacity; ++i) {
+				if(mControl[i] >= 0) aFunction(static_cast<const K&>(mEntries[i].Key), static_cast<const V&>(mEntries[i].Value));
+			}
+		}
+
+		SOLAIRE_FORCE_INLINE uint32_t SOLAIRE_DEFAULT_CALL Size() const throw() {
+			return mSize;
+		}
+
+		SOLAIRE_FORCE_INLINE uint32_t SOLAIRE_DEFAULT_CALL GetCapacity() const throw() {
+			return mCapacity;
+		}
+
+		SOLAIRE_FORCE_INLINE AllocatorI& SOLAIRE_DEFAULT_CALL GetAllocator() const throw() {
+			return *mAllocator;
+		}
+
+		SOLAIRE_FORCE_INLINE const HashFunction<uint32_t>& SOLAIRE_DEFAULT_CALL GetHashFunction() const throw() {
+			return *mHashFunction;
+		}
+
+		// The key of an element must not be modified through an iterator
+
+		SOLAIRE_FORCE_INLINE Iterator SOLAIRE_DEFAULT_CALL begin() throw() {
+			return Iterator(mControl, mEntries, mCapacity, 0);
+		}
+
+		SOLAIRE_FORCE_INLINE Iterator SOLAIRE_DEFAULT_CALL end() throw() {
+			return Iterator(mControl, mEntries, mCapacity, mCapacity);
+		}
+
+		SOLAIRE_FORCE_INLINE ConstIterator SOLAIRE_DEFAULT_CALL begin() const throw() {
+			return ConstIterator(mControl, mEntries, mCapacity, 0);
+		}
+
+		SOLAIRE_FORCE_INLINE ConstIterator SOLAIRE_DEFAULT_CALL end() const throw() {
+			return ConstIterator(mControl, mEntries, mCapacity, mCapacity);
+		}
+	};
+}
+
+#endif
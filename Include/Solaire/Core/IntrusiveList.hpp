@@ -0,0 +1,318 @@
+#ifndef SOLAIRE_INTRUSIVE_LIST_HPP
+#define SOLAIRE_INTRUSIVE_LIST_HPP
+
+//Copyright 2015 Adam Smith
+//
+//Licensed under the Apache License, Version 2.0 (the "License");
+//you may not use this file except in compliance with the License.
+//You may obtain a copy of the License at
+//
+//    http://www.apache.org/licenses/LICENSE-2.0
+//
+//Unless required by applicable law or agreed to in writing, software
+//distributed under the License is distributed on an "AS IS" BASIS,
+//WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//See the License for the specific language governing permissions and
+//limitations under the License.
+
+// Contact :
+// Email             : solairelibrary@mail.com
+// GitHub repository : https://github.com/SolaireLibrary/SolaireCPP
+
+/*!
+	\file IntrusiveList.hpp
+	\brief
+	\author
+	Created			: Adam Smith
+	Last modified	: Adam Smith
+	\version 1.0
+	\date
+	Created			: 18th October 2026
+	Last Modified	: 18th October 2026
+*/
+
+#include "Init.hpp"
+
+namespace Solaire {
+
+	/*!
+		\class IntrusiveListHook
+		\brief The links that an object needs to be stored in an IntrusiveList.
+		\detail
+		An object is stored in a list by inheriting from a hook, an object that inherits from several hooks with different
+		tags can be in several lists at once. Copying an object does not copy its links.
+		\tparam TAG A type that distinguishes the hooks of different lists.
+		\author Adam Smith
+		\date Created : 18th October 2026
+		\date Modified : 18th October 2026
+		\version 1.0
+		\see IntrusiveList
+	*/
+	template<class TAG = void>
+	struct IntrusiveListHook {
+		IntrusiveListHook<TAG>* Previous;
+		IntrusiveListHook<TAG>* Next;
+
+		IntrusiveListHook() throw() :
+			Previous(nullptr),
+			Next(nullptr)
+		{}
+
+		IntrusiveListHook(const IntrusiveListHook<TAG>&) throw() :
+			Previous(nullptr),
+			Next(nullptr)
+		{}
+
+		SOLAIRE_FORCE_INLINE IntrusiveListHook<TAG>& SOLAIRE_DEFAULT_CALL operator=(const IntrusiveListHook<TAG>&) throw() {
+			return *this;
+		}
+
+		SOLAIRE_FORCE_INLINE bool SOLAIRE_DEFAULT_CALL IsLinked() const throw() {
+			return Next != nullptr;
+		}
+	};
+
+	namespace Implementation {
+		template<class H>
+		inline SOLAIRE_FORCE_INLINE void SOLAIRE_DEFAULT_CALL LinkBefore(H* const aPosition, H* const aNode) throw() {
+			aNode->Next = aPosition;
+			aNode->Previous = aPosition->Previous;
+			aPosition->Previous->Next = aNode;
+			aPosition->Previous = aNode;
+		}
+
+		template<class H>
+		inline SOLAIRE_FORCE_INLINE void SOLAIRE_DEFAULT_CALL Unlink(H* const aNode) throw() {
+			aNode->Previous->Next = aNode->Next;
+			aNode->Next->Previous = aNode->Previous;
+			aNode->Previous = nullptr;
+			aNode->Next = nullptr;
+		}
+
+		/*!
+			\brief Move the nodes [\a aFirst, \a aLast] before another node, which may be in a different list.
+		*/
+		template<class H>
+		inline SOLAIRE_FORCE_INLINE void SOLAIRE_DEFAULT_CALL SpliceBefore(H* const aPosition, H* const aFirst, H* const aLast) throw() {
+			aFirst->Previous->Next = aLast->Next;
+			aLast->Next->Previous = aFirst->Previous;
+
+			aFirst->Previous = aPosition->Previous;
+			aLast->Next = aPosition;
+			aPosition->Previous->Next = aFirst;
+			aPosition->Previous = aLast;
+		}
+	}
+
+	/*!
+		\class IntrusiveList
+		\brief A doubly linked list of objects that contain their own links, so adding and removing objects never allocates.
+		\detail
+		The list does not own its objects, an object must be erased before it is destroyed. Every operation except Clear is
+		O(1), including erasing an object, moving it to either end and splicing another list.
+		The list is circular around a sentinel hook, so no operation needs to check for the ends of the list.
+		\tparam T The object type, must inherit from IntrusiveListHook<TAG>.
+		\tparam TAG The tag of the hook that this list uses.
+		\author Adam Smith
+		\date Created : 18th October 2026
+		\date Modified : 18th October 2026
+		\version 1.0
+		\see IntrusiveListHook
+		\see LinkedList
+	*/
+	template<class T, class TAG = void>
+	class IntrusiveList {
+	public:
+		typedef IntrusiveListHook<TAG> Hook;
+	private:
+		Hook mHead;
+		uint32_t mSize;
+	private:
+		IntrusiveList(const IntrusiveList&) = delete;
+		IntrusiveList(IntrusiveList&&) = delete;
+		IntrusiveList& operator=(const IntrusiveList&) = delete;
+		IntrusiveList& operator=(IntrusiveList&&) = delete;
+
+		static SOLAIRE_FORCE_INLINE Hook* SOLAIRE_DEFAULT_CALL ToHook(T& aObject) throw() {
+			return static_cast<Hook*>(&aObject);
+		}
+
+		static SOLAIRE_FORCE_INLINE T* SOLAIRE_DEFAULT_CALL ToObject(Hook* const aHook) throw() {
+			return static_cast<T*>(aHook);
+		}
+
+		SOLAIRE_FORCE_INLINE Hook* SOLAIRE_DEFAULT_CALL GetPosition(T* const aPosition) throw() {
+			return aPosition ? ToHook(*aPosition) : &mHead;
+		}
+
+		SOLAIRE_FORCE_INLINE T* SOLAIRE_DEFAULT_CALL ToObjectOrNull(Hook* const aHook) const throw() {
+			return aHook == &mHead ? nullptr : ToObject(aHook);
+		}
+	public:
+		IntrusiveList() throw() :
+			mSize(0)
+		{
+			mHead.Previous = &mHead;
+			mHead.Next = &mHead;
+		}
+
+		/*!
+			\brief Unlink every object.
+		*/
+		~IntrusiveList() throw() {
+			Clear();
+		}
+
+		/*!
+			\brief Link an object before another object.
+			\param aPosition An object in this list, or nullptr to link at the back.
+			\param aObject An object that is not in a list using the same hook.
+		*/
+		SOLAIRE_FORCE_INLINE void SOLAIRE_DEFAULT_CALL InsertBefore(T* const aPosition, T& aObject) throw() {
+			Implementation::LinkBefore(GetPosition(aPosition), ToHook(aObject));
+			++mSize;
+		}
+
+		SOLAIRE_FORCE_INLINE void SOLAIRE_DEFAULT_CALL InsertAfter(T& aPosition, T& aObject) throw() {
+			Implementation::LinkBefore(ToHook(aPosition)->Next, ToHook(aObject));
+			++mSize;
+		}
+
+		SOLAIRE_FORCE_INLINE void SOLAIRE_DEFAULT_CALL PushBack(T& aObject) throw() {
+			Implementation::LinkBefore(&mHead, ToHook(aObject));
+			++mSize;
+		}
+
+		SOLAIRE_FORCE_INLINE void SOLAIRE_DEFAULT_CALL PushFront(T& aObject) throw() {
+			Implementation::LinkBefore(mHead.Next, ToHook(aObject));
+			++mSize;
+		}
+
+		/*!
+			\brief Unlink an object.
+			\param aObject An object in this list.
+		*/
+		SOLAIRE_FORCE_INLINE void SOLAIRE_DEFAULT_CALL Erase(T& aObject) throw() {
+			Implementation::Unlink(ToHook(aObject));
+			--mSize;
+		}
+
+		/*!
+			\brief Unlink the object at the front of the list.
+			\return The object, or nullptr if the list is empty.
+		*/
+		SOLAIRE_FORCE_INLINE T* SOLAIRE_DEFAULT_CALL PopFront() throw() {
+			T* const object = Front();
+			if(object) Erase(*object);
+			return object;
+		}
+
+		SOLAIRE_FORCE_INLINE T* SOLAIRE_DEFAULT_CALL PopBack() throw() {
+			T* const object = Back();
+			if(object) Erase(*object);
+			return object;
+		}
+
+		/*!
+			\brief Move an object in this list to the front, eg. when it is used in an LRU list.
+		*/
+		SOLAIRE_FORCE_INLINE void SOLAIRE_DEFAULT_CALL MoveToFront(T& aObject) throw() {
+			Hook* const hook = ToHook(aObject);
+			// SpliceBefore cannot insert a hook before itself
+			if(mHead.Next == hook) return;
+			Implementation::SpliceBefore(mHead.Next, hook, hook);
+		}
+
+		SOLAIRE_FORCE_INLINE void SOLAIRE_DEFAULT_CALL MoveToBack(T& aObject) throw() {
+			Hook* const hook = ToHook(aObject);
+			if(mHead.Previous == hook) return;
+			Implementation::SpliceBefore(&mHead, hook, hook);
+		}
+
+		/*!
+			\brief Move every object of another list into this list.
+			\param aPosition An object in this list, or nullptr to move the objects to the back.
+			\param aOther The list to move from, it is left empty.
+		*/
+		void SOLAIRE_DEFAULT_CALL Splice(T* const aPosition, IntrusiveList<T, TAG>& aOther) throw() {
+			if(aOther.mSize == 0 || &aOther == this) return;
+			Implementation::SpliceBefore(GetPosition(aPosition), aOther.mHead.Next, aOther.mHead.Previous);
+			mSize += aOther.mSize;
+			aOther.mSize = 0;
+		}
+
+		/*!
+			\brief Move one object of another list into this list.
+			\param aPosition An object in this list, or nullptr to move the object to the back.
+			\param aOther The list that contains \a aObject, may be this list.
+			\param aObject The object to move.
+		*/
+		void SOLAIRE_DEFAULT_CALL Splice(T* const aPosition, IntrusiveList<T, TAG>& aOther, T& aObject) throw() {
+			Hook* const hook = ToHook(aObject);
+			Hook* const position = GetPosition(aPosition);
+			if(position == hook) return;
+			Implementation::SpliceBefore(position, hook, hook);
+			--aOther.mSize;
+			++mSize;
+		}
+
+		/*!
+			\brief Unlink every object.
+		*/
+		void SOLAIRE_DEFAULT_CALL Clear() throw() {
+			Hook* hook = mHead.Next;
+			while(hook != &mHead) {
+				Hook* const next = hook->Next;
+				hook->Previous = nullptr;
+				hook->Next = nullptr;
+				hook = next;
+			}
+			mHead.Previous = &mHead;
+			mHead.Next = &mHead;
+			mSize = 0;
+		}
+
+		SOLAIRE_FORCE_INLINE T* SOLAIRE_DEFAULT_CALL Front() const throw() {
+			return ToObjectOrNull(mHead.Next);
+		}
+
+		SOLAIRE_FORCE_INLINE T* SOLAIRE_DEFAULT_CALL Back() const throw() {
+			return ToObjectOrNull(mHead.Previous);
+		}
+
+		// The object after aObject, or nullptr if aObject is at the back
+		SOLAIRE_FORCE_INLINE T* SOLAIRE_DEFAULT_CALL GetNext(T& aObject) const throw() {
+			return ToObjectOrNull(ToHook(aObject)->Next);
+		}
+
+		// The object before aObject, or nullptr if aObject is at the front
+		SOLAIRE_FORCE_INLINE T* SOLAIRE_DEFAULT_CALL GetPrevious(T& aObject) const throw() {
+			return ToObjectOrNull(ToHook(aObject)->Previous);
+		}
+
+		/*!
+			\brief Call a function on each object, from front to back.
+			\detail The function may erase the object that it is called on.
+			\param aFunction A function with the signature void(T& aObject).
+		*/
+		template<class F>
+		void SOLAIRE_DEFAULT_CALL ForEach(F aFunction) const {
+			Hook* hook = mHead.Next;
+			while(hook != &mHead) {
+				Hook* const next = hook->Next;
+				aFunction(*ToObject(hook));
+				hook = next;
+			}
+		}
+
+		SOLAIRE_FORCE_INLINE uint32_t SOLAIRE_DEFAULT_CALL Size() const throw() {
+			return mSize;
+		}
+
+		SOLAIRE_FORCE_INLINE bool SOLAIRE_DEFAULT_CALL IsEmpty() const throw() {
+			return mSize == 0;
+		}
+	};
+}
+
+#endif
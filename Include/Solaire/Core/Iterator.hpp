@@ -28,7 +28,7 @@
 	\version 1.0
 	\date
 	Created			: 3rd December 2015
-	Last Modified	: 3rd December 2015
+	Last Modified	: 18th October 2026
 */
 
 #include <cstdint>
@@ -88,18 +88,26 @@ namespace Solaire {
 		}
 	};
 
-	/*template<class ITERATOR, class T>
-	SOLAIRE_EXPORT_INTERFACE IteratorSTL : public Iterator<T>{
+	template<class ITERATOR, class T>
+	class IteratorSTL : public Iterator<T>{
+	public:
+		typedef typename Iterator<T>::Type Type;
+		typedef typename Iterator<T>::Offset Offset;
 	private:
-		const ITERATOR mBegin;
+		ITERATOR mBegin;
 		ITERATOR mCurrent;
 	protected:
 		//Inherited from Iterator
 
-		SOLAIRE_FORCE_INLINE Offset SOLAIRE_DEFAULT_CALL GetOffset() const throw() override {
+		Offset SOLAIRE_EXPORT_CALL GetOffset() const throw() override {
 			return mCurrent - mBegin;
 		}
 	public:
+		IteratorSTL() :
+			mBegin(),
+			mCurrent()
+		{}
+
 		IteratorSTL(const ITERATOR aCurrent) :
 			mBegin(aCurrent),
 			mCurrent(aCurrent)
@@ -116,33 +124,33 @@ namespace Solaire {
 
 		// Inherited from Iterator
 
-		SOLAIRE_FORCE_INLINE Type* SOLAIRE_DEFAULT_CALL operator->() throw() {
+		Type* SOLAIRE_EXPORT_CALL operator->() throw() override {
 			return &*mCurrent;
 		}
 
-		SOLAIRE_FORCE_INLINE Iterator<Type>& SOLAIRE_DEFAULT_CALL operator++() throw() {
+		Iterator<Type>& SOLAIRE_EXPORT_CALL operator++() throw() override {
 			++mCurrent;
 			return *this;
 		}
 
-		SOLAIRE_FORCE_INLINE Iterator<Type>& SOLAIRE_DEFAULT_CALL operator--() throw() {
+		Iterator<Type>& SOLAIRE_EXPORT_CALL operator--() throw() override {
 			--mCurrent;
 			return *this;
 		}
 
-		SOLAIRE_FORCE_INLINE Iterator<Type>& SOLAIRE_DEFAULT_CALL operator+=(const Offset aOffset) throw() {
+		Iterator<Type>& SOLAIRE_EXPORT_CALL operator+=(const Offset aOffset) throw() override {
 			mCurrent += aOffset;
 			return *this;
 		}
 
-		SOLAIRE_FORCE_INLINE Iterator<Type>& SOLAIRE_DEFAULT_CALL operator-=(const Offset aOffset) throw() override {
+		Iterator<Type>& SOLAIRE_EXPORT_CALL operator-=(const Offset aOffset) throw() override {
 			mCurrent -= aOffset;
 			return *this;
 		}
 	};
 
 	template<class T>
-	using IteratorPtr = IteratorSTL<T*, T>;*/
+	using IteratorPtr = IteratorSTL<T*, T>;
 }
 
 
@@ -0,0 +1,542 @@
+#ifndef SOLAIRE_LINKED_LIST_HPP
+#define SOLAIRE_LINKED_LIST_HPP
+
+//Copyright 2015 Adam Smith
+//
+//Licensed under the Apache License, Version 2.0 (the "License");
+//you may not use this file except in compliance with the License.
+//You may obtain a copy of the License at
+//
+//    http://www.apache.org/licenses/LICENSE-2.0
+//
+//Unless required by applicable law or agreed to in writing, software
+//distributed under the License is distributed on an "AS IS" BASIS,
+//WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//See the License for the specific language governing permissions and
+//limitations under the License.
+
+// Contact :
+// Email             : solairelibrary@mail.com
+// GitHub repository : https://github.com/SolaireLibrary/SolaireCPP
+
+/*!
+	\file LinkedList.hpp
+	\brief
+	\author
+	Created			: Adam Smith
+	Last modified	: Adam Smith
+	\version 1.0
+	\date
+	Created			: 18th October 2026
+	Last Modified	: 18th October 2026
+*/
+
+#include <new>
+#include <utility>
+#include <type_traits>
+#include "Allocator.hpp"
+#include "Container.hpp"
+#include "PoolAllocator.hpp"
+#include "IntrusiveList.hpp"
+
+namespace Solaire {
+
+	/*!
+		\class LinkedList
+		\brief A List that stores each element in its own node, nodes are allocated from a PoolAllocator.
+		\detail
+		Inserting and erasing never moves other elements, so the address of an element is stable until it is erased.
+		The list creates its own pool the first time that a node is allocated, or several lists can share one pool so that
+		Splice can move nodes between them in O(1).
+		Positions in the List interface are indices, so the iterator overloads walk the list in O(n). The node that was
+		last found by index is cached, so visiting the elements in order with operator[], GetChunk or an iterator is O(1)
+		per element. The node overloads (eg. Erase(Node&), MoveToFront, Splice) are always O(1) and are intended for LRU
+		and timer lists.
+		\tparam T The type of element stored in the list.
+		\author Adam Smith
+		\date Created : 18th October 2026
+		\date Modified : 18th October 2026
+		\version 1.0
+		\see IntrusiveList
+	*/
+	template<class T>
+	class LinkedList : public List<T> {
+	public:
+		typedef typename List<T>::Type Type;
+		typedef typename List<T>::ConstIterator ConstIterator;
+
+		struct Node : public IntrusiveListHook<> {
+			T Value;
+
+			template<class ...PARAMS>
+			Node(PARAMS&&... aParams) :
+				Value(std::forward<PARAMS>(aParams)...)
+			{}
+		};
+	private:
+		class BeginIterator : public Solaire::Iterator<T> {
+		public:
+			typedef typename Solaire::Iterator<T>::Type Type;
+			typedef typename Solaire::Iterator<T>::Offset Offset;
+		private:
+			LinkedList<T>* mList;
+			Offset mOffset;
+		protected:
+			//Inherited from Iterator
+
+			Offset SOLAIRE_EXPORT_CALL GetOffset() const throw() override {
+				return mOffset;
+			}
+		public:
+			BeginIterator(LinkedList<T>& aList) throw() :
+				mList(&aList),
+				mOffset(0)
+			{}
+
+			SOLAIRE_EXPORT_CALL ~BeginIterator() {
+
+			}
+
+			// Inherited from Iterator
+
+			Type* SOLAIRE_EXPORT_CALL operator->() throw() override {
+				return &mList->Seek(static_cast<uint32_t>(mOffset))->Value;
+			}
+
+			Solaire::Iterator<Type>& SOLAIRE_EXPORT_CALL operator++() throw() override {
+				++mOffset;
+				return *this;
+			}
+
+			Solaire::Iterator<Type>& SOLAIRE_EXPORT_CALL operator--() throw() override {
+				--mOffset;
+				return *this;
+			}
+
+			Solaire::Iterator<Type>& SOLAIRE_EXPORT_CALL operator+=(const Offset aOffset) throw() override {
+				mOffset += aOffset;
+				return *this;
+			}
+
+			Solaire::Iterator<Type>& SOLAIRE_EXPORT_CALL operator-=(const Offset aOffset) throw() override {
+				mOffset -= aOffset;
+				return *this;
+			}
+		};
+	private:
+		Allocator* mAllocator;
+		PoolAllocator* mPool;
+		bool mOwnsPool;
+		IntrusiveList<Node> mNodes;
+		mutable Node* mCursor;
+		mutable uint32_t mCursorIndex;
+		BeginIterator mBeginIterator;
+	private:
+		PoolAllocator& SOLAIRE_DEFAULT_CALL GetPool() {
+			if(mPool == nullptr) {
+				mPool = mAllocator->RawAllocate<PoolAllocator>(*mAllocator, static_cast<uint32_t>(sizeof(Node)), static_cast<uint32_t>(std::alignment_of<Node>::value));
+				SolaireRuntimeAssert(mPool != nullptr, "SolaireCPP : LinkedList failed to allocate memory");
+				mOwnsPool = true;
+			}
+			return *mPool;
+		}
+
+		void SOLAIRE_DEFAULT_CALL DestroyPool() throw() {
+			if(mOwnsPool) {
+				mPool->~PoolAllocator();
+				mAllocator->Deallocate(mPool);
+			}
+			mPool = nullptr;
+			mOwnsPool = false;
+		}
+
+		template<class ...PARAMS>
+		Node* SOLAIRE_DEFAULT_CALL AllocateNode(PARAMS&&... aParams) {
+			void* const block = GetPool().Allocate(sizeof(Node));
+			SolaireRuntimeAssert(block != nullptr, "SolaireCPP : LinkedList failed to allocate memory");
+			mCursor = nullptr;
+			return new(block) Node(std::forward<PARAMS>(aParams)...);
+		}
+
+		void SOLAIRE_DEFAULT_CALL DestroyNode(Node& aNode) throw() {
+			mNodes.Erase(aNode);
+			mCursor = nullptr;
+			aNode.~Node();
+			mPool->Deallocate(&aNode);
+		}
+
+		T SOLAIRE_DEFAULT_CALL RemoveNode(Node& aNode) {
+			T tmp(std::move(aNode.Value));
+			DestroyNode(aNode);
+			return tmp;
+		}
+
+		/*!
+			\brief Find the node at an index, starting from whichever of the front, the back or the cached node is closest.
+		*/
+		Node* SOLAIRE_DEFAULT_CALL Seek(const uint32_t aIndex) const throw() {
+			const uint32_t size = mNodes.Size();
+			Node* node;
+			uint32_t index;
+
+			if(aIndex < size - 1 - aIndex) {
+				node = mNodes.Front();
+				index = 0;
+			}else {
+				node = mNodes.Back();
+				index = size - 1;
+			}
+
+			if(mCursor && (aIndex > mCursorIndex ? aIndex - mCursorIndex : mCursorIndex - aIndex) < (aIndex > index ? aIndex - index : index - aIndex)) {
+				node = mCursor;
+				index = mCursorIndex;
+			}
+
+			while(index < aIndex) {
+				node = mNodes.GetNext(*node);
+				++index;
+			}
+			while(index > aIndex) {
+				node = mNodes.GetPrevious(*node);
+				--index;
+			}
+
+			mCursor = node;
+			mCursorIndex = aIndex;
+			return node;
+		}
+
+		uint32_t SOLAIRE_DEFAULT_CALL GetIndex(const ConstIterator aPosition) {
+			return static_cast<uint32_t>(aPosition - this->begin());
+		}
+
+		// The node at an index, or nullptr if the index is the end of the list
+		SOLAIRE_FORCE_INLINE Node* SOLAIRE_DEFAULT_CALL GetPosition(const uint32_t aIndex) const throw() {
+			return aIndex >= mNodes.Size() ? nullptr : Seek(aIndex);
+		}
+
+		/*!
+			\brief Move the nodes of another list into this empty list.
+		*/
+		void SOLAIRE_DEFAULT_CALL TakeNodes(LinkedList<T>& aOther) {
+			if(mPool == aOther.mPool && ! mOwnsPool) {
+				// Both lists share a pool, or neither has allocated a node
+			}else if(aOther.mOwnsPool) {
+				DestroyPool();
+				mPool = aOther.mPool;
+				mOwnsPool = true;
+				aOther.mPool = nullptr;
+				aOther.mOwnsPool = false;
+			}else {
+				// The nodes belong to a pool that this list cannot use
+				Node* node = aOther.mNodes.Front();
+				while(node) {
+					mNodes.PushBack(*AllocateNode(std::move(node->Value)));
+					node = aOther.mNodes.GetNext(*node);
+				}
+				aOther.Clear();
+				return;
+			}
+
+			mNodes.Splice(nullptr, aOther.mNodes);
+			mCursor = nullptr;
+			aOther.mCursor = nullptr;
+		}
+	public:
+		/*!
+			\brief Create an empty list with its own pool, no memory is allocated until the first element is added.
+			\param aAllocator The allocator that the pool will allocate from.
+		*/
+		LinkedList(Allocator& aAllocator) throw() :
+			mAllocator(&aAllocator),
+			mPool(nullptr),
+			mOwnsPool(false),
+			mCursor(nullptr),
+			mCursorIndex(0),
+			mBeginIterator(*this)
+		{}
+
+		/*!
+			\brief Create an empty list that allocates its nodes from a pool that other lists may share.
+			\param aAllocator The allocator returned by GetAllocator.
+			\param aPool The pool to allocate nodes from, its block size must be at least sizeof(Node) and it must outlive the list.
+		*/
+		LinkedList(Allocator& aAllocator, PoolAllocator& aPool) throw() :
+			mAllocator(&aAllocator),
+			mPool(&aPool),
+			mOwnsPool(false),
+			mCursor(nullptr),
+			mCursorIndex(0),
+			mBeginIterator(*this)
+		{
+			SolaireRuntimeAssert(aPool.GetBlockSize() >= sizeof(Node), "SolaireCPP : LinkedList pool blocks are too small");
+		}
+
+		LinkedList(const LinkedList<T>& aOther) :
+			mAllocator(aOther.mAllocator),
+			mPool(aOther.mOwnsPool ? nullptr : aOther.mPool),
+			mOwnsPool(false),
+			mCursor(nullptr),
+			mCursorIndex(0),
+			mBeginIterator(*this)
+		{
+			operator=(static_cast<const FixedContainer<T>&>(aOther));
+		}
+
+		LinkedList(LinkedList<T>&& aOther) :
+			mAllocator(aOther.mAllocator),
+			mPool(aOther.mOwnsPool ? nullptr : aOther.mPool),
+			mOwnsPool(false),
+			mCursor(nullptr),
+			mCursorIndex(0),
+			mBeginIterator(*this)
+		{
+			TakeNodes(aOther);
+		}
+
+		SOLAIRE_EXPORT_CALL ~LinkedList() {
+			Clear();
+			if(mPool) DestroyPool();
+		}
+
+		LinkedList<T>& SOLAIRE_DEFAULT_CALL operator=(const LinkedList<T>& aOther) {
+			operator=(static_cast<const FixedContainer<T>&>(aOther));
+			return *this;
+		}
+
+		LinkedList<T>& SOLAIRE_DEFAULT_CALL operator=(LinkedList<T>&& aOther) {
+			if(&aOther == this) return *this;
+			Clear();
+			TakeNodes(aOther);
+			return *this;
+		}
+
+		/*!
+			\brief Construct a new element at the back of the list.
+			\tparam PARAMS The parameter types to pass to the element's constructor.
+			\param aParams The parameters to pass to the element's constructor.
+			\return The new element.
+		*/
+		template<class ...PARAMS>
+		SOLAIRE_FORCE_INLINE T& SOLAIRE_DEFAULT_CALL EmplaceBack(PARAMS&&... aParams) {
+			return EmplaceBefore(nullptr, std::forward<PARAMS>(aParams)...).Value;
+		}
+
+		template<class ...PARAMS>
+		SOLAIRE_FORCE_INLINE T& SOLAIRE_DEFAULT_CALL EmplaceFront(PARAMS&&... aParams) {
+			return EmplaceBefore(mNodes.Front(), std::forward<PARAMS>(aParams)...).Value;
+		}
+
+		/*!
+			\brief Construct a new element before a node.
+			\tparam PARAMS The parameter types to pass to the element's constructor.
+			\param aPosition A node in this list, or nullptr to construct the element at the back.
+			\param aParams The parameters to pass to the element's constructor.
+			\return The node of the new element.
+		*/
+		template<class ...PARAMS>
+		Node& SOLAIRE_DEFAULT_CALL EmplaceBefore(Node* const aPosition, PARAMS&&... aParams) {
+			Node* const node = AllocateNode(std::forward<PARAMS>(aParams)...);
+			mNodes.InsertBefore(aPosition, *node);
+			return *node;
+		}
+
+		using List<T>::PushBackRange;
+
+		/*!
+			\brief Call a function on each element, in order.
+			\detail This walks the nodes directly rather than calling GetChunk once per element.
+			\param aFunction A function with the signature void(T& aElement).
+		*/
+		template<class F>
+		void SOLAIRE_DEFAULT_CALL ForEach(F aFunction) {
+			mNodes.ForEach([&aFunction](Node& aNode) {
+				aFunction(aNode.Value);
+			});
+		}
+
+		template<class F>
+		void SOLAIRE_DEFAULT_CALL ForEach(F aFunction) const {
+			mNodes.ForEach([&aFunction](const Node& aNode) {
+				aFunction(aNode.Value);
+			});
+		}
+
+		SOLAIRE_FORCE_INLINE const T& SOLAIRE_DEFAULT_CALL operator[](const uint32_t aIndex) const throw() {
+			return Seek(aIndex)->Value;
+		}
+
+		/*!
+			\brief Destroy an element.
+			\param aNode A node in this list.
+		*/
+		SOLAIRE_FORCE_INLINE void SOLAIRE_DEFAULT_CALL Erase(Node& aNode) throw() {
+			DestroyNode(aNode);
+		}
+
+		// Move a node to one end of the list without reallocating it, eg. when an LRU entry is used
+
+		SOLAIRE_FORCE_INLINE void SOLAIRE_DEFAULT_CALL MoveToFront(Node& aNode) throw() {
+			mNodes.MoveToFront(aNode);
+			mCursor = nullptr;
+		}
+
+		SOLAIRE_FORCE_INLINE void SOLAIRE_DEFAULT_CALL MoveToBack(Node& aNode) throw() {
+			mNodes.MoveToBack(aNode);
+			mCursor = nullptr;
+		}
+
+		/*!
+			\brief Move every element of another list into this list without reallocating them.
+			\param aPosition A node in this list, or nullptr to move the elements to the back.
+			\param aOther The list to move from, it must allocate from the same pool as this list.
+		*/
+		void SOLAIRE_DEFAULT_CALL Splice(Node* const aPosition, LinkedList<T>& aOther) throw() {
+			SolaireRuntimeAssert(aOther.mNodes.IsEmpty() || aOther.mPool == mPool, "SolaireCPP : LinkedList can only splice lists that share a pool");
+			mNodes.Splice(aPosition, aOther.mNodes);
+			mCursor = nullptr;
+			aOther.mCursor = nullptr;
+		}
+
+		/*!
+			\brief Move one element of another list into this list without reallocating it.
+			\param aPosition A node in this list, or nullptr to move the element to the back.
+			\param aOther The list that contains \a aNode, it must allocate from the same pool as this list.
+			\param aNode The node to move.
+		*/
+		void SOLAIRE_DEFAULT_CALL Splice(Node* const aPosition, LinkedList<T>& aOther, Node& aNode) throw() {
+			SolaireRuntimeAssert(aOther.mPool == mPool, "SolaireCPP : LinkedList can only splice lists that share a pool");
+			mNodes.Splice(aPosition, aOther.mNodes, aNode);
+			mCursor = nullptr;
+			aOther.mCursor = nullptr;
+		}
+
+		// The first or last node, or nullptr if the list is empty
+
+		SOLAIRE_FORCE_INLINE Node* SOLAIRE_DEFAULT_CALL GetFirstNode() const throw() {
+			return mNodes.Front();
+		}
+
+		SOLAIRE_FORCE_INLINE Node* SOLAIRE_DEFAULT_CALL GetLastNode() const throw() {
+			return mNodes.Back();
+		}
+
+		// The neighbour of a node, or nullptr if the node is at that end of the list
+
+		SOLAIRE_FORCE_INLINE Node* SOLAIRE_DEFAULT_CALL GetNext(Node& aNode) const throw() {
+			return mNodes.GetNext(aNode);
+		}
+
+		SOLAIRE_FORCE_INLINE Node* SOLAIRE_DEFAULT_CALL GetPrevious(Node& aNode) const throw() {
+			return mNodes.GetPrevious(aNode);
+		}
+
+		SOLAIRE_FORCE_INLINE PoolAllocator* SOLAIRE_DEFAULT_CALL GetPoolAllocator() const throw() {
+			return mPool;
+		}
+
+		// Inherited from FixedContainer
+
+		uint32_t SOLAIRE_EXPORT_CALL Size() const override {
+			return mNodes.Size();
+		}
+
+		Type& SOLAIRE_EXPORT_CALL operator[](const uint32_t aIndex) override {
+			return Seek(aIndex)->Value;
+		}
+
+		bool SOLAIRE_EXPORT_CALL IsContiguous() const override {
+			return mNodes.Size() <= 1;
+		}
+
+		Allocator& SOLAIRE_EXPORT_CALL GetAllocator() const override {
+			return *mAllocator;
+		}
+
+		bool SOLAIRE_EXPORT_CALL Reserve(const uint32_t aCapacity) override {
+			const uint32_t size = mNodes.Size();
+			if(aCapacity <= size) return true;
+			return GetPool().Reserve(aCapacity - size);
+		}
+
+		Solaire::Iterator<T>& SOLAIRE_EXPORT_CALL GetBeginIterator() override {
+			mBeginIterator = BeginIterator(*this);
+			return mBeginIterator;
+		}
+
+		Type* SOLAIRE_EXPORT_CALL GetChunk(const uint32_t aIndex, uint32_t& aLength) override {
+			aLength = 1;
+			return &Seek(aIndex)->Value;
+		}
+
+		// Inherited from Stack
+
+		Type& SOLAIRE_EXPORT_CALL PushBack(const Type& aValue) override {
+			return EmplaceBack(aValue);
+		}
+
+		Type& SOLAIRE_EXPORT_CALL PushBack(Type&& aValue) override {
+			return EmplaceBack(std::move(aValue));
+		}
+
+		void SOLAIRE_EXPORT_CALL PushBackRange(const Type* const aValues, const uint32_t aCount) override {
+			for(uint32_t i = 0; i < aCount; ++i) EmplaceBack(aValues[i]);
+		}
+
+		Type SOLAIRE_EXPORT_CALL PopBack() override {
+			SolaireRuntimeAssert(! mNodes.IsEmpty(), "SolaireCPP : LinkedList::PopBack called on an empty list");
+			return RemoveNode(*mNodes.Back());
+		}
+
+		Stack<T>& SOLAIRE_EXPORT_CALL operator=(const FixedContainer<T>& aOther) override {
+			if(&aOther == this) return *this;
+			Clear();
+			PushBackRange(aOther);
+			return *this;
+		}
+
+		void SOLAIRE_EXPORT_CALL Clear() override {
+			while(! mNodes.IsEmpty()) DestroyNode(*mNodes.Front());
+		}
+
+		// Inherited from DoubleEndedStack
+
+		Type& SOLAIRE_EXPORT_CALL PushFront(const Type& aValue) override {
+			return EmplaceFront(aValue);
+		}
+
+		Type& SOLAIRE_EXPORT_CALL PushFront(Type&& aValue) override {
+			return EmplaceFront(std::move(aValue));
+		}
+
+		Type SOLAIRE_EXPORT_CALL PopFront() override {
+			SolaireRuntimeAssert(! mNodes.IsEmpty(), "SolaireCPP : LinkedList::PopFront called on an empty list");
+			return RemoveNode(*mNodes.Front());
+		}
+
+		// Inherited from List
+
+		Type& SOLAIRE_EXPORT_CALL InsertBefore(const ConstIterator aPosition, const Type& aValue) override {
+			return EmplaceBefore(GetPosition(GetIndex(aPosition)), aValue).Value;
+		}
+
+		Type& SOLAIRE_EXPORT_CALL InsertAfter(const ConstIterator aPosition, const Type& aValue) override {
+			return EmplaceBefore(GetPosition(GetIndex(aPosition) + 1), aValue).Value;
+		}
+
+		bool SOLAIRE_EXPORT_CALL Erase(const ConstIterator aPosition) override {
+			Node* const node = GetPosition(GetIndex(aPosition));
+			if(node == nullptr) return false;
+			DestroyNode(*node);
+			return true;
+		}
+
+		void SOLAIRE_EXPORT_CALL InsertRange(const ConstIterator aPosition, const Type* const aValues, const uint32_t aCount) override {
+			Node* const position = GetPosition(GetIndex(aPosition));
+			for(uint32_t i = 0; i < aCount; ++i) EmplaceBefore(position, aValues[i]);
+		}
+	};
+
+}
+
+#endif
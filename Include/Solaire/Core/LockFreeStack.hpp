@@ -0,0 +1,429 @@
+#ifndef SOLAIRE_LOCK_FREE_STACK_HPP
+#define SOLAIRE_LOCK_FREE_STACK_HPP
+
+//Copyright 2015 Adam Smith
+//
+//Licensed under the Apache License, Version 2.0 (the "License");
+//you may not use this file except in compliance with the License.
+//You may obtain a copy of the License at
+//
+//    http://www.apache.org/licenses/LICENSE-2.0
+//
+//Unless required by applicable law or agreed to in writing, software
+//distributed under the License is distributed on an "AS IS" BASIS,
+//WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//See the License for the specific language governing permissions and
+//limitations under the License.
+
+// Contact :
+// Email             : solairelibrary@mail.com
+// GitHub repository : https://github.com/SolaireLibrary/SolaireCPP
+
+/*!
+	\file LockFreeStack.hpp
+	\brief
+	\author
+	Created			: Adam Smith
+	Last modified	: Adam Smith
+	\version 1.0
+	\date
+	Created			: 18th October 2026
+	Last Modified	: 18th October 2026
+*/
+
+#include <new>
+#include <atomic>
+#include <utility>
+#include <stdexcept>
+#include <type_traits>
+#ifndef SOLAIRE_DISABLE_MULTITHREADING
+	#include <mutex>
+#endif
+#include "Allocator.hpp"
+#include "Container.hpp"
+#include "Maths.hpp"
+
+namespace Solaire {
+
+	template<class T>
+	class LockFreeStackIterator : public Iterator<T> {
+	public:
+		typedef typename Iterator<T>::Type Type;
+		typedef typename Iterator<T>::Offset Offset;
+	private:
+		FixedContainer<T>* mContainer;
+		Offset mOffset;
+	protected:
+		//Inherited from Iterator
+		Offset SOLAIRE_EXPORT_CALL GetOffset() const throw() override {
+			return mOffset;
+		}
+	public:
+		LockFreeStackIterator(FixedContainer<T>& aContainer, const Offset aOffset) :
+			mContainer(&aContainer),
+			mOffset(aOffset)
+		{}
+
+		SOLAIRE_EXPORT_CALL ~LockFreeStackIterator() {
+
+		}
+
+		// Inherited from Iterator
+
+		Type* SOLAIRE_EXPORT_CALL operator->() throw() override final {
+			return &mContainer->operator[](static_cast<uint32_t>(mOffset));
+		}
+
+		Iterator<Type>& SOLAIRE_EXPORT_CALL operator++() throw() override final {
+			++mOffset;
+			return *this;
+		}
+
+		Iterator<Type>& SOLAIRE_EXPORT_CALL operator--() throw() override final {
+			--mOffset;
+			return *this;
+		}
+
+		Iterator<Type>& SOLAIRE_EXPORT_CALL operator+=(const Offset aOffset) throw() override final {
+			mOffset += aOffset;
+			return *this;
+		}
+
+		Iterator<Type>& SOLAIRE_EXPORT_CALL operator-=(const Offset aOffset) throw() override final {
+			mOffset -= aOffset;
+			return *this;
+		}
+
+		SOLAIRE_FORCE_INLINE Type& SOLAIRE_DEFAULT_CALL operator*() throw() {
+			return *operator->();
+		}
+	};
+
+	/*!
+		\class LockFreeStack
+		\brief A Treiber stack that any number of threads can push to and pop from without locking.
+		\detail
+		Nodes are referred to by a 32 bit index, the head of the stack packs the index of the top node with a 32 bit tag
+		that is incremented by every successful CAS, so a node that is popped and pushed again between another thread's
+		read and CAS does not corrupt the stack (the ABA problem).
+		Nodes are allocated in chunks that double in size and are never freed or moved while the stack exists, so a thread
+		can always safely read a node that another thread has just popped. Popped nodes are kept on a second tagged free
+		list and reused.
+
+		PushBack, EmplaceBack, PushBackRange, TryPop, PopBack and PopAll are safe to call from any thread.
+		Size is approximate while other threads are using the stack. The rest of the Stack and FixedContainer interface,
+		including indexing and iteration, walks the chain from the top and may only be used while no other thread is
+		modifying the stack. Element 0 is the bottom of the stack, so indexing is O(n) and Back is O(1).
+		\tparam T The type of element stored in the stack.
+		\author Adam Smith
+		\date Created : 18th October 2026
+		\date Modified : 18th October 2026
+		\version 1.0
+	*/
+	template<class T>
+	class LockFreeStack : public Stack<T> {
+	public:
+		typedef typename Stack<T>::Type Type;
+	private:
+		enum : uint32_t {
+			NULL_INDEX = UINT32_MAX,
+			CACHE_LINE = 64,
+			FIRST_CHUNK_SHIFT = 6,
+			MAX_CHUNKS = 32 - FIRST_CHUNK_SHIFT
+		};
+
+		struct Node {
+			std::atomic<uint32_t> Next;
+			typename std::aligned_storage<sizeof(T), std::alignment_of<T>::value>::type Value;
+		};
+
+		struct alignas(CACHE_LINE) Head {
+			std::atomic<uint64_t> Value;
+		};
+	private:
+		Allocator& mAllocator;
+		Head mTop;
+		Head mFree;
+		std::atomic<uint32_t> mSize;
+		std::atomic<uint32_t> mNodeCount;
+		std::atomic<Node*> mChunks[MAX_CHUNKS];
+		#ifndef SOLAIRE_DISABLE_MULTITHREADING
+			std::mutex mChunkLock;
+		#endif
+		LockFreeStackIterator<T> mBeginIterator;
+	private:
+		LockFreeStack(const LockFreeStack<T>&) = delete;
+		LockFreeStack(LockFreeStack<T>&&) = delete;
+		LockFreeStack<T>& operator=(LockFreeStack<T>&&) = delete;
+
+		static SOLAIRE_FORCE_INLINE uint32_t SOLAIRE_DEFAULT_CALL GetIndex(const uint64_t aHead) throw() {
+			return static_cast<uint32_t>(aHead);
+		}
+
+		static SOLAIRE_FORCE_INLINE uint64_t SOLAIRE_DEFAULT_CALL NextHead(const uint64_t aHead, const uint32_t aIndex) throw() {
+			return ((aHead >> 32) + 1) << 32 | aIndex;
+		}
+
+		// Chunk N holds 64 << N nodes and starts at node 64 * ((1 << N) - 1)
+
+		static SOLAIRE_FORCE_INLINE uint32_t SOLAIRE_DEFAULT_CALL GetChunkIndex(const uint32_t aIndex) throw() {
+			return 31 - CountLeadingZeros(static_cast<uint32_t>((aIndex >> FIRST_CHUNK_SHIFT) + 1));
+		}
+
+		static SOLAIRE_FORCE_INLINE uint32_t SOLAIRE_DEFAULT_CALL GetChunkBegin(const uint32_t aChunk) throw() {
+			return ((1 << aChunk) - 1) << FIRST_CHUNK_SHIFT;
+		}
+
+		SOLAIRE_FORCE_INLINE Node& SOLAIRE_DEFAULT_CALL GetNode(const uint32_t aIndex) const throw() {
+			const uint32_t chunk = GetChunkIndex(aIndex);
+			return mChunks[chunk].load(std::memory_order_acquire)[aIndex - GetChunkBegin(chunk)];
+		}
+
+		SOLAIRE_FORCE_INLINE T& SOLAIRE_DEFAULT_CALL GetValue(const uint32_t aIndex) const throw() {
+			return *reinterpret_cast<T*>(&GetNode(aIndex).Value);
+		}
+
+		void SOLAIRE_DEFAULT_CALL AllocateChunk(const uint32_t aChunk) {
+			SolaireSynchronized(mChunkLock,
+				if(mChunks[aChunk].load(std::memory_order_relaxed) == nullptr) {
+					const uint32_t count = 1 << (aChunk + FIRST_CHUNK_SHIFT);
+					Node* const nodes = static_cast<Node*>(mAllocator.Allocate(sizeof(Node) * count));
+					SolaireRuntimeAssert(nodes != nullptr, "SolaireCPP : LockFreeStack failed to allocate memory");
+					for(uint32_t i = 0; i < count; ++i) new(&nodes[i].Next) std::atomic<uint32_t>(NULL_INDEX);
+					mChunks[aChunk].store(nodes, std::memory_order_release);
+				}
+			)
+		}
+
+		uint32_t SOLAIRE_DEFAULT_CALL AllocateNode() {
+			uint32_t index;
+			if(PopChain(mFree, index)) return index;
+
+			index = mNodeCount++;
+			SolaireRuntimeAssert(index != NULL_INDEX, "SolaireCPP : LockFreeStack node limit reached");
+			const uint32_t chunk = GetChunkIndex(index);
+			if(mChunks[chunk].load(std::memory_order_acquire) == nullptr) AllocateChunk(chunk);
+			return index;
+		}
+
+		/*!
+			\brief Link a chain of nodes onto the top of a list.
+			\param aHead The list.
+			\param aFirst The node that will be the new top.
+			\param aLast The bottom node of the chain, its link will be overwritten.
+		*/
+		void SOLAIRE_DEFAULT_CALL PushChain(Head& aHead, const uint32_t aFirst, const uint32_t aLast) throw() {
+			std::atomic<uint32_t>& link = GetNode(aLast).Next;
+			uint64_t head = aHead.Value.load(std::memory_order_relaxed);
+			do {
+				link.store(GetIndex(head), std::memory_order_relaxed);
+			}while(! aHead.Value.compare_exchange_weak(head, NextHead(head, aFirst), std::memory_order_release, std::memory_order_relaxed));
+		}
+
+		bool SOLAIRE_DEFAULT_CALL PopChain(Head& aHead, uint32_t& aIndex) throw() {
+			uint64_t head = aHead.Value.load(std::memory_order_acquire);
+			while(true) {
+				const uint32_t index = GetIndex(head);
+				if(index == NULL_INDEX) return false;
+				// The node may be popped and reused before the CAS, in which case the tag will have changed
+				const uint32_t next = GetNode(index).Next.load(std::memory_order_relaxed);
+				if(aHead.Value.compare_exchange_weak(head, NextHead(head, next), std::memory_order_acquire, std::memory_order_acquire)) {
+					aIndex = index;
+					return true;
+				}
+			}
+		}
+
+		void SOLAIRE_DEFAULT_CALL ReleaseNode(const uint32_t aIndex) throw() {
+			PushChain(mFree, aIndex, aIndex);
+		}
+	public:
+		LockFreeStack(Allocator& aAllocator) :
+			mAllocator(aAllocator),
+			mSize(0),
+			mNodeCount(0),
+			mBeginIterator(*this, 0)
+		{
+			mTop.Value = NULL_INDEX;
+			mFree.Value = NULL_INDEX;
+			for(uint32_t i = 0; i < MAX_CHUNKS; ++i) mChunks[i] = nullptr;
+		}
+
+		LockFreeStack<T>& SOLAIRE_DEFAULT_CALL operator=(const LockFreeStack<T>& aOther) {
+			operator=(static_cast<const FixedContainer<T>&>(aOther));
+			return *this;
+		}
+
+		SOLAIRE_EXPORT_CALL ~LockFreeStack() {
+			Clear();
+			for(uint32_t i = 0; i < MAX_CHUNKS; ++i) {
+				Node* const nodes = mChunks[i].load(std::memory_order_relaxed);
+				if(nodes != nullptr) mAllocator.Deallocate(nodes);
+			}
+		}
+
+		/*!
+			\brief Construct an element in place on the top of the stack.
+			\detail The returned reference is only valid until another thread pops the element.
+			\tparam PARAMS The parameter types to pass to the element's constructor.
+			\param aParams The parameters to pass to the element's constructor.
+			\return The new element.
+		*/
+		template<class ...PARAMS>
+		Type& SOLAIRE_DEFAULT_CALL EmplaceBack(PARAMS&&... aParams) {
+			const uint32_t index = AllocateNode();
+			T* const value = new(&GetNode(index).Value) T(std::forward<PARAMS>(aParams)...);
+			++mSize;
+			PushChain(mTop, index, index);
+			return *value;
+		}
+
+		/*!
+			\brief Pop the top element of the stack.
+			\param aValue Assigned the element.
+			\return False if the stack is empty.
+		*/
+		bool SOLAIRE_DEFAULT_CALL TryPop(T& aValue) {
+			uint32_t index;
+			if(! PopChain(mTop, index)) return false;
+			--mSize;
+			T& value = GetValue(index);
+			aValue = std::move(value);
+			value.~T();
+			ReleaseNode(index);
+			return true;
+		}
+
+		/*!
+			\brief Remove every element with a single CAS, then call a function on each of them from top to bottom.
+			\detail Elements pushed by other threads while the function is running stay on the stack.
+			\param aFunction A function with the signature void(T& aElement), the element is destroyed after the call.
+			\return The number of elements that were removed.
+		*/
+		template<class F>
+		uint32_t SOLAIRE_DEFAULT_CALL PopAll(F aFunction) {
+			uint64_t head = mTop.Value.load(std::memory_order_acquire);
+			while(GetIndex(head) != NULL_INDEX) {
+				if(mTop.Value.compare_exchange_weak(head, NextHead(head, NULL_INDEX), std::memory_order_acquire, std::memory_order_acquire)) break;
+			}
+
+			const uint32_t first = GetIndex(head);
+			if(first == NULL_INDEX) return 0;
+
+			// The chain is now private, so its links can be read without racing other threads
+			uint32_t count = 0;
+			uint32_t last = first;
+			uint32_t index = first;
+			while(index != NULL_INDEX) {
+				T& value = GetValue(index);
+				aFunction(value);
+				value.~T();
+				last = index;
+				index = GetNode(index).Next.load(std::memory_order_relaxed);
+				++count;
+			}
+
+			mSize -= count;
+			PushChain(mFree, first, last);
+			return count;
+		}
+
+		// Inherited from Stack
+
+		Type& SOLAIRE_EXPORT_CALL PushBack(const Type& aValue) override {
+			return EmplaceBack(aValue);
+		}
+
+		Type& SOLAIRE_EXPORT_CALL PushBack(Type&& aValue) override {
+			return EmplaceBack(std::move(aValue));
+		}
+
+		Type SOLAIRE_EXPORT_CALL PopBack() override {
+			uint32_t index;
+			SolaireRuntimeAssert(PopChain(mTop, index), "SolaireCPP : LockFreeStack::PopBack called on an empty stack");
+			--mSize;
+			T& value = GetValue(index);
+			T tmp(std::move(value));
+			value.~T();
+			ReleaseNode(index);
+			return tmp;
+		}
+
+		Stack<T>& SOLAIRE_EXPORT_CALL operator=(const FixedContainer<T>& aOther) override {
+			if(&aOther == this) return *this;
+			Clear();
+			Stack<T>::PushBackRange(aOther);
+			return *this;
+		}
+
+		void SOLAIRE_EXPORT_CALL Clear() override {
+			PopAll([](T&) {});
+		}
+
+		/*!
+			\brief Copy an array of elements onto the top of the stack, they are published to other threads with a single CAS.
+			\param aValues The address of the first element to copy, this will be the lowest of the new elements.
+			\param aCount The number of elements to copy.
+		*/
+		void SOLAIRE_EXPORT_CALL PushBackRange(const Type* const aValues, const uint32_t aCount) override {
+			if(aCount == 0) return;
+
+			// Build a private chain, each node links to the one for the previous value
+			const uint32_t last = AllocateNode();
+			new(&GetNode(last).Value) T(aValues[0]);
+			uint32_t first = last;
+			for(uint32_t i = 1; i < aCount; ++i) {
+				const uint32_t index = AllocateNode();
+				new(&GetNode(index).Value) T(aValues[i]);
+				GetNode(index).Next.store(first, std::memory_order_relaxed);
+				first = index;
+			}
+
+			mSize += aCount;
+			PushChain(mTop, first, last);
+		}
+
+		using Stack<T>::PushBackRange;
+
+		// Inherited from FixedContainer
+
+		uint32_t SOLAIRE_EXPORT_CALL Size() const override {
+			return mSize.load(std::memory_order_relaxed);
+		}
+
+		Type& SOLAIRE_EXPORT_CALL operator[](const uint32_t aIndex) override {
+			uint32_t index = GetIndex(mTop.Value.load(std::memory_order_acquire));
+			for(uint32_t i = Size() - 1; i > aIndex; --i) index = GetNode(index).Next.load(std::memory_order_relaxed);
+			return GetValue(index);
+		}
+
+		bool SOLAIRE_EXPORT_CALL IsContiguous() const override {
+			return false;
+		}
+
+		Allocator& SOLAIRE_EXPORT_CALL GetAllocator() const override {
+			return mAllocator;
+		}
+
+		bool SOLAIRE_EXPORT_CALL Reserve(const uint32_t aCapacity) override {
+			// Allocate every chunk that holds one of the first aCapacity nodes
+			uint32_t chunk = 0;
+			while(chunk < MAX_CHUNKS && GetChunkBegin(chunk) < aCapacity) {
+				if(mChunks[chunk].load(std::memory_order_acquire) == nullptr) AllocateChunk(chunk);
+				++chunk;
+			}
+			return true;
+		}
+
+		Solaire::Iterator<T>& SOLAIRE_EXPORT_CALL GetBeginIterator() override {
+			return mBeginIterator;
+		}
+
+		Type* SOLAIRE_EXPORT_CALL GetChunk(const uint32_t aIndex, uint32_t& aLength) override {
+			aLength = 1;
+			return &operator[](aIndex);
+		}
+	};
+}
+
+#endif
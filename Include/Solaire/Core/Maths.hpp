@@ -28,10 +28,15 @@
 	\version 1.0
 	\date
 	Created			: 26th September 2015
-	Last Modified	: 5th January 2016
+	Last Modified	: 18th October 2026
 */
 
 #include <cstdint>
+#include "ModuleHeader.hpp"
+
+#if SOLAIRE_COMPILER == SOLAIRE_MSVC
+	#include <intrin.h>
+#endif
 
 namespace Solaire{
 
@@ -219,6 +224,66 @@ namespace Solaire{
 		return aValue == 0 ? false : (aValue & (aValue - 1)) == 0;
 	}
 
+	namespace Implementation {
+		static constexpr uint32_t SmearBitsRight(const uint32_t aValue, const uint32_t aShift) throw() {
+			return aShift > 16 ? aValue : SmearBitsRight(aValue | (aValue >> aShift), aShift << 1);
+		}
+	}
+
+	static constexpr uint32_t NextPowerOfTwo(const uint32_t aValue) throw() {
+		return aValue <= 1 ? 1 : Implementation::SmearBitsRight(aValue - 1, 1) + 1;
+	}
+
+	////
+
+	/*!
+		\brief Count the zero bits below the lowest set bit.
+		\param aValue The value to check, must not be 0.
+		\return The index of the lowest set bit.
+	*/
+	inline uint32_t CountTrailingZeros(const uint32_t aValue) throw() {
+		#if SOLAIRE_COMPILER == SOLAIRE_MSVC
+			unsigned long index;
+			_BitScanForward(&index, aValue);
+			return index;
+		#else
+			return __builtin_ctz(aValue);
+		#endif
+	}
+
+	inline uint32_t CountTrailingZeros(const uint64_t aValue) throw() {
+		#if SOLAIRE_COMPILER == SOLAIRE_MSVC
+			const uint32_t low = static_cast<uint32_t>(aValue);
+			return low != 0 ? CountTrailingZeros(low) : 32 + CountTrailingZeros(static_cast<uint32_t>(aValue >> 32L));
+		#else
+			return __builtin_ctzll(aValue);
+		#endif
+	}
+
+	/*!
+		\brief Count the zero bits above the highest set bit.
+		\param aValue The value to check, must not be 0.
+		\return The number of leading zero bits.
+	*/
+	inline uint32_t CountLeadingZeros(const uint32_t aValue) throw() {
+		#if SOLAIRE_COMPILER == SOLAIRE_MSVC
+			unsigned long index;
+			_BitScanReverse(&index, aValue);
+			return 31 - index;
+		#else
+			return __builtin_clz(aValue);
+		#endif
+	}
+
+	inline uint32_t CountLeadingZeros(const uint64_t aValue) throw() {
+		#if SOLAIRE_COMPILER == SOLAIRE_MSVC
+			const uint32_t high = static_cast<uint32_t>(aValue >> 32L);
+			return high != 0 ? CountLeadingZeros(high) : 32 + CountLeadingZeros(static_cast<uint32_t>(aValue));
+		#else
+			return __builtin_clzll(aValue);
+		#endif
+	}
+
 	////
 
 	template<class T>
@@ -0,0 +1,298 @@
+#ifndef SOLAIRE_MPMC_QUEUE_HPP
+#define SOLAIRE_MPMC_QUEUE_HPP
+
+//Copyright 2015 Adam Smith
+//
+//Licensed under the Apache License, Version 2.0 (the "License");
+//you may not use this file except in compliance with the License.
+//You may obtain a copy of the License at
+//
+//    http://www.apache.org/licenses/LICENSE-2.0
+//
+//Unless required by applicable law or agreed to in writing, software
+//distributed under the License is distributed on an "AS IS" BASIS,
+//WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//See the License for the specific language governing permissions and
+//limitations under the License.
+
+// Contact :
+// Email             : solairelibrary@mail.com
+// GitHub repository : https://github.com/SolaireLibrary/SolaireCPP
+
+/*!
+	\file MpmcQueue.hpp
+	\brief
+	\author
+	Created			: Adam Smith
+	Last modified	: Adam Smith
+	\version 1.0
+	\date
+	Created			: 18th October 2026
+	Last Modified	: 18th October 2026
+*/
+
+#include <new>
+#include <atomic>
+#include <utility>
+#include <stdexcept>
+#include <type_traits>
+#ifndef SOLAIRE_DISABLE_MULTITHREADING
+	#include <mutex>
+	#include <thread>
+	#include <condition_variable>
+#endif
+#include "Init.hpp"
+#include "AllocatorI.hpp"
+#include "Maths.hpp"
+
+namespace Solaire {
+
+	/*!
+		\class MpmcQueue
+		\brief A bounded lock-free queue that any number of threads can push to and pop from.
+		\detail
+		Each cell of the buffer has a sequence number that says whether it is ready to be written or read for a given lap
+		of the buffer, so producers and consumers only contend on the position they are claiming and never on each other's
+		cells (Vyukov's bounded queue). The push and pop positions are on separate cache lines.
+
+		TryPush and TryPop never block. Push and Pop wait when the queue is full or empty, first by spinning, then by
+		yielding, then by sleeping on a condition variable. Threads only touch the condition variable's lock when another
+		thread is asleep.
+		\tparam T The type of element stored in the queue, must be nothrow move constructible.
+		\author Adam Smith
+		\date Created : 18th October 2026
+		\date Modified : 18th October 2026
+		\version 1.0
+		\see SpscQueue
+	*/
+	template<class T>
+	class MpmcQueue {
+	private:
+		enum : uint32_t {
+			CACHE_LINE = 64,
+			SPIN_COUNT = 64,
+			YIELD_COUNT = 16
+		};
+
+		struct Cell {
+			std::atomic<uint32_t> Sequence;
+			typename std::aligned_storage<sizeof(T), std::alignment_of<T>::value>::type Value;
+		};
+
+		struct alignas(CACHE_LINE) Position {
+			std::atomic<uint32_t> Value;
+		};
+	private:
+		AllocatorI& mAllocator;
+		Cell* const mCells;
+		const uint32_t mCapacity;
+		const uint32_t mMask;
+		Position mTail;
+		Position mHead;
+		#ifndef SOLAIRE_DISABLE_MULTITHREADING
+			std::atomic<uint32_t> mPushWaiters;
+			std::atomic<uint32_t> mPopWaiters;
+			std::mutex mLock;
+			std::condition_variable mNotFull;
+			std::condition_variable mNotEmpty;
+		#endif
+	private:
+		MpmcQueue(const MpmcQueue<T>&) = delete;
+		MpmcQueue(MpmcQueue<T>&&) = delete;
+		MpmcQueue<T>& operator=(const MpmcQueue<T>&) = delete;
+		MpmcQueue<T>& operator=(MpmcQueue<T>&&) = delete;
+
+		#ifndef SOLAIRE_DISABLE_MULTITHREADING
+			static SOLAIRE_FORCE_INLINE void SOLAIRE_DEFAULT_CALL Wake(std::atomic<uint32_t>& aWaiters, std::mutex& aLock, std::condition_variable& aCondition) {
+				// Orders the caller's publish before the waiter count is read, see Wait
+				std::atomic_thread_fence(std::memory_order_seq_cst);
+				if(aWaiters.load(std::memory_order_relaxed) == 0) return;
+				{
+					// A waiter holds the lock from its final check until it is asleep
+					std::lock_guard<std::mutex> lock(aLock);
+				}
+				aCondition.notify_all();
+			}
+
+			template<class F>
+			void SOLAIRE_DEFAULT_CALL Wait(const uint32_t aAttempt, std::atomic<uint32_t>& aWaiters, std::condition_variable& aCondition, F aReady) {
+				if(aAttempt < SPIN_COUNT) return;
+				if(aAttempt < SPIN_COUNT + YIELD_COUNT) {
+					std::this_thread::yield();
+					return;
+				}
+
+				std::unique_lock<std::mutex> lock(mLock);
+				++aWaiters;
+				std::atomic_thread_fence(std::memory_order_seq_cst);
+				// A thread that changes the queue after this check will see the waiter and notify under the lock
+				if(! aReady()) aCondition.wait(lock);
+				--aWaiters;
+			}
+		#endif
+
+		SOLAIRE_FORCE_INLINE T& SOLAIRE_DEFAULT_CALL GetValue(Cell& aCell) throw() {
+			return *reinterpret_cast<T*>(&aCell.Value);
+		}
+	public:
+		/*!
+			\brief Create an empty queue.
+			\param aAllocator The allocator that the buffer will be allocated from.
+			\param aCapacity The minimum number of elements that the queue can hold.
+		*/
+		MpmcQueue(AllocatorI& aAllocator, const uint32_t aCapacity) :
+			mAllocator(aAllocator),
+			mCells(static_cast<Cell*>(aAllocator.Allocate(sizeof(Cell) * NextPowerOfTwo(Max<uint32_t>(aCapacity, 2))))),
+			mCapacity(NextPowerOfTwo(Max<uint32_t>(aCapacity, 2))),
+			mMask(NextPowerOfTwo(Max<uint32_t>(aCapacity, 2)) - 1)
+		{
+			SolaireRuntimeAssert(mCells != nullptr, "SolaireCPP : MpmcQueue failed to allocate memory");
+			for(uint32_t i = 0; i < mCapacity; ++i) new(&mCells[i].Sequence) std::atomic<uint32_t>(i);
+			mTail.Value = 0;
+			mHead.Value = 0;
+			#ifndef SOLAIRE_DISABLE_MULTITHREADING
+				mPushWaiters = 0;
+				mPopWaiters = 0;
+			#endif
+		}
+
+		~MpmcQueue() {
+			const uint32_t tail = mTail.Value.load(std::memory_order_relaxed);
+			for(uint32_t i = mHead.Value.load(std::memory_order_relaxed); i != tail; ++i) GetValue(mCells[i & mMask]).~T();
+			mAllocator.Deallocate(mCells);
+		}
+
+		/*!
+			\brief Construct an element at the back of the queue.
+			\detail The parameters are only used if the element is constructed.
+			\tparam PARAMS The parameter types to pass to the element's constructor.
+			\param aParams The parameters to pass to the element's constructor.
+			\return False if the queue is full.
+		*/
+		template<class ...PARAMS>
+		bool SOLAIRE_DEFAULT_CALL TryEmplace(PARAMS&&... aParams) {
+			uint32_t position = mTail.Value.load(std::memory_order_relaxed);
+			Cell* cell;
+			while(true) {
+				cell = mCells + (position & mMask);
+				const int32_t difference = static_cast<int32_t>(cell->Sequence.load(std::memory_order_acquire) - position);
+				if(difference == 0) {
+					if(mTail.Value.compare_exchange_weak(position, position + 1, std::memory_order_relaxed)) break;
+				}else if(difference < 0) {
+					// The cell still holds the element from the previous lap
+					return false;
+				}else {
+					position = mTail.Value.load(std::memory_order_relaxed);
+				}
+			}
+
+			new(&cell->Value) T(std::forward<PARAMS>(aParams)...);
+			cell->Sequence.store(position + 1, std::memory_order_release);
+			#ifndef SOLAIRE_DISABLE_MULTITHREADING
+				Wake(mPopWaiters, mLock, mNotEmpty);
+			#endif
+			return true;
+		}
+
+		SOLAIRE_FORCE_INLINE bool SOLAIRE_DEFAULT_CALL TryPush(const T& aValue) {
+			return TryEmplace(aValue);
+		}
+
+		SOLAIRE_FORCE_INLINE bool SOLAIRE_DEFAULT_CALL TryPush(T&& aValue) {
+			return TryEmplace(std::move(aValue));
+		}
+
+		/*!
+			\brief Move the front element out of the queue.
+			\param aValue Assigned the element.
+			\return False if the queue is empty.
+		*/
+		bool SOLAIRE_DEFAULT_CALL TryPop(T& aValue) {
+			uint32_t position = mHead.Value.load(std::memory_order_relaxed);
+			Cell* cell;
+			while(true) {
+				cell = mCells + (position & mMask);
+				const int32_t difference = static_cast<int32_t>(cell->Sequence.load(std::memory_order_acquire) - (position + 1));
+				if(difference == 0) {
+					if(mHead.Value.compare_exchange_weak(position, position + 1, std::memory_order_relaxed)) break;
+				}else if(difference < 0) {
+					// The cell has not been written in this lap
+					return false;
+				}else {
+					position = mHead.Value.load(std::memory_order_relaxed);
+				}
+			}
+
+			T& value = GetValue(*cell);
+			aValue = std::move(value);
+			value.~T();
+			cell->Sequence.store(position + mCapacity, std::memory_order_release);
+			#ifndef SOLAIRE_DISABLE_MULTITHREADING
+				Wake(mPushWaiters, mLock, mNotFull);
+			#endif
+			return true;
+		}
+
+		#ifndef SOLAIRE_DISABLE_MULTITHREADING
+			/*!
+				\brief Construct an element at the back of the queue, waiting until there is space.
+				\tparam PARAMS The parameter types to pass to the element's constructor.
+				\param aParams The parameters to pass to the element's constructor.
+			*/
+			template<class ...PARAMS>
+			void SOLAIRE_DEFAULT_CALL Emplace(PARAMS&&... aParams) {
+				for(uint32_t i = 0; ! TryEmplace(std::forward<PARAMS>(aParams)...); ++i) {
+					Wait(i, mPushWaiters, mNotFull, [this]()->bool {
+						return Size() < mCapacity;
+					});
+				}
+			}
+
+			SOLAIRE_FORCE_INLINE void SOLAIRE_DEFAULT_CALL Push(const T& aValue) {
+				Emplace(aValue);
+			}
+
+			SOLAIRE_FORCE_INLINE void SOLAIRE_DEFAULT_CALL Push(T&& aValue) {
+				Emplace(std::move(aValue));
+			}
+
+			/*!
+				\brief Move the front element out of the queue, waiting until there is one.
+				\param aValue Assigned the element.
+			*/
+			void SOLAIRE_DEFAULT_CALL Pop(T& aValue) {
+				for(uint32_t i = 0; ! TryPop(aValue); ++i) {
+					Wait(i, mPopWaiters, mNotEmpty, [this]()->bool {
+						return Size() > 0;
+					});
+				}
+			}
+		#endif
+
+		/*!
+			\brief Get the number of elements in the queue.
+			\detail The result may already be out of date if other threads are using the queue.
+			\return The number of elements, including elements that are still being pushed or popped.
+		*/
+		SOLAIRE_FORCE_INLINE uint32_t SOLAIRE_DEFAULT_CALL Size() const throw() {
+			const uint32_t head = mHead.Value.load(std::memory_order_acquire);
+			const uint32_t tail = mTail.Value.load(std::memory_order_acquire);
+			const int32_t size = static_cast<int32_t>(tail - head);
+			return size < 0 ? 0 : Min<uint32_t>(static_cast<uint32_t>(size), mCapacity);
+		}
+
+		SOLAIRE_FORCE_INLINE bool SOLAIRE_DEFAULT_CALL IsEmpty() const throw() {
+			return Size() == 0;
+		}
+
+		SOLAIRE_FORCE_INLINE uint32_t SOLAIRE_DEFAULT_CALL GetCapacity() const throw() {
+			return mCapacity;
+		}
+
+		SOLAIRE_FORCE_INLINE AllocatorI& SOLAIRE_DEFAULT_CALL GetAllocator() const throw() {
+			return mAllocator;
+		}
+	};
+}
+
+#endif
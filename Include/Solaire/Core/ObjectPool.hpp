@@ -0,0 +1,241 @@
+#ifndef SOLAIRE_OBJECT_POOL_HPP
+#define SOLAIRE_OBJECT_POOL_HPP
+
+//Copyright 2015 Adam Smith
+//
+//Licensed under the Apache License, Version 2.0 (the "License");
+//you may not use this file except in compliance with the License.
+//You may obtain a copy of the License at
+//
+//    http://www.apache.org/licenses/LICENSE-2.0
+//
+//Unless required by applicable law or agreed to in writing, software
+//distributed under the License is distributed on an "AS IS" BASIS,
+//WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//See the License for the specific language governing permissions and
+//limitations under the License.
+
+// Contact :
+// Email             : solairelibrary@mail.com
+// GitHub repository : https://github.com/SolaireLibrary/SolaireCPP
+
+/*!
+	\file ObjectPool.hpp
+	\brief
+	\author
+	Created			: Adam Smith
+	Last modified	: Adam Smith
+	\version 1.0
+	\date
+	Created			: 18th October 2026
+	Last Modified	: 18th October 2026
+*/
+
+#include <new>
+#include <utility>
+#include <type_traits>
+#include "AllocatorI.hpp"
+#include "Maths.hpp"
+
+namespace Solaire {
+
+	/*!
+		\class ObjectPool
+		\brief A pool of objects of type \a T that are allocated from an AllocatorI in whole slabs.
+		\detail
+		Released objects are passed to a reset function and kept constructed, so that the next Acquire can return them
+		without running a constructor. If no reset function is given, released objects are destroyed and only their memory is reused.
+		Objects that are still acquired when the pool is destroyed are not destroyed.
+		\tparam T The type of object stored in the pool.
+		\author Adam Smith
+		\date Created : 18th October 2026
+		\date Modified : 18th October 2026
+		\version 1.0
+	*/
+	template<class T>
+	class ObjectPool {
+	public:
+		typedef void(SOLAIRE_DEFAULT_CALL *ResetFn)(T&);
+	private:
+		struct Slot {
+			typename std::aligned_storage<sizeof(T), std::alignment_of<T>::value>::type Object;
+			Slot* Next;
+		};
+
+		struct Slab {
+			Slab* Next;
+		};
+
+		enum : uint32_t {
+			SLAB_HEADER_SIZE = CeilToMultiple<uint32_t>(sizeof(Slab), std::alignment_of<Slot>::value),
+			DEFAULT_SLAB_OBJECTS = 32
+		};
+	private:
+		AllocatorI& mAllocator;
+		const ResetFn mReset;
+		Slab* mSlabs;
+		Slot* mRecycled;
+		Slot* mFree;
+		const uint32_t mSlabObjects;
+		uint32_t mCapacity;
+		uint32_t mAcquiredCount;
+		uint32_t mRecycledCount;
+	private:
+		ObjectPool(const ObjectPool<T>&) = delete;
+		ObjectPool(ObjectPool<T>&&) = delete;
+		ObjectPool<T>& operator=(const ObjectPool<T>&) = delete;
+		ObjectPool<T>& operator=(ObjectPool<T>&&) = delete;
+
+		static SOLAIRE_FORCE_INLINE Slot* SOLAIRE_DEFAULT_CALL ToSlot(T* const aObject) throw() {
+			return reinterpret_cast<Slot*>(aObject);
+		}
+
+		static SOLAIRE_FORCE_INLINE T* SOLAIRE_DEFAULT_CALL ToObject(Slot* const aSlot) throw() {
+			return reinterpret_cast<T*>(&aSlot->Object);
+		}
+
+		bool SOLAIRE_DEFAULT_CALL AllocateSlab() throw() {
+			void* const block = mAllocator.Allocate(SLAB_HEADER_SIZE + sizeof(Slot) * mSlabObjects);
+			if(block == nullptr) return false;
+
+			Slab* const slab = static_cast<Slab*>(block);
+			slab->Next = mSlabs;
+			mSlabs = slab;
+
+			Slot* const slots = reinterpret_cast<Slot*>(static_cast<uint8_t*>(block) + SLAB_HEADER_SIZE);
+			for(uint32_t i = mSlabObjects; i > 0; --i) {
+				Slot& slot = slots[i - 1];
+				slot.Next = mFree;
+				mFree = &slot;
+			}
+
+			mCapacity += mSlabObjects;
+			return true;
+		}
+	public:
+		/*!
+			\brief Create an empty pool.
+			\param aAllocator The allocator that slabs will be allocated from.
+			\param aReset The function that returns a released object to its initial state, or nullptr if released objects should be destroyed.
+			\param aSlabObjects The number of objects that will fit into each slab.
+		*/
+		ObjectPool(AllocatorI& aAllocator, const ResetFn aReset = nullptr, const uint32_t aSlabObjects = DEFAULT_SLAB_OBJECTS) throw() :
+			mAllocator(aAllocator),
+			mReset(aReset),
+			mSlabs(nullptr),
+			mRecycled(nullptr),
+			mFree(nullptr),
+			mSlabObjects(aSlabObjects == 0 ? 1 : aSlabObjects),
+			mCapacity(0),
+			mAcquiredCount(0),
+			mRecycledCount(0)
+		{}
+
+		/*!
+			\brief Destroy all recycled objects and return the slabs to the allocator.
+		*/
+		~ObjectPool() throw() {
+			Purge();
+			while(mSlabs) {
+				Slab* const next = mSlabs->Next;
+				mAllocator.Deallocate(mSlabs);
+				mSlabs = next;
+			}
+		}
+
+		/*!
+			\brief Acquire an object from the pool.
+			\detail
+			If a recycled object is available it is returned as it was left by the reset function, otherwise a new object is
+			constructed in place. \a aParams are only forwarded to the constructor when a new object is constructed.
+			\tparam PARAMS The parameter types to pass to the object's constructor.
+			\param aParams The parameters to pass to the object's constructor.
+			\return The address of the object, or nullptr if the allocation failed.
+			\see Release
+		*/
+		template<typename ...PARAMS>
+		T* SOLAIRE_DEFAULT_CALL Acquire(PARAMS&&... aParams) {
+			Slot* slot = mRecycled;
+			if(slot) {
+				mRecycled = slot->Next;
+				--mRecycledCount;
+				++mAcquiredCount;
+				return ToObject(slot);
+			}
+
+			if(mFree == nullptr && ! AllocateSlab()) return nullptr;
+			// The slot is only taken once the constructor has returned, so it stays free if the constructor throws
+			slot = mFree;
+			T* const object = new(&slot->Object) T(std::forward<PARAMS>(aParams)...);
+			mFree = slot->Next;
+			++mAcquiredCount;
+			return object;
+		}
+
+		/*!
+			\brief Return an object to the pool.
+			\detail The object is passed to the reset function and kept for reuse, or destroyed if there is no reset function.
+			\param aObject An object that was acquired from this pool.
+			\see Acquire
+		*/
+		void SOLAIRE_DEFAULT_CALL Release(T* const aObject) {
+			Slot* const slot = ToSlot(aObject);
+			--mAcquiredCount;
+
+			if(mReset) {
+				mReset(*aObject);
+				slot->Next = mRecycled;
+				mRecycled = slot;
+				++mRecycledCount;
+			}else {
+				aObject->~T();
+				slot->Next = mFree;
+				mFree = slot;
+			}
+		}
+
+		/*!
+			\brief Allocate slabs until at least \a aCount objects can be acquired without allocating.
+			\param aCount The number of objects to reserve space for.
+			\return True if the space was reserved.
+		*/
+		bool SOLAIRE_DEFAULT_CALL Reserve(const uint32_t aCount) throw() {
+			while(mCapacity - mAcquiredCount < aCount) {
+				if(! AllocateSlab()) return false;
+			}
+			return true;
+		}
+
+		/*!
+			\brief Destroy all recycled objects, their memory will be reused by the next Acquire.
+		*/
+		void SOLAIRE_DEFAULT_CALL Purge() throw() {
+			while(mRecycled) {
+				Slot* const slot = mRecycled;
+				mRecycled = slot->Next;
+				ToObject(slot)->~T();
+				slot->Next = mFree;
+				mFree = slot;
+			}
+			mRecycledCount = 0;
+		}
+
+		SOLAIRE_FORCE_INLINE uint32_t SOLAIRE_DEFAULT_CALL GetAcquiredCount() const throw() {
+			return mAcquiredCount;
+		}
+
+		SOLAIRE_FORCE_INLINE uint32_t SOLAIRE_DEFAULT_CALL GetRecycledCount() const throw() {
+			return mRecycledCount;
+		}
+
+		SOLAIRE_FORCE_INLINE uint32_t SOLAIRE_DEFAULT_CALL GetCapacity() const throw() {
+			return mCapacity;
+		}
+
+		SOLAIRE_FORCE_INLINE AllocatorI& SOLAIRE_DEFAULT_CALL GetAllocator() const throw() {
+			return mAllocator;
+		}
+	};
+}
+
+#endif
@@ -0,0 +1,399 @@
+#ifndef SOLAIRE_PARALLEL_ALGORITHMS_HPP
+#define SOLAIRE_PARALLEL_ALGORITHMS_HPP
+
+//Copyright 2015 Adam Smith
+//
+//Licensed under the Apache License, Version 2.0 (the "License");
+//you may not use this file except in compliance with the License.
+//You may obtain a copy of the License at
+//
+//    http://www.apache.org/licenses/LICENSE-2.0
+//
+//Unless required by applicable law or agreed to in writing, software
+//distributed under the License is distributed on an "AS IS" BASIS,
+//WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//See the License for the specific language governing permissions and
+//limitations under the License.
+
+// Contact :
+// Email             : solairelibrary@mail.com
+// GitHub repository : https://github.com/SolaireLibrary/SolaireCPP
+
+/*!
+	\file ParallelAlgorithms.hpp
+	\brief
+	\author
+	Created			: Adam Smith
+	Last modified	: Adam Smith
+	\version 1.0
+	\date
+	Created			: 18th October 2026
+	Last Modified	: 18th October 2026
+*/
+
+#include <utility>
+#include <type_traits>
+#include "Maths.hpp"
+#include "Container.hpp"
+#include "DynamicArray.hpp"
+#include "TaskScheduler.hpp"
+
+namespace Solaire {
+
+	namespace Implementation {
+		enum : uint32_t {
+			PARALLEL_CACHE_LINE = 64,
+			PARALLEL_TASKS_PER_THREAD = 4,
+			PARALLEL_MIN_GRAIN = 1024
+		};
+
+		template<class S, class D>
+		struct ParallelRange {
+			S* Src;
+			D* Dst;
+			uint32_t Length;
+		};
+
+		/*!
+			\class ParallelPartition
+			\brief Splits one or two containers into tasks of roughly equal size.
+			\detail
+			Each contiguous run of the containers is cut into ranges of at most the grain size, the cuts are placed on cache
+			line boundaries of the destination so that two tasks never write to the same line. Consecutive ranges are then
+			grouped into tasks of at least the grain size, so segmented containers with short runs do not create tiny tasks.
+			The grain size is rounded up to a whole number of cache lines.
+			GetChunk is only called by the thread that creates the partition.
+			\tparam S The source element type, may be const.
+			\tparam D The destination element type, may be const.
+			\author Adam Smith
+			\date Created : 18th October 2026
+			\date Modified : 18th October 2026
+			\version 1.0
+		*/
+		template<class S, class D>
+		class ParallelPartition {
+		public:
+			typedef typename std::remove_const<S>::type SourceType;
+			typedef typename std::remove_const<D>::type DestinationType;
+		private:
+			DynamicArray<ParallelRange<S, D>> mRanges;
+			DynamicArray<uint32_t> mTasks;
+		private:
+			ParallelPartition(const ParallelPartition&) = delete;
+			ParallelPartition(ParallelPartition&&) = delete;
+			ParallelPartition& operator=(const ParallelPartition&) = delete;
+			ParallelPartition& operator=(ParallelPartition&&) = delete;
+
+			static SOLAIRE_FORCE_INLINE uint32_t SOLAIRE_DEFAULT_CALL GetLineHead(const D* const aAddress) throw() {
+				// The number of elements before the next cache line, 0 if elements do not tile a cache line
+				if(PARALLEL_CACHE_LINE % sizeof(D) != 0) return 0;
+				const uintptr_t address = reinterpret_cast<uintptr_t>(aAddress);
+				if(address % sizeof(D) != 0) return 0;
+				return static_cast<uint32_t>(((PARALLEL_CACHE_LINE - address % PARALLEL_CACHE_LINE) % PARALLEL_CACHE_LINE) / sizeof(D));
+			}
+
+			void SOLAIRE_DEFAULT_CALL PushRange(S* const aSrc, D* const aDst, const uint32_t aLength) {
+				const ParallelRange<S, D> range = {aSrc, aDst, aLength};
+				mRanges.PushBack(range);
+			}
+		public:
+			/*!
+				\brief Partition a source container, and optionally a destination container, between tasks.
+				\param aAllocator The allocator that the partition will allocate from.
+				\param aSrc The container to read from.
+				\param aDst The container to write to, at least as large as \a aSrc, or nullptr to write to \a aSrc.
+				\param aGrain The number of elements per task, 0 chooses a size from the number of threads.
+				\param aThreadCount The number of threads that will execute the tasks.
+			*/
+			ParallelPartition(Allocator& aAllocator, FixedContainer<SourceType>& aSrc, FixedContainer<DestinationType>* const aDst, uint32_t aGrain, const uint32_t aThreadCount) :
+				mRanges(aAllocator),
+				mTasks(aAllocator)
+			{
+				const uint32_t size = aSrc.Size();
+				if(aDst) SolaireRuntimeAssert(aDst->Size() >= size, "SolaireCPP : Parallel algorithm destination is smaller than the source");
+
+				if(aGrain == 0) {
+					const uint32_t tasks = Max<uint32_t>(aThreadCount, 1) * PARALLEL_TASKS_PER_THREAD;
+					aGrain = Max<uint32_t>((size + tasks - 1) / tasks, PARALLEL_MIN_GRAIN);
+				}
+				if(PARALLEL_CACHE_LINE % sizeof(D) == 0) aGrain = CeilToMultiple<uint32_t>(aGrain, PARALLEL_CACHE_LINE / sizeof(D));
+
+				// Cut each run where both containers are contiguous into ranges
+				uint32_t i = 0;
+				while(i < size) {
+					uint32_t srcLength;
+					SourceType* const src = aSrc.GetChunk(i, srcLength);
+					uint32_t length = srcLength;
+					D* dst;
+					if(aDst) {
+						uint32_t dstLength;
+						dst = aDst->GetChunk(i, dstLength);
+						length = Min<uint32_t>(length, dstLength);
+					}else {
+						dst = reinterpret_cast<D*>(src);
+					}
+					length = Min<uint32_t>(length, size - i);
+
+					uint32_t offset = GetLineHead(dst);
+					if(offset >= length) offset = 0;
+					if(offset > 0) PushRange(src, dst, offset);
+					while(offset < length) {
+						const uint32_t count = Min<uint32_t>(aGrain, length - offset);
+						PushRange(src + offset, dst + offset, count);
+						offset += count;
+					}
+					i += length;
+				}
+
+				// Group consecutive ranges into tasks
+				const uint32_t ranges = mRanges.Size();
+				uint32_t accumulated = 0;
+				for(uint32_t j = 0; j < ranges; ++j) {
+					if(accumulated == 0) mTasks.PushBack(j);
+					accumulated += mRanges[j].Length;
+					if(accumulated >= aGrain) accumulated = 0;
+				}
+				mTasks.PushBack(ranges);
+			}
+
+			SOLAIRE_FORCE_INLINE uint32_t SOLAIRE_DEFAULT_CALL GetTaskCount() const throw() {
+				return mTasks.Size() - 1;
+			}
+
+			SOLAIRE_FORCE_INLINE S& SOLAIRE_DEFAULT_CALL GetFirst(const uint32_t aTask) const throw() {
+				return *mRanges[mTasks[aTask]].Src;
+			}
+
+			/*!
+				\brief Call a function on each range of a task, in order.
+				\param aTask The index of the task.
+				\param aFunction A function with the signature void(S* aSrc, D* aDst, uint32_t aLength).
+			*/
+			template<class F>
+			void SOLAIRE_DEFAULT_CALL ForEachRange(const uint32_t aTask, F aFunction) const {
+				const uint32_t end = mTasks[aTask + 1];
+				for(uint32_t i = mTasks[aTask]; i < end; ++i) {
+					const ParallelRange<S, D>& range = mRanges[i];
+					aFunction(range.Src, range.Dst, range.Length);
+				}
+			}
+		};
+
+		/*!
+			\brief Call a function once for each task index, the calling thread executes the first task itself.
+			\param aScheduler The scheduler that will execute the other tasks.
+			\param aCount The number of tasks.
+			\param aFunction A function with the signature void(uint32_t aTask).
+		*/
+		template<class F>
+		void SOLAIRE_DEFAULT_CALL RunParallelTasks(TaskScheduler& aScheduler, const uint32_t aCount, F& aFunction) {
+			if(aCount <= 1 || aScheduler.GetThreadCount() == 0) {
+				for(uint32_t i = 0; i < aCount; ++i) aFunction(i);
+				return;
+			}
+
+			TaskGroup group(aScheduler);
+			for(uint32_t i = 1; i < aCount; ++i) group.Run([&aFunction, i]() {
+				aFunction(i);
+			});
+			aFunction(0);
+			group.Wait();
+		}
+	}
+
+	/*!
+		\brief Call a function on each element of a container, using the workers of a scheduler.
+		\detail The order in which elements are visited is unspecified.
+		\param aScheduler The scheduler that will execute the tasks.
+		\param aContainer The container.
+		\param aFunction A function with the signature void(T& aElement), called concurrently.
+		\param aGrain The number of elements per task, 0 chooses a size from the number of threads.
+	*/
+	template<class T, class F>
+	void SOLAIRE_DEFAULT_CALL ParallelForEach(TaskScheduler& aScheduler, FixedContainer<T>& aContainer, F aFunction, const uint32_t aGrain = 0) {
+		const Implementation::ParallelPartition<T, T> partition(aScheduler.GetAllocator(), aContainer, nullptr, aGrain, aScheduler.GetThreadCount());
+
+		auto task = [&partition, &aFunction](const uint32_t aTask) {
+			partition.ForEachRange(aTask, [&aFunction](T* const aSrc, T* const, const uint32_t aLength) {
+				for(uint32_t i = 0; i < aLength; ++i) aFunction(aSrc[i]);
+			});
+		};
+		Implementation::RunParallelTasks(aScheduler, partition.GetTaskCount(), task);
+	}
+
+	/*!
+		\brief Write the result of a function on each element of a container into another container.
+		\param aScheduler The scheduler that will execute the tasks.
+		\param aSrc The container to read from.
+		\param aDst The container to write to, must be at least as large as \a aSrc, may be \a aSrc if the types match.
+		\param aFunction A function with the signature T2(const T& aElement), called concurrently.
+		\param aGrain The number of elements per task, 0 chooses a size from the number of threads.
+	*/
+	template<class T, class T2, class F>
+	void SOLAIRE_DEFAULT_CALL ParallelTransform(TaskScheduler& aScheduler, const FixedContainer<T>& aSrc, FixedContainer<T2>& aDst, F aFunction, const uint32_t aGrain = 0) {
+		const Implementation::ParallelPartition<const T, T2> partition(aScheduler.GetAllocator(), const_cast<FixedContainer<T>&>(aSrc), &aDst, aGrain, aScheduler.GetThreadCount());
+
+		auto task = [&partition, &aFunction](const uint32_t aTask) {
+			partition.ForEachRange(aTask, [&aFunction](const T* const aSrc, T2* const aDst, const uint32_t aLength) {
+				for(uint32_t i = 0; i < aLength; ++i) aDst[i] = aFunction(aSrc[i]);
+			});
+		};
+		Implementation::RunParallelTasks(aScheduler, partition.GetTaskCount(), task);
+	}
+
+	/*!
+		\brief Combine every element of a container.
+		\detail
+		Each task combines its own elements, the partial results are then combined in order by the calling thread.
+		The operation must be associative, it does not need to be commutative.
+		\param aScheduler The scheduler that will execute the tasks.
+		\param aContainer The container.
+		\param aIdentity A value that does not change the result when combined with any element, eg. 0 for addition.
+		\param aOperation A function with the signature T(const T& aFirst, const T& aSecond), called concurrently.
+		\param aGrain The number of elements per task, 0 chooses a size from the number of threads.
+		\return The combination of every element, or \a aIdentity if the container is empty.
+	*/
+	template<class T, class F>
+	T SOLAIRE_DEFAULT_CALL ParallelReduce(TaskScheduler& aScheduler, const FixedContainer<T>& aContainer, const T& aIdentity, F aOperation, const uint32_t aGrain = 0) {
+		const Implementation::ParallelPartition<const T, const T> partition(aScheduler.GetAllocator(), const_cast<FixedContainer<T>&>(aContainer), nullptr, aGrain, aScheduler.GetThreadCount());
+		const uint32_t tasks = partition.GetTaskCount();
+
+		DynamicArray<T> partials(aScheduler.GetAllocator(), tasks);
+		for(uint32_t i = 0; i < tasks; ++i) partials.PushBack(aIdentity);
+
+		auto task = [&partition, &partials, &aOperation](const uint32_t aTask) {
+			T& result = partials[aTask];
+			partition.ForEachRange(aTask, [&result, &aOperation](const T* const aSrc, const T* const, const uint32_t aLength) {
+				for(uint32_t i = 0; i < aLength; ++i) result = aOperation(result, aSrc[i]);
+			});
+		};
+		Implementation::RunParallelTasks(aScheduler, tasks, task);
+
+		T result = aIdentity;
+		for(uint32_t i = 0; i < tasks; ++i) result = aOperation(result, partials[i]);
+		return result;
+	}
+
+	namespace Implementation {
+		/*!
+			\brief Replace the partial result of each task with the combination of every task before it.
+			\param aPartials The combination of each task's elements, the last one is not used.
+			\param aRunning The value to store for task \a aBegin.
+			\param aBegin The first task to replace, tasks before it are left unchanged.
+			\param aOperation The operation of the scan.
+		*/
+		template<class T, class F>
+		void SOLAIRE_DEFAULT_CALL ScanPartials(DynamicArray<T>& aPartials, T aRunning, const uint32_t aBegin, F& aOperation) {
+			const uint32_t tasks = aPartials.Size();
+			for(uint32_t i = aBegin; i < tasks; ++i) {
+				T partial = std::move(aPartials[i]);
+				aPartials[i] = aRunning;
+				if(i + 1 < tasks) aRunning = aOperation(aRunning, partial);
+			}
+		}
+
+		/*!
+			\brief Calculate the combination of every task's elements, except the last task which is not needed by a scan.
+		*/
+		template<class T, class F>
+		void SOLAIRE_DEFAULT_CALL ReducePartials(TaskScheduler& aScheduler, const ParallelPartition<const T, T>& aPartition, DynamicArray<T>& aPartials, F& aOperation) {
+			auto task = [&aPartition, &aPartials, &aOperation](const uint32_t aTask) {
+				T& result = aPartials[aTask];
+				result = aPartition.GetFirst(aTask);
+				bool first = true;
+				aPartition.ForEachRange(aTask, [&result, &first, &aOperation](const T* const aSrc, T* const, const uint32_t aLength) {
+					uint32_t i = 0;
+					if(first) {
+						i = 1;
+						first = false;
+					}
+					for(; i < aLength; ++i) result = aOperation(result, aSrc[i]);
+				});
+			};
+			RunParallelTasks(aScheduler, aPartition.GetTaskCount() - 1, task);
+		}
+	}
+
+	/*!
+		\brief Write the combination of each element and every element before it into another container.
+		\detail
+		Element N of \a aDst is aSrc[0] op aSrc[1] op ... op aSrc[N].
+		This takes two passes: the first combines the elements of each task, the second scans each task starting from the
+		combination of the tasks before it. The operation must be associative.
+		\param aScheduler The scheduler that will execute the tasks.
+		\param aSrc The container to read from.
+		\param aDst The container to write to, must be at least as large as \a aSrc, may be \a aSrc.
+		\param aOperation A function with the signature T(const T& aFirst, const T& aSecond), called concurrently.
+		\param aGrain The number of elements per task, 0 chooses a size from the number of threads.
+	*/
+	template<class T, class F>
+	void SOLAIRE_DEFAULT_CALL ParallelInclusiveScan(TaskScheduler& aScheduler, const FixedContainer<T>& aSrc, FixedContainer<T>& aDst, F aOperation, const uint32_t aGrain = 0) {
+		const Implementation::ParallelPartition<const T, T> partition(aScheduler.GetAllocator(), const_cast<FixedContainer<T>&>(aSrc), &aDst, aGrain, aScheduler.GetThreadCount());
+		const uint32_t tasks = partition.GetTaskCount();
+		if(tasks == 0) return;
+
+		DynamicArray<T> partials(aScheduler.GetAllocator(), tasks);
+		for(uint32_t i = 0; i < tasks; ++i) partials.PushBack(partition.GetFirst(0));
+		Implementation::ReducePartials(aScheduler, partition, partials, aOperation);
+		Implementation::ScanPartials(partials, partials[0], 1, aOperation);
+
+		auto task = [&partition, &partials, &aOperation](const uint32_t aTask) {
+			// The first task has no elements before it, so it starts from its first element
+			T running = aTask == 0 ? partition.GetFirst(0) : aOperation(partials[aTask], partition.GetFirst(aTask));
+			bool first = true;
+			partition.ForEachRange(aTask, [&running, &first, &aOperation](const T* const aSrc, T* const aDst, const uint32_t aLength) {
+				uint32_t i = 0;
+				if(first) {
+					aDst[0] = running;
+					i = 1;
+					first = false;
+				}
+				for(; i < aLength; ++i) {
+					running = aOperation(running, aSrc[i]);
+					aDst[i] = running;
+				}
+			});
+		};
+		Implementation::RunParallelTasks(aScheduler, tasks, task);
+	}
+
+	/*!
+		\brief Write the combination of every element before each element into another container.
+		\detail
+		Element 0 of \a aDst is \a aIdentity, element N is aIdentity op aSrc[0] op ... op aSrc[N - 1].
+		This takes two passes: the first combines the elements of each task, the second scans each task starting from the
+		combination of the tasks before it. The operation must be associative.
+		\param aScheduler The scheduler that will execute the tasks.
+		\param aSrc The container to read from.
+		\param aDst The container to write to, must be at least as large as \a aSrc, may be \a aSrc.
+		\param aIdentity The value to start from.
+		\param aOperation A function with the signature T(const T& aFirst, const T& aSecond), called concurrently.
+		\param aGrain The number of elements per task, 0 chooses a size from the number of threads.
+	*/
+	template<class T, class F>
+	void SOLAIRE_DEFAULT_CALL ParallelExclusiveScan(TaskScheduler& aScheduler, const FixedContainer<T>& aSrc, FixedContainer<T>& aDst, const T& aIdentity, F aOperation, const uint32_t aGrain = 0) {
+		const Implementation::ParallelPartition<const T, T> partition(aScheduler.GetAllocator(), const_cast<FixedContainer<T>&>(aSrc), &aDst, aGrain, aScheduler.GetThreadCount());
+		const uint32_t tasks = partition.GetTaskCount();
+		if(tasks == 0) return;
+
+		DynamicArray<T> partials(aScheduler.GetAllocator(), tasks);
+		for(uint32_t i = 0; i < tasks; ++i) partials.PushBack(aIdentity);
+		Implementation::ReducePartials(aScheduler, partition, partials, aOperation);
+		Implementation::ScanPartials(partials, aIdentity, 0, aOperation);
+
+		auto task = [&partition, &partials, &aOperation](const uint32_t aTask) {
+			T running = partials[aTask];
+			partition.ForEachRange(aTask, [&running, &aOperation](const T* const aSrc, T* const aDst, const uint32_t aLength) {
+				for(uint32_t i = 0; i < aLength; ++i) {
+					// Read the element before writing, the source and destination may be the same container
+					T value = aSrc[i];
+					aDst[i] = running;
+					running = aOperation(running, value);
+				}
+			});
+		};
+		Implementation::RunParallelTasks(aScheduler, tasks, task);
+	}
+}
+
+#endif
@@ -0,0 +1,115 @@
+#ifndef SOLAIRE_POOL_ALLOCATOR_HPP
+#define SOLAIRE_POOL_ALLOCATOR_HPP
+
+//Copyright 2015 Adam Smith
+//
+//Licensed under the Apache License, Version 2.0 (the "License");
+//you may not use this file except in compliance with the License.
+//You may obtain a copy of the License at
+//
+//    http://www.apache.org/licenses/LICENSE-2.0
+//
+//Unless required by applicable law or agreed to in writing, software
+//distributed under the License is distributed on an "AS IS" BASIS,
+//WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//See the License for the specific language governing permissions and
+//limitations under the License.
+
+// Contact :
+// Email             : solairelibrary@mail.com
+// GitHub repository : https://github.com/SolaireLibrary/SolaireCPP
+
+/*!
+	\file PoolAllocator.hpp
+	\brief
+	\author
+	Created			: Adam Smith
+	Last modified	: Adam Smith
+	\version 1.0
+	\date
+	Created			: 18th October 2026
+	Last Modified	: 18th October 2026
+*/
+
+#include "Allocator.hpp"
+
+namespace Solaire {
+
+	/*!
+		\class PoolAllocator
+		\brief An Allocator that hands out blocks of one fixed size.
+		\detail
+		Blocks are carved out of larger chunks that are allocated from a parent AllocatorI, deallocated blocks are kept on a
+		free list and reused by the next allocation, so allocating and deallocating never searches.
+		Requests larger than the block size fail. The allocator is not thread safe.
+		\author Adam Smith
+		\date Created : 18th October 2026
+		\date Modified : 18th October 2026
+		\version 1.0
+	*/
+	class PoolAllocator : public Allocator {
+	public:
+		enum : uint32_t {
+			DEFAULT_ALIGNMENT = 16,
+			DEFAULT_CHUNK_BLOCKS = 64
+		};
+	private:
+		struct Chunk {
+			Chunk* Next;
+		};
+
+		struct Block {
+			Block* Next;
+		};
+	private:
+		AllocatorI& mParent;
+		Chunk* mChunks;
+		Block* mFree;
+		const uint32_t mBlockSize;
+		const uint32_t mAlignment;
+		const uint32_t mChunkBlocks;
+		uint32_t mBlockCount;
+		uint32_t mAllocatedCount;
+	private:
+		PoolAllocator(const PoolAllocator&) = delete;
+		PoolAllocator(PoolAllocator&&) = delete;
+		PoolAllocator& operator=(const PoolAllocator&) = delete;
+		PoolAllocator& operator=(PoolAllocator&&) = delete;
+
+		bool SOLAIRE_DEFAULT_CALL AllocateChunk() throw();
+		bool SOLAIRE_DEFAULT_CALL IsBlock(const void* const aAddress) const throw();
+	public:
+		/*!
+			\brief Create an empty pool, no memory is allocated until the first block is requested.
+			\param aParent The allocator that chunks will be allocated from.
+			\param aBlockSize The size of each block in bytes.
+			\param aAlignment The alignment of each block in bytes, must be a power of two.
+			\param aChunkBlocks The number of blocks in each chunk.
+		*/
+		PoolAllocator(AllocatorI& aParent, const uint32_t aBlockSize, const uint32_t aAlignment = DEFAULT_ALIGNMENT, const uint32_t aChunkBlocks = DEFAULT_CHUNK_BLOCKS) throw();
+		SOLAIRE_EXPORT_CALL ~PoolAllocator();
+
+		/*!
+			\brief Allocate chunks until at least \a aCount blocks can be allocated without allocating from the parent.
+			\param aCount The number of blocks to reserve.
+			\return True if the blocks were reserved.
+		*/
+		bool SOLAIRE_DEFAULT_CALL Reserve(const uint32_t aCount) throw();
+
+		uint32_t SOLAIRE_DEFAULT_CALL GetBlockSize() const throw();
+		uint32_t SOLAIRE_DEFAULT_CALL GetBlockCount() const throw();
+		AllocatorI& SOLAIRE_DEFAULT_CALL GetParent() const throw();
+
+		// Inherited from AllocatorI
+
+		uint32_t SOLAIRE_EXPORT_CALL GetAllocatedBytes() const throw() override;
+		uint32_t SOLAIRE_EXPORT_CALL GetFreeBytes() const throw() override;
+		uint32_t SOLAIRE_EXPORT_CALL SizeOf(const void* const aObject) throw() override;
+		void* SOLAIRE_EXPORT_CALL Allocate(const size_t aBytes) throw() override;
+		bool SOLAIRE_EXPORT_CALL Deallocate(const void* const aObject) throw() override;
+		bool SOLAIRE_EXPORT_CALL DeallocateAll() throw() override;
+	};
+
+}
+
+#endif
@@ -0,0 +1,718 @@
+#ifndef SOLAIRE_PRIORITY_QUEUE_HPP
+#define SOLAIRE_PRIORITY_QUEUE_HPP
+
+//Copyright 2015 Adam Smith
+//
+//Licensed under the Apache License, Version 2.0 (the "License");
+//you may not use this file except in compliance with the License.
+//You may obtain a copy of the License at
+//
+//    http://www.apache.org/licenses/LICENSE-2.0
+//
+//Unless required by applicable law or agreed to in writing, software
+//distributed under the License is distributed on an "AS IS" BASIS,
+//WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//See the License for the specific language governing permissions and
+//limitations under the License.
+
+// Contact :
+// Email             : solairelibrary@mail.com
+// GitHub repository : https://github.com/SolaireLibrary/SolaireCPP
+
+/*!
+	\file PriorityQueue.hpp
+	\brief
+	\author
+	Created			: Adam Smith
+	Last modified	: Adam Smith
+	\version 1.0
+	\date
+	Created			: 18th October 2026
+	Last Modified	: 18th October 2026
+*/
+
+#include <utility>
+#include "Init.hpp"
+#include "Allocator.hpp"
+#include "Container.hpp"
+#include "DynamicArray.hpp"
+#include "ObjectPool.hpp"
+#include "Sort.hpp"
+
+namespace Solaire {
+
+	namespace Implementation {
+		/*!
+			\brief Move an element towards the root of a d-ary heap until its parent is not ordered after it.
+			\param aMoved A function with the signature void(uint32_t aIndex), called for each element that is stored at a new index.
+		*/
+		template<uint32_t ARITY, class T, class C, class F>
+		void SOLAIRE_DEFAULT_CALL HeapSiftUp(T* const aData, uint32_t aIndex, C& aCompare, F aMoved) {
+			T value = std::move(aData[aIndex]);
+			while(aIndex > 0) {
+				const uint32_t parent = (aIndex - 1) / ARITY;
+				if(! aCompare(value, aData[parent])) break;
+				aData[aIndex] = std::move(aData[parent]);
+				aMoved(aIndex);
+				aIndex = parent;
+			}
+			aData[aIndex] = std::move(value);
+			aMoved(aIndex);
+		}
+
+		/*!
+			\brief Move an element away from the root of a d-ary heap until none of its children are ordered before it.
+			\param aMoved A function with the signature void(uint32_t aIndex), called for each element that is stored at a new index.
+		*/
+		template<uint32_t ARITY, class T, class C, class F>
+		void SOLAIRE_DEFAULT_CALL HeapSiftDown(T* const aData, uint32_t aIndex, const uint32_t aSize, C& aCompare, F aMoved) {
+			T value = std::move(aData[aIndex]);
+			while(true) {
+				const uint32_t first = aIndex * ARITY + 1;
+				if(first >= aSize) break;
+
+				// The children of a node are adjacent, so comparing them touches one or two cache lines
+				const uint32_t last = Min<uint32_t>(first + ARITY, aSize);
+				uint32_t best = first;
+				for(uint32_t i = first + 1; i < last; ++i) {
+					if(aCompare(aData[i], aData[best])) best = i;
+				}
+
+				if(! aCompare(aData[best], value)) break;
+				aData[aIndex] = std::move(aData[best]);
+				aMoved(aIndex);
+				aIndex = best;
+			}
+			aData[aIndex] = std::move(value);
+			aMoved(aIndex);
+		}
+
+		struct IgnoreHeapMove {
+			SOLAIRE_FORCE_INLINE void SOLAIRE_DEFAULT_CALL operator()(const uint32_t) const throw() {
+
+			}
+		};
+	}
+
+	/*!
+		\class DaryHeap
+		\brief A priority queue stored as an implicit d-ary heap in a DynamicArray.
+		\detail
+		The element ordered first by the comparison is at the top, so the default Less comparison gives a min heap.
+		A higher arity makes the heap shallower, so a push touches fewer levels and the children that a pop compares
+		are adjacent in memory. The default arity of 4 fits the children of a node into one cache line for small elements.
+		\tparam T The element type.
+		\tparam ARITY The number of children of each node.
+		\tparam C A function object with the signature bool(const T& aFirst, const T& aSecond) that returns true if the
+		first element should be popped before the second.
+		\author Adam Smith
+		\date Created : 18th October 2026
+		\date Modified : 18th October 2026
+		\version 1.0
+		\see IndexedDaryHeap
+		\see PairingHeap
+	*/
+	template<class T, uint32_t ARITY = 4, class C = Less<T>>
+	class DaryHeap {
+	public:
+		static_assert(ARITY >= 2, "SolaireCPP : DaryHeap arity must be at least 2");
+	private:
+		DynamicArray<T> mData;
+		C mCompare;
+	private:
+		SOLAIRE_FORCE_INLINE void SOLAIRE_DEFAULT_CALL SiftUp(const uint32_t aIndex) {
+			Implementation::HeapSiftUp<ARITY>(&mData[0], aIndex, mCompare, Implementation::IgnoreHeapMove());
+		}
+
+		SOLAIRE_FORCE_INLINE void SOLAIRE_DEFAULT_CALL SiftDown(const uint32_t aIndex) {
+			Implementation::HeapSiftDown<ARITY>(&mData[0], aIndex, mData.Size(), mCompare, Implementation::IgnoreHeapMove());
+		}
+	public:
+		DaryHeap(Allocator& aAllocator, const C aCompare = C()) :
+			mData(aAllocator),
+			mCompare(aCompare)
+		{}
+
+		DaryHeap(const DaryHeap<T, ARITY, C>& aOther) :
+			mData(aOther.mData),
+			mCompare(aOther.mCompare)
+		{}
+
+		DaryHeap(DaryHeap<T, ARITY, C>&& aOther) :
+			mData(std::move(aOther.mData)),
+			mCompare(aOther.mCompare)
+		{}
+
+		DaryHeap<T, ARITY, C>& SOLAIRE_DEFAULT_CALL operator=(const DaryHeap<T, ARITY, C>& aOther) {
+			mData = aOther.mData;
+			mCompare = aOther.mCompare;
+			return *this;
+		}
+
+		DaryHeap<T, ARITY, C>& SOLAIRE_DEFAULT_CALL operator=(DaryHeap<T, ARITY, C>&& aOther) {
+			mData = std::move(aOther.mData);
+			mCompare = aOther.mCompare;
+			return *this;
+		}
+
+		template<class ...PARAMS>
+		void SOLAIRE_DEFAULT_CALL Emplace(PARAMS&&... aParams) {
+			mData.EmplaceBack(std::forward<PARAMS>(aParams)...);
+			SiftUp(mData.Size() - 1);
+		}
+
+		SOLAIRE_FORCE_INLINE void SOLAIRE_DEFAULT_CALL Push(const T& aValue) {
+			Emplace(aValue);
+		}
+
+		SOLAIRE_FORCE_INLINE void SOLAIRE_DEFAULT_CALL Push(T&& aValue) {
+			Emplace(std::move(aValue));
+		}
+
+		/*!
+			\brief Add several elements.
+			\detail
+			If more elements are added than the heap already holds, the whole heap is rebuilt in O(n), otherwise each element
+			is sifted up on its own.
+			\param aValues The elements to add.
+			\param aCount The number of elements.
+		*/
+		void SOLAIRE_DEFAULT_CALL PushRange(const T* const aValues, const uint32_t aCount) {
+			const uint32_t size = mData.Size();
+			mData.PushBackRange(aValues, aCount);
+			if(aCount > size) {
+				Heapify();
+			}else {
+				for(uint32_t i = 0; i < aCount; ++i) SiftUp(size + i);
+			}
+		}
+
+		/*!
+			\brief Replace the contents of the heap with the elements of a container.
+			\detail The heap is built bottom up in O(n), rather than O(n log n) for pushing each element.
+			\param aValues The container to copy from.
+		*/
+		void SOLAIRE_DEFAULT_CALL Assign(const FixedContainer<T>& aValues) {
+			mData.Clear();
+			mData.Reserve(aValues.Size());
+			aValues.ForEachChunk([this](const T* const aChunk, const uint32_t aLength) {
+				mData.PushBackRange(aChunk, aLength);
+			});
+			Heapify();
+		}
+
+		/*!
+			\brief Restore the heap order of every element.
+		*/
+		void SOLAIRE_DEFAULT_CALL Heapify() {
+			const uint32_t size = mData.Size();
+			if(size <= 1) return;
+			for(uint32_t i = (size - 2) / ARITY + 1; i > 0; --i) SiftDown(i - 1);
+		}
+
+		SOLAIRE_FORCE_INLINE const T& SOLAIRE_DEFAULT_CALL Top() const {
+			SolaireRuntimeAssert(mData.Size() > 0, "SolaireCPP : DaryHeap::Top called on an empty heap");
+			return mData[0];
+		}
+
+		/*!
+			\brief Remove the element at the top of the heap.
+			\return The element.
+		*/
+		T SOLAIRE_DEFAULT_CALL Pop() {
+			const uint32_t size = mData.Size();
+			SolaireRuntimeAssert(size > 0, "SolaireCPP : DaryHeap::Pop called on an empty heap");
+			T top = std::move(mData[0]);
+			if(size > 1) {
+				mData[0] = mData.PopBack();
+				SiftDown(0);
+			}else {
+				mData.PopBack();
+			}
+			return top;
+		}
+
+		SOLAIRE_FORCE_INLINE void SOLAIRE_DEFAULT_CALL Clear() {
+			mData.Clear();
+		}
+
+		SOLAIRE_FORCE_INLINE bool SOLAIRE_DEFAULT_CALL Reserve(const uint32_t aCapacity) {
+			return mData.Reserve(aCapacity);
+		}
+
+		SOLAIRE_FORCE_INLINE uint32_t SOLAIRE_DEFAULT_CALL Size() const throw() {
+			return mData.Size();
+		}
+
+		SOLAIRE_FORCE_INLINE bool SOLAIRE_DEFAULT_CALL IsEmpty() const throw() {
+			return mData.Size() == 0;
+		}
+
+		/*!
+			\brief Get the elements in heap order.
+		*/
+		SOLAIRE_FORCE_INLINE const FixedContainer<T>& SOLAIRE_DEFAULT_CALL GetElements() const throw() {
+			return mData;
+		}
+
+		SOLAIRE_FORCE_INLINE Allocator& SOLAIRE_DEFAULT_CALL GetAllocator() const throw() {
+			return mData.GetAllocator();
+		}
+	};
+
+	/*!
+		\class IndexedDaryHeap
+		\brief A d-ary heap that returns a handle for each element, so that its priority can be changed after it was pushed.
+		\detail
+		A table maps each handle to the element's index in the heap, it is updated whenever an element moves. Handles are
+		small integers that are reused once their element is popped or erased, so callers can index their own arrays with them.
+		Changing a priority or erasing an element is O(log n).
+		\tparam T The element type.
+		\tparam ARITY The number of children of each node.
+		\tparam C The ordering of the elements.
+		\author Adam Smith
+		\date Created : 18th October 2026
+		\date Modified : 18th October 2026
+		\version 1.0
+		\see DaryHeap
+	*/
+	template<class T, uint32_t ARITY = 4, class C = Less<T>>
+	class IndexedDaryHeap {
+	public:
+		static_assert(ARITY >= 2, "SolaireCPP : IndexedDaryHeap arity must be at least 2");
+
+		typedef uint32_t Handle;
+
+		enum : uint32_t {
+			INVALID_HANDLE = UINT32_MAX
+		};
+	private:
+		struct Entry {
+			T Value;
+			Handle ID;
+		};
+
+		struct EntryCompare {
+			C& Compare;
+
+			SOLAIRE_FORCE_INLINE bool SOLAIRE_DEFAULT_CALL operator()(const Entry& aFirst, const Entry& aSecond) const {
+				return Compare(aFirst.Value, aSecond.Value);
+			}
+		};
+
+		enum : uint32_t {
+			NOT_IN_HEAP = UINT32_MAX
+		};
+	private:
+		DynamicArray<Entry> mEntries;
+		DynamicArray<uint32_t> mPositions;
+		DynamicArray<Handle> mFreeHandles;
+		C mCompare;
+	private:
+		IndexedDaryHeap(const IndexedDaryHeap&) = delete;
+		IndexedDaryHeap(IndexedDaryHeap&&) = delete;
+		IndexedDaryHeap& operator=(const IndexedDaryHeap&) = delete;
+		IndexedDaryHeap& operator=(IndexedDaryHeap&&) = delete;
+
+		void SOLAIRE_DEFAULT_CALL SiftUp(const uint32_t aIndex) {
+			Entry* const entries = &mEntries[0];
+			uint32_t* const positions = &mPositions[0];
+			EntryCompare compare = {mCompare};
+			Implementation::HeapSiftUp<ARITY>(entries, aIndex, compare, [entries, positions](const uint32_t aIndex) {
+				positions[entries[aIndex].ID] = aIndex;
+			});
+		}
+
+		void SOLAIRE_DEFAULT_CALL SiftDown(const uint32_t aIndex) {
+			Entry* const entries = &mEntries[0];
+			uint32_t* const positions = &mPositions[0];
+			EntryCompare compare = {mCompare};
+			Implementation::HeapSiftDown<ARITY>(entries, aIndex, mEntries.Size(), compare, [entries, positions](const uint32_t aIndex) {
+				positions[entries[aIndex].ID] = aIndex;
+			});
+		}
+
+		SOLAIRE_FORCE_INLINE uint32_t SOLAIRE_DEFAULT_CALL GetPosition(const Handle aHandle) const {
+			SolaireRuntimeAssert(Contains(aHandle), "SolaireCPP : IndexedDaryHeap handle is not in the heap");
+			return mPositions[aHandle];
+		}
+
+		void SOLAIRE_DEFAULT_CALL RemoveAt(const uint32_t aIndex) {
+			const Handle handle = mEntries[aIndex].ID;
+			mPositions[handle] = NOT_IN_HEAP;
+			mFreeHandles.PushBack(handle);
+
+			const uint32_t last = mEntries.Size() - 1;
+			if(aIndex == last) {
+				mEntries.PopBack();
+				return;
+			}
+
+			// Move the last element into the gap, it may belong above or below it
+			mEntries[aIndex] = mEntries.PopBack();
+			mPositions[mEntries[aIndex].ID] = aIndex;
+			if(aIndex > 0 && mCompare(mEntries[aIndex].Value, mEntries[(aIndex - 1) / ARITY].Value)) {
+				SiftUp(aIndex);
+			}else {
+				SiftDown(aIndex);
+			}
+		}
+	public:
+		IndexedDaryHeap(Allocator& aAllocator, const C aCompare = C()) :
+			mEntries(aAllocator),
+			mPositions(aAllocator),
+			mFreeHandles(aAllocator),
+			mCompare(aCompare)
+		{}
+
+		/*!
+			\brief Add an element.
+			\param aValue The element.
+			\return The handle of the element, it stays valid until the element is popped or erased.
+		*/
+		template<class V>
+		Handle SOLAIRE_DEFAULT_CALL Push(V&& aValue) {
+			Handle handle;
+			if(mFreeHandles.Size() > 0) {
+				handle = mFreeHandles.PopBack();
+			}else {
+				handle = mPositions.Size();
+				mPositions.PushBack(NOT_IN_HEAP);
+			}
+
+			const uint32_t index = mEntries.Size();
+			mEntries.PushBack(Entry{std::forward<V>(aValue), handle});
+			mPositions[handle] = index;
+			SiftUp(index);
+			return handle;
+		}
+
+		/*!
+			\brief Change the priority of an element.
+			\param aHandle The handle of the element.
+			\param aValue The new value of the element, it may be ordered before or after the old value.
+		*/
+		template<class V>
+		void SOLAIRE_DEFAULT_CALL Update(const Handle aHandle, V&& aValue) {
+			const uint32_t index = GetPosition(aHandle);
+			T& value = mEntries[index].Value;
+			const bool up = mCompare(aValue, value);
+			value = std::forward<V>(aValue);
+			if(up) {
+				SiftUp(index);
+			}else {
+				SiftDown(index);
+			}
+		}
+
+		/*!
+			\brief Move an element closer to the top of the heap.
+			\detail Cheaper than Update because the element can only move towards the root.
+			\param aHandle The handle of the element.
+			\param aValue The new value of the element, it must not be ordered after the old value.
+		*/
+		template<class V>
+		void SOLAIRE_DEFAULT_CALL DecreaseKey(const Handle aHandle, V&& aValue) {
+			const uint32_t index = GetPosition(aHandle);
+			SolaireRuntimeAssert(! mCompare(mEntries[index].Value, aValue), "SolaireCPP : IndexedDaryHeap::DecreaseKey would move the element away from the top");
+			mEntries[index].Value = std::forward<V>(aValue);
+			SiftUp(index);
+		}
+
+		/*!
+			\brief Remove an element from anywhere in the heap.
+			\param aHandle The handle of the element, it becomes invalid.
+		*/
+		void SOLAIRE_DEFAULT_CALL Erase(const Handle aHandle) {
+			RemoveAt(GetPosition(aHandle));
+		}
+
+		/*!
+			\brief Remove the element at the top of the heap.
+			\return The element, its handle becomes invalid.
+		*/
+		T SOLAIRE_DEFAULT_CALL Pop() {
+			SolaireRuntimeAssert(mEntries.Size() > 0, "SolaireCPP : IndexedDaryHeap::Pop called on an empty heap");
+			T top = std::move(mEntries[0].Value);
+			RemoveAt(0);
+			return top;
+		}
+
+		SOLAIRE_FORCE_INLINE const T& SOLAIRE_DEFAULT_CALL Top() const {
+			SolaireRuntimeAssert(mEntries.Size() > 0, "SolaireCPP : IndexedDaryHeap::Top called on an empty heap");
+			return mEntries[0].Value;
+		}
+
+		SOLAIRE_FORCE_INLINE Handle SOLAIRE_DEFAULT_CALL TopHandle() const {
+			SolaireRuntimeAssert(mEntries.Size() > 0, "SolaireCPP : IndexedDaryHeap::TopHandle called on an empty heap");
+			return mEntries[0].ID;
+		}
+
+		SOLAIRE_FORCE_INLINE const T& SOLAIRE_DEFAULT_CALL Get(const Handle aHandle) const {
+			return mEntries[GetPosition(aHandle)].Value;
+		}
+
+		SOLAIRE_FORCE_INLINE bool SOLAIRE_DEFAULT_CALL Contains(const Handle aHandle) const throw() {
+			return aHandle < mPositions.Size() && mPositions[aHandle] != NOT_IN_HEAP;
+		}
+
+		/*!
+			\brief Remove every element, every handle becomes invalid.
+		*/
+		void SOLAIRE_DEFAULT_CALL Clear() {
+			mEntries.Clear();
+			mPositions.Clear();
+			mFreeHandles.Clear();
+		}
+
+		SOLAIRE_FORCE_INLINE bool SOLAIRE_DEFAULT_CALL Reserve(const uint32_t aCapacity) {
+			return mEntries.Reserve(aCapacity) && mPositions.Reserve(aCapacity);
+		}
+
+		SOLAIRE_FORCE_INLINE uint32_t SOLAIRE_DEFAULT_CALL Size() const throw() {
+			return mEntries.Size();
+		}
+
+		SOLAIRE_FORCE_INLINE bool SOLAIRE_DEFAULT_CALL IsEmpty() const throw() {
+			return mEntries.Size() == 0;
+		}
+
+		SOLAIRE_FORCE_INLINE Allocator& SOLAIRE_DEFAULT_CALL GetAllocator() const throw() {
+			return mEntries.GetAllocator();
+		}
+	};
+
+	/*!
+		\class PairingHeap
+		\brief A priority queue stored as a pairing heap, with O(1) push and decrease key.
+		\detail
+		Each element is a node from an ObjectPool, so handles are stable and elements are never moved. Pop combines the
+		children of the root in two passes, which is O(log n) amortised. The nodes are scattered in memory, so a DaryHeap
+		is usually faster unless priorities are decreased much more often than elements are popped.
+		\tparam T The element type.
+		\tparam C The ordering of the elements.
+		\author Adam Smith
+		\date Created : 18th October 2026
+		\date Modified : 18th October 2026
+		\version 1.0
+		\see DaryHeap
+	*/
+	template<class T, class C = Less<T>>
+	class PairingHeap {
+	private:
+		struct Node {
+			T Value;
+			Node* Child;
+			Node* Next;
+			Node* Previous;		//!< The previous sibling, or the parent if this is the first child.
+
+			template<class ...PARAMS>
+			Node(PARAMS&&... aParams) :
+				Value(std::forward<PARAMS>(aParams)...),
+				Child(nullptr),
+				Next(nullptr),
+				Previous(nullptr)
+			{}
+		};
+	public:
+		typedef Node* Handle;
+	private:
+		ObjectPool<Node> mPool;
+		Node* mRoot;
+		uint32_t mSize;
+		C mCompare;
+	private:
+		PairingHeap(const PairingHeap&) = delete;
+		PairingHeap(PairingHeap&&) = delete;
+		PairingHeap& operator=(const PairingHeap&) = delete;
+		PairingHeap& operator=(PairingHeap&&) = delete;
+
+		/*!
+			\brief Combine two detached trees, the root that is ordered later becomes the first child of the other.
+		*/
+		Node* SOLAIRE_DEFAULT_CALL Meld(Node* aFirst, Node* aSecond) {
+			if(aFirst == nullptr) return aSecond;
+			if(aSecond == nullptr) return aFirst;
+			if(mCompare(aSecond->Value, aFirst->Value)) std::swap(aFirst, aSecond);
+
+			aSecond->Previous = aFirst;
+			aSecond->Next = aFirst->Child;
+			if(aFirst->Child) aFirst->Child->Previous = aSecond;
+			aFirst->Child = aSecond;
+			return aFirst;
+		}
+
+		/*!
+			\brief Combine a list of siblings into one tree.
+			\detail Siblings are melded in pairs from left to right, then the pairs are melded from right to left.
+		*/
+		Node* SOLAIRE_DEFAULT_CALL CombineSiblings(Node* aFirst) {
+			Node* pairs = nullptr;
+			while(aFirst) {
+				Node* a = aFirst;
+				Node* const b = a->Next;
+				aFirst = b ? b->Next : nullptr;
+				a->Next = nullptr;
+				a->Previous = nullptr;
+				if(b) {
+					b->Next = nullptr;
+					b->Previous = nullptr;
+					a = Meld(a, b);
+				}
+
+				// The pairs are kept in reverse order, so the second pass runs from right to left
+				a->Next = pairs;
+				pairs = a;
+			}
+
+			Node* root = nullptr;
+			while(pairs) {
+				Node* const next = pairs->Next;
+				pairs->Next = nullptr;
+				root = Meld(root, pairs);
+				pairs = next;
+			}
+			return root;
+		}
+
+		/*!
+			\brief Remove a node that is not the root from its parent, it becomes the root of a detached tree.
+		*/
+		void SOLAIRE_DEFAULT_CALL Cut(Node* const aNode) throw() {
+			if(aNode->Previous->Child == aNode) {
+				aNode->Previous->Child = aNode->Next;
+			}else {
+				aNode->Previous->Next = aNode->Next;
+			}
+			if(aNode->Next) aNode->Next->Previous = aNode->Previous;
+			aNode->Next = nullptr;
+			aNode->Previous = nullptr;
+		}
+	public:
+		/*!
+			\brief Create an empty heap.
+			\param aAllocator The allocator that nodes will be allocated from.
+			\param aCompare The ordering of the elements.
+		*/
+		PairingHeap(AllocatorI& aAllocator, const C aCompare = C()) :
+			mPool(aAllocator),
+			mRoot(nullptr),
+			mSize(0),
+			mCompare(aCompare)
+		{}
+
+		~PairingHeap() {
+			Clear();
+		}
+
+		/*!
+			\brief Add an element.
+			\return The handle of the element, it stays valid until the element is popped or erased.
+		*/
+		template<class ...PARAMS>
+		Handle SOLAIRE_DEFAULT_CALL Emplace(PARAMS&&... aParams) {
+			Node* const node = mPool.Acquire(std::forward<PARAMS>(aParams)...);
+			SolaireRuntimeAssert(node != nullptr, "SolaireCPP : PairingHeap failed to allocate node");
+			mRoot = Meld(mRoot, node);
+			++mSize;
+			return node;
+		}
+
+		SOLAIRE_FORCE_INLINE Handle SOLAIRE_DEFAULT_CALL Push(const T& aValue) {
+			return Emplace(aValue);
+		}
+
+		SOLAIRE_FORCE_INLINE Handle SOLAIRE_DEFAULT_CALL Push(T&& aValue) {
+			return Emplace(std::move(aValue));
+		}
+
+		/*!
+			\brief Move an element closer to the top of the heap.
+			\detail The element's subtree is cut from its parent and melded with the root in O(1).
+			\param aHandle The handle of the element.
+			\param aValue The new value of the element, it must not be ordered after the old value.
+		*/
+		template<class V>
+		void SOLAIRE_DEFAULT_CALL DecreaseKey(const Handle aHandle, V&& aValue) {
+			SolaireRuntimeAssert(! mCompare(aHandle->Value, aValue), "SolaireCPP : PairingHeap::DecreaseKey would move the element away from the top");
+			aHandle->Value = std::forward<V>(aValue);
+			if(aHandle == mRoot) return;
+			Cut(aHandle);
+			mRoot = Meld(mRoot, aHandle);
+		}
+
+		/*!
+			\brief Remove an element from anywhere in the heap.
+			\param aHandle The handle of the element, it becomes invalid.
+		*/
+		void SOLAIRE_DEFAULT_CALL Erase(const Handle aHandle) {
+			if(aHandle == mRoot) {
+				mRoot = CombineSiblings(aHandle->Child);
+			}else {
+				Cut(aHandle);
+				mRoot = Meld(mRoot, CombineSiblings(aHandle->Child));
+			}
+			mPool.Release(aHandle);
+			--mSize;
+		}
+
+		/*!
+			\brief Remove the element at the top of the heap.
+			\return The element, its handle becomes invalid.
+		*/
+		T SOLAIRE_DEFAULT_CALL Pop() {
+			SolaireRuntimeAssert(mRoot != nullptr, "SolaireCPP : PairingHeap::Pop called on an empty heap");
+			Node* const root = mRoot;
+			T top = std::move(root->Value);
+			mRoot = CombineSiblings(root->Child);
+			mPool.Release(root);
+			--mSize;
+			return top;
+		}
+
+		SOLAIRE_FORCE_INLINE const T& SOLAIRE_DEFAULT_CALL Top() const {
+			SolaireRuntimeAssert(mRoot != nullptr, "SolaireCPP : PairingHeap::Top called on an empty heap");
+			return mRoot->Value;
+		}
+
+		SOLAIRE_FORCE_INLINE Handle SOLAIRE_DEFAULT_CALL TopHandle() const throw() {
+			return mRoot;
+		}
+
+		SOLAIRE_FORCE_INLINE const T& SOLAIRE_DEFAULT_CALL Get(const Handle aHandle) const throw() {
+			return aHandle->Value;
+		}
+
+		/*!
+			\brief Remove every element, every handle becomes invalid.
+		*/
+		void SOLAIRE_DEFAULT_CALL Clear() {
+			// Walk the tree with a stack that is linked through the Next pointers of the nodes
+			Node* stack = mRoot;
+			while(stack) {
+				Node* const node = stack;
+				stack = node->Next;
+				Node* child = node->Child;
+				while(child) {
+					Node* const next = child->Next;
+					child->Next = stack;
+					stack = child;
+					child = next;
+				}
+				mPool.Release(node);
+			}
+			mRoot = nullptr;
+			mSize = 0;
+		}
+
+		SOLAIRE_FORCE_INLINE uint32_t SOLAIRE_DEFAULT_CALL Size() const throw() {
+			return mSize;
+		}
+
+		SOLAIRE_FORCE_INLINE bool SOLAIRE_DEFAULT_CALL IsEmpty() const throw() {
+			return mSize == 0;
+		}
+	};
+}
+
+#endif
@@ -0,0 +1,442 @@
+#ifndef SOLAIRE_RING_BUFFER_HPP
+#define SOLAIRE_RING_BUFFER_HPP
+
+//Copyright 2015 Adam Smith
+//
+//Licensed under the Apache License, Version 2.0 (the "License");
+//you may not use this file except in compliance with the License.
+//You may obtain a copy of the License at
+//
+//    http://www.apache.org/licenses/LICENSE-2.0
+//
+//Unless required by applicable law or agreed to in writing, software
+//distributed under the License is distributed on an "AS IS" BASIS,
+//WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//See the License for the specific language governing permissions and
+//limitations under the License.
+
+// Contact :
+// Email             : solairelibrary@mail.com
+// GitHub repository : https://github.com/SolaireLibrary/SolaireCPP
+
+/*!
+	\file RingBuffer.hpp
+	\brief
+	\author
+	Created			: Adam Smith
+	Last modified	: Adam Smith
+	\version 1.0
+	\date
+	Created			: 18th October 2026
+	Last Modified	: 18th October 2026
+*/
+
+#include <new>
+#include <cstring>
+#include <utility>
+#include <stdexcept>
+#include <type_traits>
+#include "Allocator.hpp"
+#include "Container.hpp"
+#include "Maths.hpp"
+
+namespace Solaire {
+
+	template<class T>
+	class RingBufferIterator : public Iterator<T>{
+	public:
+		typedef typename Iterator<T>::Type Type;
+		typedef typename Iterator<T>::Offset Offset;
+	private:
+		T* mData;
+		uint32_t mHead;
+		uint32_t mMask;
+		Offset mOffset;
+	protected:
+		//Inherited from Iterator
+		Offset SOLAIRE_EXPORT_CALL GetOffset() const throw() override {
+			return mOffset;
+		}
+	public:
+		RingBufferIterator() :
+			mData(nullptr),
+			mHead(0),
+			mMask(0),
+			mOffset(0)
+		{}
+
+		RingBufferIterator(T* const aData, const uint32_t aHead, const uint32_t aMask) :
+			mData(aData),
+			mHead(aHead),
+			mMask(aMask),
+			mOffset(0)
+		{}
+
+		SOLAIRE_EXPORT_CALL ~RingBufferIterator() {
+
+		}
+
+		// Inherited from Iterator
+
+		Type* SOLAIRE_EXPORT_CALL operator->() throw() override {
+			return mData + ((mHead + mOffset) & mMask);
+		}
+
+		Iterator<Type>& SOLAIRE_EXPORT_CALL operator++() throw() override {
+			++mOffset;
+			return *this;
+		}
+
+		Iterator<Type>& SOLAIRE_EXPORT_CALL operator--() throw() override {
+			--mOffset;
+			return *this;
+		}
+
+		Iterator<Type>& SOLAIRE_EXPORT_CALL operator+=(const Offset aOffset) throw() override {
+			mOffset += aOffset;
+			return *this;
+		}
+
+		Iterator<Type>& SOLAIRE_EXPORT_CALL operator-=(const Offset aOffset) throw() override {
+			mOffset -= aOffset;
+			return *this;
+		}
+	};
+
+	/*!
+		\class RingBuffer
+		\brief A DoubleEndedStack that stores its elements in a circular buffer.
+		\detail
+		The capacity is always a power of two, so indices are wrapped with a mask. Pushing and popping at either end is O(1),
+		when the buffer is full its capacity is doubled. The elements occupy at most two contiguous runs of memory, see GetSpans.
+		\tparam T The type of element stored in the buffer.
+		\author Adam Smith
+		\date Created : 18th October 2026
+		\date Modified : 18th October 2026
+		\version 1.0
+	*/
+	template<class T>
+	class RingBuffer : public DoubleEndedStack<T> {
+	public:
+		typedef typename DoubleEndedStack<T>::Type Type;
+
+		enum : uint32_t {
+			MIN_CAPACITY = 8
+		};
+	private:
+		Allocator* mAllocator;
+		T* mData;
+		uint32_t mHead;
+		uint32_t mSize;
+		uint32_t mCapacity;
+		RingBufferIterator<T> mBeginIterator;
+	private:
+		SOLAIRE_FORCE_INLINE uint32_t SOLAIRE_DEFAULT_CALL Wrap(const uint32_t aIndex) const throw() {
+			return aIndex & (mCapacity - 1);
+		}
+
+		static void SOLAIRE_DEFAULT_CALL CopyElements(const T* const aSrc, T* const aDst, const uint32_t aCount) {
+			if(std::is_trivially_copyable<T>::value) {
+				if(aCount > 0) std::memcpy(static_cast<void*>(aDst), aSrc, sizeof(T) * aCount);
+			}else {
+				for(uint32_t i = 0; i < aCount; ++i) {
+					new(aDst + i) T(aSrc[i]);
+				}
+			}
+		}
+
+		T* SOLAIRE_DEFAULT_CALL AllocateData(const uint32_t aCapacity) {
+			T* const data = static_cast<T*>(mAllocator->Allocate(sizeof(T) * aCapacity));
+			SolaireRuntimeAssert(data != nullptr, "SolaireCPP : RingBuffer failed to allocate memory");
+			return data;
+		}
+
+		void SOLAIRE_DEFAULT_CALL ReplaceData(T* const aData, const uint32_t aCapacity) throw() {
+			for(uint32_t i = 0; i < mSize; ++i) {
+				T& element = mData[Wrap(mHead + i)];
+				new(aData + i) T(std::move(element));
+				element.~T();
+			}
+			if(mData) mAllocator->Deallocate(mData);
+			mData = aData;
+			mCapacity = aCapacity;
+			mHead = 0;
+		}
+
+		void SOLAIRE_DEFAULT_CALL Destroy() throw() {
+			Clear();
+			if(mData) mAllocator->Deallocate(mData);
+			mData = nullptr;
+			mCapacity = 0;
+		}
+	public:
+		RingBuffer(Allocator& aAllocator) throw() :
+			mAllocator(&aAllocator),
+			mData(nullptr),
+			mHead(0),
+			mSize(0),
+			mCapacity(0)
+		{}
+
+		RingBuffer(Allocator& aAllocator, const uint32_t aCapacity) :
+			mAllocator(&aAllocator),
+			mData(nullptr),
+			mHead(0),
+			mSize(0),
+			mCapacity(0)
+		{
+			Reserve(aCapacity);
+		}
+
+		RingBuffer(const RingBuffer<T>& aOther) :
+			mAllocator(aOther.mAllocator),
+			mData(nullptr),
+			mHead(0),
+			mSize(0),
+			mCapacity(0)
+		{
+			operator=(static_cast<const FixedContainer<T>&>(aOther));
+		}
+
+		RingBuffer(RingBuffer<T>&& aOther) throw() :
+			mAllocator(aOther.mAllocator),
+			mData(aOther.mData),
+			mHead(aOther.mHead),
+			mSize(aOther.mSize),
+			mCapacity(aOther.mCapacity)
+		{
+			aOther.mData = nullptr;
+			aOther.mHead = 0;
+			aOther.mSize = 0;
+			aOther.mCapacity = 0;
+		}
+
+		SOLAIRE_EXPORT_CALL ~RingBuffer() {
+			Destroy();
+		}
+
+		RingBuffer<T>& SOLAIRE_DEFAULT_CALL operator=(const RingBuffer<T>& aOther) {
+			operator=(static_cast<const FixedContainer<T>&>(aOther));
+			return *this;
+		}
+
+		RingBuffer<T>& SOLAIRE_DEFAULT_CALL operator=(RingBuffer<T>&& aOther) throw() {
+			if(&aOther == this) return *this;
+			Destroy();
+			mAllocator = aOther.mAllocator;
+			mData = aOther.mData;
+			mHead = aOther.mHead;
+			mSize = aOther.mSize;
+			mCapacity = aOther.mCapacity;
+			aOther.mData = nullptr;
+			aOther.mHead = 0;
+			aOther.mSize = 0;
+			aOther.mCapacity = 0;
+			return *this;
+		}
+
+		/*!
+			\brief Construct a new element at the back of the buffer.
+			\tparam PARAMS The parameter types to pass to the element's constructor.
+			\param aParams The parameters to pass to the element's constructor.
+			\return The new element.
+		*/
+		template<class ...PARAMS>
+		T& SOLAIRE_DEFAULT_CALL EmplaceBack(PARAMS&&... aParams) {
+			if(mSize == mCapacity) {
+				// Construct the new element first in case a parameter references an existing element
+				const uint32_t capacity = Max<uint32_t>(mCapacity * 2, MIN_CAPACITY);
+				T* const data = AllocateData(capacity);
+				new(data + mSize) T(std::forward<PARAMS>(aParams)...);
+				ReplaceData(data, capacity);
+				return mData[mSize++];
+			}
+
+			T* const element = mData + Wrap(mHead + mSize);
+			new(element) T(std::forward<PARAMS>(aParams)...);
+			++mSize;
+			return *element;
+		}
+
+		/*!
+			\brief Construct a new element at the front of the buffer.
+			\tparam PARAMS The parameter types to pass to the element's constructor.
+			\param aParams The parameters to pass to the element's constructor.
+			\return The new element.
+		*/
+		template<class ...PARAMS>
+		T& SOLAIRE_DEFAULT_CALL EmplaceFront(PARAMS&&... aParams) {
+			if(mSize == mCapacity) {
+				const uint32_t capacity = Max<uint32_t>(mCapacity * 2, MIN_CAPACITY);
+				T* const data = AllocateData(capacity);
+				new(data + (capacity - 1)) T(std::forward<PARAMS>(aParams)...);
+				ReplaceData(data, capacity);
+				mHead = capacity - 1;
+				++mSize;
+				return mData[mHead];
+			}
+
+			const uint32_t head = Wrap(mHead - 1);
+			new(mData + head) T(std::forward<PARAMS>(aParams)...);
+			mHead = head;
+			++mSize;
+			return mData[head];
+		}
+
+		using DoubleEndedStack<T>::PushBackRange;
+
+		SOLAIRE_FORCE_INLINE const T& SOLAIRE_DEFAULT_CALL operator[](const uint32_t aIndex) const throw() {
+			return mData[Wrap(mHead + aIndex)];
+		}
+
+		SOLAIRE_FORCE_INLINE uint32_t SOLAIRE_DEFAULT_CALL GetCapacity() const throw() {
+			return mCapacity;
+		}
+
+		/*!
+			\brief Get the elements as two contiguous runs of memory.
+			\detail The elements in order are \a aFirst[0 ... aFirstLength - 1] followed by \a aSecond[0 ... aSecondLength - 1].
+			\param aFirst Set to the address of the front element.
+			\param aFirstLength Set to the number of elements in the first run.
+			\param aSecond Set to the address of the element after the wrap point, or nullptr if the elements do not wrap.
+			\param aSecondLength Set to the number of elements in the second run.
+		*/
+		void SOLAIRE_DEFAULT_CALL GetSpans(T*& aFirst, uint32_t& aFirstLength, T*& aSecond, uint32_t& aSecondLength) throw() {
+			aFirst = mData + mHead;
+			if(mHead + mSize <= mCapacity) {
+				aFirstLength = mSize;
+				aSecond = nullptr;
+				aSecondLength = 0;
+			}else {
+				aFirstLength = mCapacity - mHead;
+				aSecond = mData;
+				aSecondLength = mSize - aFirstLength;
+			}
+		}
+
+		void SOLAIRE_DEFAULT_CALL GetSpans(const T*& aFirst, uint32_t& aFirstLength, const T*& aSecond, uint32_t& aSecondLength) const throw() {
+			T* first;
+			T* second;
+			const_cast<RingBuffer<T>*>(this)->GetSpans(first, aFirstLength, second, aSecondLength);
+			aFirst = first;
+			aSecond = second;
+		}
+
+		// Inherited from FixedContainer
+
+		uint32_t SOLAIRE_EXPORT_CALL Size() const override {
+			return mSize;
+		}
+
+		Type& SOLAIRE_EXPORT_CALL operator[](const uint32_t aIndex) override {
+			return mData[Wrap(mHead + aIndex)];
+		}
+
+		bool SOLAIRE_EXPORT_CALL IsContiguous() const override {
+			return false;
+		}
+
+		Allocator& SOLAIRE_EXPORT_CALL GetAllocator() const override {
+			return *mAllocator;
+		}
+
+		bool SOLAIRE_EXPORT_CALL Reserve(const uint32_t aCapacity) override {
+			if(aCapacity <= mCapacity) return true;
+			const uint32_t capacity = Max<uint32_t>(NextPowerOfTwo(aCapacity), MIN_CAPACITY);
+			T* const data = static_cast<T*>(mAllocator->Allocate(sizeof(T) * capacity));
+			if(data == nullptr) return false;
+			ReplaceData(data, capacity);
+			return true;
+		}
+
+		Solaire::Iterator<T>& SOLAIRE_EXPORT_CALL GetBeginIterator() override {
+			mBeginIterator = RingBufferIterator<T>(mData, mHead, mCapacity - 1);
+			return mBeginIterator;
+		}
+
+		Type* SOLAIRE_EXPORT_CALL GetChunk(const uint32_t aIndex, uint32_t& aLength) override {
+			const uint32_t index = Wrap(mHead + aIndex);
+			aLength = Min<uint32_t>(mSize - aIndex, mCapacity - index);
+			return mData + index;
+		}
+
+		// Inherited from Stack
+
+		Type& SOLAIRE_EXPORT_CALL PushBack(const Type& aValue) override {
+			return EmplaceBack(aValue);
+		}
+
+		Type& SOLAIRE_EXPORT_CALL PushBack(Type&& aValue) override {
+			return EmplaceBack(std::move(aValue));
+		}
+
+		void SOLAIRE_EXPORT_CALL PushBackRange(const Type* const aValues, const uint32_t aCount) override {
+			if(aCount == 0) return;
+			const uint32_t size = mSize + aCount;
+
+			if(size > mCapacity) {
+				// Copy the new elements first in case they are elements of this buffer
+				const uint32_t capacity = Max<uint32_t>(NextPowerOfTwo(size), MIN_CAPACITY);
+				T* const data = AllocateData(capacity);
+				CopyElements(aValues, data + mSize, aCount);
+				ReplaceData(data, capacity);
+			}else {
+				const uint32_t tail = Wrap(mHead + mSize);
+				const uint32_t length = Min<uint32_t>(aCount, mCapacity - tail);
+				CopyElements(aValues, mData + tail, length);
+				CopyElements(aValues + length, mData, aCount - length);
+			}
+
+			mSize = size;
+		}
+
+		Type SOLAIRE_EXPORT_CALL PopBack() override {
+			SolaireRuntimeAssert(mSize > 0, "SolaireCPP : RingBuffer::PopBack called on an empty buffer");
+			--mSize;
+			T& element = mData[Wrap(mHead + mSize)];
+			T tmp(std::move(element));
+			element.~T();
+			return tmp;
+		}
+
+		Stack<T>& SOLAIRE_EXPORT_CALL operator=(const FixedContainer<T>& aOther) override {
+			if(&aOther == this) return *this;
+			Clear();
+			PushBackRange(aOther);
+			return *this;
+		}
+
+		void SOLAIRE_EXPORT_CALL Clear() override {
+			if(! std::is_trivially_destructible<T>::value) {
+				for(uint32_t i = 0; i < mSize; ++i) {
+					mData[Wrap(mHead + i)].~T();
+				}
+			}
+			mHead = 0;
+			mSize = 0;
+		}
+
+		// Inherited from DoubleEndedStack
+
+		Type& SOLAIRE_EXPORT_CALL PushFront(const Type& aValue) override {
+			return EmplaceFront(aValue);
+		}
+
+		Type& SOLAIRE_EXPORT_CALL PushFront(Type&& aValue) override {
+			return EmplaceFront(std::move(aValue));
+		}
+
+		Type SOLAIRE_EXPORT_CALL PopFront() override {
+			SolaireRuntimeAssert(mSize > 0, "SolaireCPP : RingBuffer::PopFront called on an empty buffer");
+			T& element = mData[mHead];
+			T tmp(std::move(element));
+			element.~T();
+			mHead = Wrap(mHead + 1);
+			--mSize;
+			return tmp;
+		}
+	};
+
+}
+
+#endif
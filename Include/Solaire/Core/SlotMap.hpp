@@ -0,0 +1,454 @@
+#ifndef SOLAIRE_SLOT_MAP_HPP
+#define SOLAIRE_SLOT_MAP_HPP
+
+//Copyright 2015 Adam Smith
+//
+//Licensed under the Apache License, Version 2.0 (the "License");
+//you may not use this file except in compliance with the License.
+//You may obtain a copy of the License at
+//
+//    http://www.apache.org/licenses/LICENSE-2.0
+//
+//Unless required by applicable law or agreed to in writing, software
+//distributed under the License is distributed on an "AS IS" BASIS,
+//WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//See the License for the specific language governing permissions and
+//limitations under the License.
+
+// Contact :
+// Email             : solairelibrary@mail.com
+// GitHub repository : https://github.com/SolaireLibrary/SolaireCPP
+
+/*!
+	\file SlotMap.hpp
+	\brief
+	\author
+	Created			: Adam Smith
+	Last modified	: Adam Smith
+	\version 1.0
+	\date
+	Created			: 18th October 2026
+	Last Modified	: 18th October 2026
+*/
+
+#include <new>
+#include <cstring>
+#include <utility>
+#include <stdexcept>
+#include <type_traits>
+#include "AllocatorI.hpp"
+#include "Iterator.hpp"
+#include "Maths.hpp"
+
+namespace Solaire {
+
+	/*!
+		\class SlotMapHandle
+		\brief A 64 bit reference to a value in a SlotMap.
+		\detail
+		The generation of a slot is odd while it holds a value and is incremented when the value is inserted and erased,
+		so a handle to an erased value never matches the slot again. A default constructed handle is never valid.
+		\author Adam Smith
+		\date Created : 18th October 2026
+		\date Modified : 18th October 2026
+		\version 1.0
+	*/
+	struct SlotMapHandle {
+		uint32_t Index;
+		uint32_t Generation;
+
+		SlotMapHandle() throw() :
+			Index(0),
+			Generation(0)
+		{}
+
+		SlotMapHandle(const uint32_t aIndex, const uint32_t aGeneration) throw() :
+			Index(aIndex),
+			Generation(aGeneration)
+		{}
+
+		explicit SlotMapHandle(const uint64_t aValue) throw() :
+			Index(static_cast<uint32_t>(aValue)),
+			Generation(static_cast<uint32_t>(aValue >> 32L))
+		{}
+
+		SOLAIRE_FORCE_INLINE uint64_t SOLAIRE_DEFAULT_CALL GetValue() const throw() {
+			return (static_cast<uint64_t>(Generation) << 32L) | Index;
+		}
+
+		SOLAIRE_FORCE_INLINE bool SOLAIRE_DEFAULT_CALL operator==(const SlotMapHandle aOther) const throw() {
+			return Index == aOther.Index && Generation == aOther.Generation;
+		}
+
+		SOLAIRE_FORCE_INLINE bool SOLAIRE_DEFAULT_CALL operator!=(const SlotMapHandle aOther) const throw() {
+			return Index != aOther.Index || Generation != aOther.Generation;
+		}
+	};
+
+	static_assert(sizeof(SlotMapHandle) == sizeof(uint64_t), "SolaireCPP : SlotMapHandle must be 64 bits");
+
+	/*!
+		\class SlotMap
+		\brief Stores values that are referenced by handles which stay valid while the values are moved.
+		\detail
+		Values are kept packed at the start of a single array, erasing a value moves the last value into its place.
+		Each handle indexes a slot, which holds the current position of its value and a generation that detects
+		handles to erased values. Inserting, erasing and looking up a value are all constant time.
+		Inserting or erasing may move values, invalidating pointers and iterators but not handles.
+		\tparam T The value type.
+		\author Adam Smith
+		\date Created : 18th October 2026
+		\date Modified : 18th October 2026
+		\version 1.0
+	*/
+	template<class T>
+	class SlotMap {
+	public:
+		typedef SlotMapHandle Handle;
+		typedef IteratorPtr<T> Iterator;
+		typedef IteratorPtr<const T> ConstIterator;
+
+		enum : uint32_t {
+			MIN_CAPACITY = 16,
+			NO_SLOT = UINT32_MAX
+		};
+	private:
+		struct Slot {
+			uint32_t Index;			// The position of the value, or the next free slot
+			uint32_t Generation;	// Odd while the slot holds a value
+		};
+	private:
+		AllocatorI* mAllocator;
+		T* mValues;
+		uint32_t* mValueSlots;
+		Slot* mSlots;
+		uint32_t mSize;
+		uint32_t mCapacity;
+		uint32_t mSlotCount;
+		uint32_t mFreeSlot;
+	private:
+		static SOLAIRE_FORCE_INLINE uint32_t SOLAIRE_DEFAULT_CALL ValueSlotOffset(const uint32_t aCapacity) throw() {
+			return CeilToMultiple<uint32_t>(sizeof(T) * aCapacity, std::alignment_of<uint32_t>::value);
+		}
+
+		static SOLAIRE_FORCE_INLINE uint32_t SOLAIRE_DEFAULT_CALL SlotOffset(const uint32_t aCapacity) throw() {
+			return CeilToMultiple<uint32_t>(ValueSlotOffset(aCapacity) + sizeof(uint32_t) * aCapacity, std::alignment_of<Slot>::value);
+		}
+
+		void SOLAIRE_DEFAULT_CALL Reallocate(const uint32_t aCapacity) {
+			// Values, their slot indices and the slots share one allocation
+			void* const block = mAllocator->Allocate(SlotOffset(aCapacity) + sizeof(Slot) * aCapacity);
+			SolaireRuntimeAssert(block != nullptr, "SolaireCPP : SlotMap failed to allocate memory");
+
+			T* const values = static_cast<T*>(block);
+			uint32_t* const valueSlots = reinterpret_cast<uint32_t*>(static_cast<uint8_t*>(block) + ValueSlotOffset(aCapacity));
+			Slot* const slots = reinterpret_cast<Slot*>(static_cast<uint8_t*>(block) + SlotOffset(aCapacity));
+
+			if(std::is_trivially_copyable<T>::value) {
+				if(mSize > 0) std::memcpy(static_cast<void*>(values), mValues, sizeof(T) * mSize);
+			}else {
+				for(uint32_t i = 0; i < mSize; ++i) {
+					new(values + i) T(std::move(mValues[i]));
+					mValues[i].~T();
+				}
+			}
+			if(mSize > 0) std::memcpy(valueSlots, mValueSlots, sizeof(uint32_t) * mSize);
+			if(mSlotCount > 0) std::memcpy(slots, mSlots, sizeof(Slot) * mSlotCount);
+
+			if(mValues) mAllocator->Deallocate(mValues);
+			mValues = values;
+			mValueSlots = valueSlots;
+			mSlots = slots;
+			mCapacity = aCapacity;
+		}
+
+		SOLAIRE_FORCE_INLINE bool SOLAIRE_DEFAULT_CALL IsValid(const Handle aHandle) const throw() {
+			// An even generation belongs to a free slot, whose index links the free list, even if the generation has wrapped
+			return (aHandle.Generation & 1) != 0 && aHandle.Index < mSlotCount && mSlots[aHandle.Index].Generation == aHandle.Generation;
+		}
+
+		template<class ...PARAMS>
+		Handle SOLAIRE_DEFAULT_CALL EmplaceImplementation(PARAMS&&... aParams) {
+			// A new slot is only needed when every slot is in use, so there are never more slots than values
+			const uint32_t slotIndex = mFreeSlot != NO_SLOT ? mFreeSlot : mSlotCount;
+			new(mValues + mSize) T(std::forward<PARAMS>(aParams)...);
+
+			if(slotIndex == mSlotCount) {
+				mSlots[mSlotCount].Generation = 0;
+				++mSlotCount;
+			}else {
+				mFreeSlot = mSlots[slotIndex].Index;
+			}
+
+			Slot& slot = mSlots[slotIndex];
+			slot.Index = mSize;
+			++slot.Generation;
+			mValueSlots[mSize] = slotIndex;
+			++mSize;
+			return Handle(slotIndex, slot.Generation);
+		}
+
+		void SOLAIRE_DEFAULT_CALL Destroy() throw() {
+			Clear();
+			if(mValues) mAllocator->Deallocate(mValues);
+			mValues = nullptr;
+			mValueSlots = nullptr;
+			mSlots = nullptr;
+			mCapacity = 0;
+			mSlotCount = 0;
+			mFreeSlot = NO_SLOT;
+		}
+	public:
+		/*!
+			\brief Create an empty map, no memory is allocated until the first value is inserted.
+			\param aAllocator The allocator that the values and slots will be allocated from.
+		*/
+		SlotMap(AllocatorI& aAllocator) throw() :
+			mAllocator(&aAllocator),
+			mValues(nullptr),
+			mValueSlots(nullptr),
+			mSlots(nullptr),
+			mSize(0),
+			mCapacity(0),
+			mSlotCount(0),
+			mFreeSlot(NO_SLOT)
+		{}
+
+		SlotMap(const SlotMap<T>& aOther) :
+			mAllocator(aOther.mAllocator),
+			mValues(nullptr),
+			mValueSlots(nullptr),
+			mSlots(nullptr),
+			mSize(0),
+			mCapacity(0),
+			mSlotCount(0),
+			mFreeSlot(NO_SLOT)
+		{
+			operator=(aOther);
+		}
+
+		SlotMap(SlotMap<T>&& aOther) throw() :
+			mAllocator(aOther.mAllocator),
+			mValues(aOther.mValues),
+			mValueSlots(aOther.mValueSlots),
+			mSlots(aOther.mSlots),
+			mSize(aOther.mSize),
+			mCapacity(aOther.mCapacity),
+			mSlotCount(aOther.mSlotCount),
+			mFreeSlot(aOther.mFreeSlot)
+		{
+			aOther.mValues = nullptr;
+			aOther.mValueSlots = nullptr;
+			aOther.mSlots = nullptr;
+			aOther.mSize = 0;
+			aOther.mCapacity = 0;
+			aOther.mSlotCount = 0;
+			aOther.mFreeSlot = NO_SLOT;
+		}
+
+		~SlotMap() throw() {
+			Destroy();
+		}
+
+		// Handles from aOther are valid in the copy
+
+		SlotMap<T>& SOLAIRE_DEFAULT_CALL operator=(const SlotMap<T>& aOther) {
+			if(&aOther == this) return *this;
+			Clear();
+			mSlotCount = 0;
+			if(mCapacity < aOther.mCapacity) Reallocate(aOther.mCapacity);
+			for(uint32_t i = 0; i < aOther.mSize; ++i) {
+				new(mValues + i) T(aOther.mValues[i]);
+				++mSize;
+			}
+			if(aOther.mSize > 0) std::memcpy(mValueSlots, aOther.mValueSlots, sizeof(uint32_t) * aOther.mSize);
+			if(aOther.mSlotCount > 0) std::memcpy(mSlots, aOther.mSlots, sizeof(Slot) * aOther.mSlotCount);
+			mSlotCount = aOther.mSlotCount;
+			mFreeSlot = aOther.mFreeSlot;
+			return *this;
+		}
+
+		SlotMap<T>& SOLAIRE_DEFAULT_CALL operator=(SlotMap<T>&& aOther) throw() {
+			if(&aOther == this) return *this;
+			Destroy();
+			mAllocator = aOther.mAllocator;
+			mValues = aOther.mValues;
+			mValueSlots = aOther.mValueSlots;
+			mSlots = aOther.mSlots;
+			mSize = aOther.mSize;
+			mCapacity = aOther.mCapacity;
+			mSlotCount = aOther.mSlotCount;
+			mFreeSlot = aOther.mFreeSlot;
+			aOther.mValues = nullptr;
+			aOther.mValueSlots = nullptr;
+			aOther.mSlots = nullptr;
+			aOther.mSize = 0;
+			aOther.mCapacity = 0;
+			aOther.mSlotCount = 0;
+			aOther.mFreeSlot = NO_SLOT;
+			return *this;
+		}
+
+		/*!
+			\brief Insert a value constructed in place.
+			\tparam PARAMS The parameter types to pass to the value's constructor.
+			\param aParams The parameters to pass to the value's constructor.
+			\return The handle of the new value.
+		*/
+		template<class ...PARAMS>
+		Handle SOLAIRE_DEFAULT_CALL Emplace(PARAMS&&... aParams) {
+			if(mSize == mCapacity) {
+				// Construct the new value first in case a parameter references an existing value
+				T tmp(std::forward<PARAMS>(aParams)...);
+				Reallocate(Max<uint32_t>(mCapacity * 2, MIN_CAPACITY));
+				return EmplaceImplementation(std::move(tmp));
+			}
+			return EmplaceImplementation(std::forward<PARAMS>(aParams)...);
+		}
+
+		SOLAIRE_FORCE_INLINE Handle SOLAIRE_DEFAULT_CALL Insert(const T& aValue) {
+			return Emplace(aValue);
+		}
+
+		SOLAIRE_FORCE_INLINE Handle SOLAIRE_DEFAULT_CALL Insert(T&& aValue) {
+			return Emplace(std::move(aValue));
+		}
+
+		/*!
+			\brief Find the value referenced by a handle.
+			\param aHandle The handle of the value.
+			\return The address of the value, or nullptr if the value has been erased.
+		*/
+		SOLAIRE_FORCE_INLINE T* SOLAIRE_DEFAULT_CALL Find(const Handle aHandle) throw() {
+			return IsValid(aHandle) ? mValues + mSlots[aHandle.Index].Index : nullptr;
+		}
+
+		SOLAIRE_FORCE_INLINE const T* SOLAIRE_DEFAULT_CALL Find(const Handle aHandle) const throw() {
+			return IsValid(aHandle) ? mValues + mSlots[aHandle.Index].Index : nullptr;
+		}
+
+		SOLAIRE_FORCE_INLINE bool SOLAIRE_DEFAULT_CALL Contains(const Handle aHandle) const throw() {
+			return IsValid(aHandle);
+		}
+
+		/*!
+			\brief Erase the value referenced by a handle, the last value is moved into its position.
+			\param aHandle The handle of the value.
+			\return True if the value was erased, false if the handle was not valid.
+		*/
+		bool SOLAIRE_DEFAULT_CALL Erase(const Handle aHandle) throw() {
+			if(! IsValid(aHandle)) return false;
+
+			Slot& slot = mSlots[aHandle.Index];
+			const uint32_t index = slot.Index;
+			const uint32_t last = mSize - 1;
+
+			if(index != last) {
+				mValues[index] = std::move(mValues[last]);
+				mValueSlots[index] = mValueSlots[last];
+				mSlots[mValueSlots[index]].Index = index;
+			}
+			mValues[last].~T();
+			--mSize;
+
+			++slot.Generation;
+			slot.Index = mFreeSlot;
+			mFreeSlot = aHandle.Index;
+			return true;
+		}
+
+		/*!
+			\brief Erase every value, all existing handles become invalid.
+		*/
+		void SOLAIRE_DEFAULT_CALL Clear() throw() {
+			if(! std::is_trivially_destructible<T>::value) {
+				for(uint32_t i = 0; i < mSize; ++i) mValues[i].~T();
+			}
+			for(uint32_t i = 0; i < mSize; ++i) {
+				Slot& slot = mSlots[mValueSlots[i]];
+				++slot.Generation;
+				slot.Index = mFreeSlot;
+				mFreeSlot = mValueSlots[i];
+			}
+			mSize = 0;
+		}
+
+		/*!
+			\brief Allocate enough space for \a aCount values without reallocating.
+			\param aCount The number of values to reserve space for.
+		*/
+		void SOLAIRE_DEFAULT_CALL Reserve(const uint32_t aCount) {
+			if(aCount > mCapacity) Reallocate(aCount);
+		}
+
+		/*!
+			\brief Get the handle of a value from its position in the packed array.
+			\param aIndex The position of the value.
+			\return The handle of the value.
+		*/
+		SOLAIRE_FORCE_INLINE Handle SOLAIRE_DEFAULT_CALL GetHandle(const uint32_t aIndex) const throw() {
+			const uint32_t slot = mValueSlots[aIndex];
+			return Handle(slot, mSlots[slot].Generation);
+		}
+
+		SOLAIRE_FORCE_INLINE T& SOLAIRE_DEFAULT_CALL operator[](const uint32_t aIndex) throw() {
+			return mValues[aIndex];
+		}
+
+		SOLAIRE_FORCE_INLINE const T& SOLAIRE_DEFAULT_CALL operator[](const uint32_t aIndex) const throw() {
+			return mValues[aIndex];
+		}
+
+		/*!
+			\brief Call a function on each value, in packed order.
+			\param aFunction A function with the signature void(Handle aHandle, T& aValue).
+		*/
+		template<class F>
+		void SOLAIRE_DEFAULT_CALL ForEach(F aFunction) {
+			for(uint32_t i = 0; i < mSize; ++i) aFunction(GetHandle(i), mValues[i]);
+		}
+
+		template<class F>
+		void SOLAIRE_DEFAULT_CALL ForEach(F aFunction) const {
+			for(uint32_t i = 0; i < mSize; ++i) aFunction(GetHandle(i), static_cast<const T&>(mValues[i]));
+		}
+
+		SOLAIRE_FORCE_INLINE T* SOLAIRE_DEFAULT_CALL GetData() throw() {
+			return mValues;
+		}
+
+		SOLAIRE_FORCE_INLINE const T* SOLAIRE_DEFAULT_CALL GetData() const throw() {
+			return mValues;
+		}
+
+		SOLAIRE_FORCE_INLINE uint32_t SOLAIRE_DEFAULT_CALL Size() const throw() {
+			return mSize;
+		}
+
+		SOLAIRE_FORCE_INLINE uint32_t SOLAIRE_DEFAULT_CALL GetCapacity() const throw() {
+			return mCapacity;
+		}
+
+		SOLAIRE_FORCE_INLINE AllocatorI& SOLAIRE_DEFAULT_CALL GetAllocator() const throw() {
+			return *mAllocator;
+		}
+
+		SOLAIRE_FORCE_INLINE Iterator SOLAIRE_DEFAULT_CALL begin() throw() {
+			return Iterator(mValues, 0);
+		}
+
+		SOLAIRE_FORCE_INLINE Iterator SOLAIRE_DEFAULT_CALL end() throw() {
+			return Iterator(mValues, mSize);
+		}
+
+		SOLAIRE_FORCE_INLINE ConstIterator SOLAIRE_DEFAULT_CALL begin() const throw() {
+			return ConstIterator(mValues, 0);
+		}
+
+		SOLAIRE_FORCE_INLINE ConstIterator SOLAIRE_DEFAULT_CALL end() const throw() {
+			return ConstIterator(mValues, mSize);
+		}
+	};
+}
+
+#endif
@@ -0,0 +1,100 @@
+#ifndef SOLAIRE_SMALL_ARRAY_HPP
+#define SOLAIRE_SMALL_ARRAY_HPP
+
+//Copyright 2015 Adam Smith
+//
+//Licensed under the Apache License, Version 2.0 (the "License");
+//you may not use this file except in compliance with the License.
+//You may obtain a copy of the License at
+//
+//    http://www.apache.org/licenses/LICENSE-2.0
+//
+//Unless required by applicable law or agreed to in writing, software
+//distributed under the License is distributed on an "AS IS" BASIS,
+//WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//See the License for the specific language governing permissions and
+//limitations under the License.
+
+// Contact :
+// Email             : solairelibrary@mail.com
+// GitHub repository : https://github.com/SolaireLibrary/SolaireCPP
+
+/*!
+	\file SmallArray.hpp
+	\brief
+	\author
+	Created			: Adam Smith
+	Last modified	: Adam Smith
+	\version 1.0
+	\date
+	Created			: 18th October 2026
+	Last Modified	: 18th October 2026
+*/
+
+#include "DynamicArray.hpp"
+
+namespace Solaire {
+
+	/*!
+		\class SmallArray
+		\brief A DynamicArray that stores up to \a COUNT elements inside the object itself.
+		\detail The Allocator is only used once the array grows past \a COUNT elements.
+		\tparam T The type of element stored in the array.
+		\tparam COUNT The number of elements that can be stored without allocating.
+		\author Adam Smith
+		\date Created : 18th October 2026
+		\date Modified : 18th October 2026
+		\version 1.0
+	*/
+	template<class T, const uint32_t COUNT>
+	class SmallArray : public DynamicArray<T> {
+	public:
+		static_assert(COUNT > 0, "SolaireCPP : SmallArray must have an inline capacity of at least 1");
+	private:
+		typename std::aligned_storage<sizeof(T) * COUNT, std::alignment_of<T>::value>::type mBuffer;
+	public:
+		SmallArray(Allocator& aAllocator) throw() :
+			DynamicArray<T>(aAllocator, reinterpret_cast<T*>(&mBuffer), COUNT)
+		{}
+
+		SmallArray(const SmallArray<T, COUNT>& aOther) :
+			DynamicArray<T>(aOther.GetAllocator(), reinterpret_cast<T*>(&mBuffer), COUNT)
+		{
+			DynamicArray<T>::operator=(aOther);
+		}
+
+		SmallArray(SmallArray<T, COUNT>&& aOther) :
+			DynamicArray<T>(aOther.GetAllocator(), reinterpret_cast<T*>(&mBuffer), COUNT)
+		{
+			DynamicArray<T>::operator=(std::move(aOther));
+		}
+
+		SOLAIRE_EXPORT_CALL ~SmallArray() {
+			// Elements must be destroyed before mBuffer
+			this->Clear();
+		}
+
+		SmallArray<T, COUNT>& SOLAIRE_DEFAULT_CALL operator=(const SmallArray<T, COUNT>& aOther) {
+			DynamicArray<T>::operator=(aOther);
+			return *this;
+		}
+
+		SmallArray<T, COUNT>& SOLAIRE_DEFAULT_CALL operator=(SmallArray<T, COUNT>&& aOther) {
+			DynamicArray<T>::operator=(std::move(aOther));
+			return *this;
+		}
+
+		using DynamicArray<T>::operator=;
+
+		/*!
+			\brief Check if the elements are stored inside the object.
+			\return False if the array has grown past \a COUNT elements and is using memory from the Allocator.
+		*/
+		SOLAIRE_FORCE_INLINE bool SOLAIRE_DEFAULT_CALL IsInline() const throw() {
+			return DynamicArray<T>::IsInline();
+		}
+	};
+
+}
+
+#endif
@@ -0,0 +1,633 @@
+#ifndef SOLAIRE_SORT_HPP
+#define SOLAIRE_SORT_HPP
+
+//Copyright 2015 Adam Smith
+//
+//Licensed under the Apache License, Version 2.0 (the "License");
+//you may not use this file except in compliance with the License.
+//You may obtain a copy of the License at
+//
+//    http://www.apache.org/licenses/LICENSE-2.0
+//
+//Unless required by applicable law or agreed to in writing, software
+//distributed under the License is distributed on an "AS IS" BASIS,
+//WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//See the License for the specific language governing permissions and
+//limitations under the License.
+
+// Contact :
+// Email             : solairelibrary@mail.com
+// GitHub repository : https://github.com/SolaireLibrary/SolaireCPP
+
+/*!
+	\file Sort.hpp
+	\brief
+	\author
+	Created			: Adam Smith
+	Last modified	: Adam Smith
+	\version 1.0
+	\date
+	Created			: 18th October 2026
+	Last Modified	: 18th October 2026
+*/
+
+#include <cstring>
+#include <utility>
+#include <type_traits>
+#include "Init.hpp"
+#include "Maths.hpp"
+#include "Allocator.hpp"
+#include "Container.hpp"
+#include "DynamicArray.hpp"
+#include "ParallelAlgorithms.hpp"
+
+namespace Solaire {
+
+	/*!
+		\brief The default comparison of the sorting functions, orders elements with operator<.
+	*/
+	template<class T>
+	struct Less {
+		SOLAIRE_FORCE_INLINE bool SOLAIRE_DEFAULT_CALL operator()(const T& aFirst, const T& aSecond) const {
+			return aFirst < aSecond;
+		}
+	};
+
+	namespace Implementation {
+		enum : uint32_t {
+			SORT_INSERTION_THRESHOLD = 24,
+			SORT_NINTHER_THRESHOLD = 128,
+			SORT_PARTIAL_INSERTION_LIMIT = 8,
+			SORT_RADIX_THRESHOLD = 64,
+			SORT_PARALLEL_THRESHOLD = 4096
+		};
+
+		template<class T, class C>
+		void SOLAIRE_DEFAULT_CALL InsertionSort(T* const aBegin, T* const aEnd, C& aCompare) {
+			if(aBegin == aEnd) return;
+			for(T* i = aBegin + 1; i != aEnd; ++i) {
+				T* j = i;
+				if(aCompare(*j, *(j - 1))) {
+					T tmp = std::move(*j);
+					do {
+						*j = std::move(*(j - 1));
+						--j;
+					}while(j != aBegin && aCompare(tmp, *(j - 1)));
+					*j = std::move(tmp);
+				}
+			}
+		}
+
+		/*!
+			\brief Insertion sort without a bounds check, the element before \a aBegin must not be greater than any element.
+		*/
+		template<class T, class C>
+		void SOLAIRE_DEFAULT_CALL UnguardedInsertionSort(T* const aBegin, T* const aEnd, C& aCompare) {
+			if(aBegin == aEnd) return;
+			for(T* i = aBegin + 1; i != aEnd; ++i) {
+				T* j = i;
+				if(aCompare(*j, *(j - 1))) {
+					T tmp = std::move(*j);
+					do {
+						*j = std::move(*(j - 1));
+						--j;
+					}while(aCompare(tmp, *(j - 1)));
+					*j = std::move(tmp);
+				}
+			}
+		}
+
+		/*!
+			\brief Insertion sort that gives up once it has moved too many elements.
+			\return True if the range was sorted.
+		*/
+		template<class T, class C>
+		bool SOLAIRE_DEFAULT_CALL PartialInsertionSort(T* const aBegin, T* const aEnd, C& aCompare) {
+			if(aBegin == aEnd) return true;
+			uint32_t moves = 0;
+			for(T* i = aBegin + 1; i != aEnd; ++i) {
+				T* j = i;
+				if(aCompare(*j, *(j - 1))) {
+					T tmp = std::move(*j);
+					do {
+						*j = std::move(*(j - 1));
+						--j;
+					}while(j != aBegin && aCompare(tmp, *(j - 1)));
+					*j = std::move(tmp);
+					moves += static_cast<uint32_t>(i - j);
+				}
+				if(moves > SORT_PARTIAL_INSERTION_LIMIT) return false;
+			}
+			return true;
+		}
+
+		template<class T, class C>
+		inline SOLAIRE_FORCE_INLINE void SOLAIRE_DEFAULT_CALL Sort2(T* const aFirst, T* const aSecond, C& aCompare) {
+			if(aCompare(*aSecond, *aFirst)) std::swap(*aFirst, *aSecond);
+		}
+
+		template<class T, class C>
+		inline SOLAIRE_FORCE_INLINE void SOLAIRE_DEFAULT_CALL Sort3(T* const aFirst, T* const aSecond, T* const aThird, C& aCompare) {
+			Sort2(aFirst, aSecond, aCompare);
+			Sort2(aSecond, aThird, aCompare);
+			Sort2(aFirst, aSecond, aCompare);
+		}
+
+		template<class T, class C>
+		void SOLAIRE_DEFAULT_CALL SiftDown(T* const aData, uint32_t aIndex, const uint32_t aCount, C& aCompare) {
+			T value = std::move(aData[aIndex]);
+			while(true) {
+				uint32_t child = aIndex * 2 + 1;
+				if(child >= aCount) break;
+				if(child + 1 < aCount && aCompare(aData[child], aData[child + 1])) ++child;
+				if(! aCompare(value, aData[child])) break;
+				aData[aIndex] = std::move(aData[child]);
+				aIndex = child;
+			}
+			aData[aIndex] = std::move(value);
+		}
+
+		template<class T, class C>
+		void SOLAIRE_DEFAULT_CALL HeapSort(T* const aBegin, T* const aEnd, C& aCompare) {
+			const uint32_t count = static_cast<uint32_t>(aEnd - aBegin);
+			for(uint32_t i = count / 2; i > 0; --i) SiftDown(aBegin, i - 1, count, aCompare);
+			for(uint32_t i = count; i > 1; --i) {
+				std::swap(aBegin[0], aBegin[i - 1]);
+				SiftDown(aBegin, 0, i - 1, aCompare);
+			}
+		}
+
+		/*!
+			\brief Partition a range around its first element, elements equal to the pivot go to the right.
+			\param aAlreadyPartitioned Set to true if no elements had to be swapped.
+			\return The final position of the pivot.
+		*/
+		template<class T, class C>
+		T* SOLAIRE_DEFAULT_CALL PartitionRight(T* const aBegin, T* const aEnd, C& aCompare, bool& aAlreadyPartitioned) {
+			T pivot = std::move(*aBegin);
+			T* first = aBegin;
+			T* last = aEnd;
+
+			// The median of three selection guarantees that these loops stop before leaving the range
+			while(aCompare(*++first, pivot));
+			if(first - 1 == aBegin) {
+				while(first < last && ! aCompare(*--last, pivot));
+			}else {
+				while(! aCompare(*--last, pivot));
+			}
+
+			aAlreadyPartitioned = first >= last;
+			while(first < last) {
+				std::swap(*first, *last);
+				while(aCompare(*++first, pivot));
+				while(! aCompare(*--last, pivot));
+			}
+
+			T* const position = first - 1;
+			*aBegin = std::move(*position);
+			*position = std::move(pivot);
+			return position;
+		}
+
+		/*!
+			\brief Partition a range around its first element, elements equal to the pivot go to the left.
+			\detail Used when the pivot equals an element before the range, so every element equal to it is already in place.
+			\return The final position of the pivot.
+		*/
+		template<class T, class C>
+		T* SOLAIRE_DEFAULT_CALL PartitionLeft(T* const aBegin, T* const aEnd, C& aCompare) {
+			T pivot = std::move(*aBegin);
+			T* first = aBegin;
+			T* last = aEnd;
+
+			while(aCompare(pivot, *--last));
+			if(last + 1 == aEnd) {
+				while(first < last && ! aCompare(pivot, *++first));
+			}else {
+				while(! aCompare(pivot, *++first));
+			}
+
+			while(first < last) {
+				std::swap(*first, *last);
+				while(aCompare(pivot, *--last));
+				while(! aCompare(pivot, *++first));
+			}
+
+			*aBegin = std::move(*last);
+			*last = std::move(pivot);
+			return last;
+		}
+
+		template<class T, class C>
+		void SOLAIRE_DEFAULT_CALL IntroSort(T* aBegin, T* const aEnd, C& aCompare, uint32_t aBadAllowed, bool aLeftmost) {
+			while(true) {
+				const uint32_t size = static_cast<uint32_t>(aEnd - aBegin);
+				if(size < SORT_INSERTION_THRESHOLD) {
+					if(aLeftmost) InsertionSort(aBegin, aEnd, aCompare);
+					else UnguardedInsertionSort(aBegin, aEnd, aCompare);
+					return;
+				}
+
+				// Move the median of three, or the pseudomedian of nine for large ranges, to the start
+				const uint32_t half = size / 2;
+				if(size > SORT_NINTHER_THRESHOLD) {
+					Sort3(aBegin, aBegin + half, aEnd - 1, aCompare);
+					Sort3(aBegin + 1, aBegin + (half - 1), aEnd - 2, aCompare);
+					Sort3(aBegin + 2, aBegin + (half + 1), aEnd - 3, aCompare);
+					Sort3(aBegin + (half - 1), aBegin + half, aBegin + (half + 1), aCompare);
+					std::swap(*aBegin, *(aBegin + half));
+				}else {
+					Sort3(aBegin + half, aBegin, aEnd - 1, aCompare);
+				}
+
+				// If the pivot equals the element before the range, every element equal to it can be skipped
+				if(! aLeftmost && ! aCompare(*(aBegin - 1), *aBegin)) {
+					aBegin = PartitionLeft(aBegin, aEnd, aCompare) + 1;
+					continue;
+				}
+
+				bool alreadyPartitioned;
+				T* const pivot = PartitionRight(aBegin, aEnd, aCompare, alreadyPartitioned);
+				const uint32_t leftSize = static_cast<uint32_t>(pivot - aBegin);
+				const uint32_t rightSize = static_cast<uint32_t>(aEnd - (pivot + 1));
+
+				if(leftSize < size / 8 || rightSize < size / 8) {
+					// Too many bad pivots, fall back to heap sort to keep the worst case O(n log n)
+					if(--aBadAllowed == 0) {
+						HeapSort(aBegin, aEnd, aCompare);
+						return;
+					}
+
+					// Break up patterns that caused the bad pivot
+					if(leftSize >= SORT_INSERTION_THRESHOLD) {
+						const uint32_t quarter = leftSize / 4;
+						std::swap(aBegin[0], aBegin[quarter]);
+						std::swap(pivot[-1], pivot[-static_cast<int32_t>(quarter)]);
+						if(leftSize > SORT_NINTHER_THRESHOLD) {
+							std::swap(aBegin[1], aBegin[quarter + 1]);
+							std::swap(aBegin[2], aBegin[quarter + 2]);
+							std::swap(pivot[-2], pivot[-static_cast<int32_t>(quarter + 1)]);
+							std::swap(pivot[-3], pivot[-static_cast<int32_t>(quarter + 2)]);
+						}
+					}
+
+					if(rightSize >= SORT_INSERTION_THRESHOLD) {
+						const uint32_t quarter = rightSize / 4;
+						std::swap(pivot[1], pivot[1 + quarter]);
+						std::swap(aEnd[-1], aEnd[-static_cast<int32_t>(quarter)]);
+						if(rightSize > SORT_NINTHER_THRESHOLD) {
+							std::swap(pivot[2], pivot[2 + quarter]);
+							std::swap(pivot[3], pivot[3 + quarter]);
+							std::swap(aEnd[-2], aEnd[-static_cast<int32_t>(quarter + 1)]);
+							std::swap(aEnd[-3], aEnd[-static_cast<int32_t>(quarter + 2)]);
+						}
+					}
+				}else if(alreadyPartitioned && PartialInsertionSort(aBegin, pivot, aCompare) && PartialInsertionSort(pivot + 1, aEnd, aCompare)) {
+					// The range was probably already sorted
+					return;
+				}
+
+				IntroSort(aBegin, pivot, aCompare, aBadAllowed, aLeftmost);
+				aBegin = pivot + 1;
+				aLeftmost = false;
+			}
+		}
+
+		/*!
+			\brief Get the run of elements of a container as an array.
+			\return The address of the first element, or nullptr if the container is empty.
+		*/
+		template<class T>
+		T* SOLAIRE_DEFAULT_CALL GetSortRange(FixedContainer<T>& aContainer) {
+			const uint32_t size = aContainer.Size();
+			if(size == 0) return nullptr;
+			uint32_t length;
+			T* const data = aContainer.GetChunk(0, length);
+			SolaireRuntimeAssert(length == size, "SolaireCPP : Sorting requires a contiguous container");
+			return data;
+		}
+
+		/*!
+			\brief Maps a key to an unsigned integer with the same order, so that it can be sorted one byte at a time.
+		*/
+		template<class T, bool INTEGER = std::is_integral<T>::value>
+		struct RadixKey {
+			typedef typename std::make_unsigned<T>::type Type;
+
+			static SOLAIRE_FORCE_INLINE Type SOLAIRE_DEFAULT_CALL Get(const T aKey) throw() {
+				// Flipping the sign bit orders negative values before positive values
+				return static_cast<Type>(aKey) ^ (std::is_signed<T>::value ? static_cast<Type>(static_cast<Type>(1) << (sizeof(T) * 8 - 1)) : static_cast<Type>(0));
+			}
+		};
+
+		template<class T, class U>
+		struct FloatRadixKey {
+			typedef U Type;
+
+			static SOLAIRE_FORCE_INLINE Type SOLAIRE_DEFAULT_CALL Get(const T aKey) throw() {
+				enum : uint32_t { SIGN_SHIFT = sizeof(U) * 8 - 1 };
+				U bits;
+				std::memcpy(&bits, &aKey, sizeof(U));
+				// Negative values have every bit flipped so that larger magnitudes come first, positive values only flip the sign
+				const U mask = (bits >> SIGN_SHIFT) ? ~static_cast<U>(0) : static_cast<U>(static_cast<U>(1) << SIGN_SHIFT);
+				return bits ^ mask;
+			}
+		};
+
+		template<>
+		struct RadixKey<float, false> : public FloatRadixKey<float, uint32_t> {};
+
+		template<>
+		struct RadixKey<double, false> : public FloatRadixKey<double, uint64_t> {};
+	}
+
+	/*!
+		\brief Sort an array.
+		\detail
+		A pattern defeating quicksort: introsort with median of three pivots (pseudomedian of nine for large ranges), special
+		handling of runs of equal elements, early exit on ranges that are already sorted and a heap sort fallback once too
+		many pivots have been bad. O(n log n) in the worst case, the sort is not stable.
+		\param aData The first element.
+		\param aCount The number of elements.
+		\param aCompare A function with the signature bool(const T& aFirst, const T& aSecond) that returns true if the first
+		element should be ordered before the second.
+	*/
+	template<class T, class C>
+	void SOLAIRE_DEFAULT_CALL Sort(T* const aData, const uint32_t aCount, C aCompare) {
+		if(aCount <= 1) return;
+		uint32_t badAllowed = 0;
+		for(uint32_t i = aCount; i > 1; i >>= 1) ++badAllowed;
+		Implementation::IntroSort(aData, aData + aCount, aCompare, badAllowed, true);
+	}
+
+	template<class T>
+	inline SOLAIRE_FORCE_INLINE void SOLAIRE_DEFAULT_CALL Sort(T* const aData, const uint32_t aCount) {
+		Sort(aData, aCount, Less<T>());
+	}
+
+	/*!
+		\brief Sort a container.
+		\param aContainer The container, must be contiguous.
+		\param aCompare The ordering of the elements.
+		\see Sort(T*, uint32_t, C)
+	*/
+	template<class T, class C>
+	void SOLAIRE_DEFAULT_CALL Sort(FixedContainer<T>& aContainer, C aCompare) {
+		Sort(Implementation::GetSortRange(aContainer), aContainer.Size(), aCompare);
+	}
+
+	template<class T>
+	inline SOLAIRE_FORCE_INLINE void SOLAIRE_DEFAULT_CALL Sort(FixedContainer<T>& aContainer) {
+		Sort(aContainer, Less<T>());
+	}
+
+	/*!
+		\brief Sort an array by an integer or floating point key.
+		\detail
+		A least significant digit radix sort with 8 bit digits. A single pass counts every digit, then each digit that is
+		not the same for every element takes one stable pass into a temporary buffer. The sort is stable and O(n).
+		Negative floating point values are ordered before positive values, -0 is ordered before +0 and NaNs are ordered
+		after infinity of the same sign.
+		Small arrays are sorted with an insertion sort instead.
+		\param aData The first element.
+		\param aCount The number of elements.
+		\param aAllocator The allocator that the temporary buffer will be allocated from.
+		\param aKey A function with the signature K(const T& aElement), where K is an arithmetic type.
+		\tparam T The element type, must be trivially copyable.
+	*/
+	template<class T, class F>
+	void SOLAIRE_DEFAULT_CALL RadixSort(T* const aData, const uint32_t aCount, Allocator& aAllocator, F aKey) {
+		typedef typename std::decay<decltype(aKey(*aData))>::type Key;
+		typedef Implementation::RadixKey<Key> Radix;
+		typedef typename Radix::Type Bits;
+		enum : uint32_t {
+			DIGITS = sizeof(Bits)
+		};
+		static_assert(std::is_arithmetic<Key>::value, "SolaireCPP : RadixSort key must be an integer or floating point type");
+		static_assert(std::is_trivially_copyable<T>::value, "SolaireCPP : RadixSort element type must be trivially copyable");
+
+		if(aCount < Implementation::SORT_RADIX_THRESHOLD) {
+			// Insertion sort only moves an element past greater elements, so small arrays stay stable
+			auto compare = [&aKey](const T& aFirst, const T& aSecond) {
+				return Radix::Get(aKey(aFirst)) < Radix::Get(aKey(aSecond));
+			};
+			Implementation::InsertionSort(aData, aData + aCount, compare);
+			return;
+		}
+
+		uint32_t counts[DIGITS][256] = {};
+		for(uint32_t i = 0; i < aCount; ++i) {
+			const Bits bits = Radix::Get(aKey(aData[i]));
+			for(uint32_t j = 0; j < DIGITS; ++j) ++counts[j][(bits >> (j * 8)) & 255];
+		}
+
+		T* const buffer = static_cast<T*>(aAllocator.Allocate(sizeof(T) * aCount));
+		SolaireRuntimeAssert(buffer != nullptr, "SolaireCPP : RadixSort failed to allocate buffer");
+
+		T* src = aData;
+		T* dst = buffer;
+		const Bits firstBits = Radix::Get(aKey(aData[0]));
+		for(uint32_t j = 0; j < DIGITS; ++j) {
+			const uint32_t shift = j * 8;
+			uint32_t* const digitCounts = counts[j];
+
+			// Every element has the same digit, so this pass would not change the order
+			if(digitCounts[(firstBits >> shift) & 255] == aCount) continue;
+
+			uint32_t offset = 0;
+			for(uint32_t k = 0; k < 256; ++k) {
+				const uint32_t count = digitCounts[k];
+				digitCounts[k] = offset;
+				offset += count;
+			}
+
+			for(uint32_t i = 0; i < aCount; ++i) {
+				const Bits bits = Radix::Get(aKey(src[i]));
+				std::memcpy(dst + digitCounts[(bits >> shift) & 255]++, src + i, sizeof(T));
+			}
+			std::swap(src, dst);
+		}
+
+		if(src != aData) std::memcpy(aData, src, sizeof(T) * aCount);
+		aAllocator.Deallocate(buffer);
+	}
+
+	template<class T>
+	void SOLAIRE_DEFAULT_CALL RadixSort(T* const aData, const uint32_t aCount, Allocator& aAllocator) {
+		static_assert(std::is_arithmetic<T>::value, "SolaireCPP : RadixSort without a key requires an integer or floating point type");
+		RadixSort(aData, aCount, aAllocator, [](const T aValue) {
+			return aValue;
+		});
+	}
+
+	/*!
+		\brief Sort a container by an integer or floating point key.
+		\detail The temporary buffer is allocated from the container's allocator.
+		\param aContainer The container, must be contiguous.
+		\param aKey A function with the signature K(const T& aElement), where K is an arithmetic type.
+		\see RadixSort(T*, uint32_t, Allocator&, F)
+	*/
+	template<class T, class F>
+	void SOLAIRE_DEFAULT_CALL RadixSort(FixedContainer<T>& aContainer, F aKey) {
+		RadixSort(Implementation::GetSortRange(aContainer), aContainer.Size(), aContainer.GetAllocator(), aKey);
+	}
+
+	template<class T>
+	void SOLAIRE_DEFAULT_CALL RadixSort(FixedContainer<T>& aContainer) {
+		RadixSort(Implementation::GetSortRange(aContainer), aContainer.Size(), aContainer.GetAllocator());
+	}
+
+	namespace Implementation {
+		/*!
+			\brief The part of a merge of two runs that one task writes.
+		*/
+		struct MergePart {
+			uint32_t Begin;			//!< The index of the first run.
+			uint32_t Middle;		//!< The index of the second run.
+			uint32_t End;			//!< The index after the second run.
+			uint32_t OutBegin;		//!< The first output element written by the task, relative to Begin.
+			uint32_t OutEnd;		//!< The output element after the last one written by the task, relative to Begin.
+			uint32_t FirstBegin;	//!< The number of elements of the first run that come before OutBegin.
+			uint32_t FirstEnd;		//!< The number of elements of the first run that come before OutEnd.
+		};
+
+		/*!
+			\brief Find how many elements of the first array are in the first \a aDiagonal elements of the merge of two arrays.
+		*/
+		template<class T, class C>
+		uint32_t SOLAIRE_DEFAULT_CALL MergePath(const T* const aFirst, const uint32_t aFirstCount, const T* const aSecond, const uint32_t aSecondCount, const uint32_t aDiagonal, C& aCompare) {
+			uint32_t low = aDiagonal > aSecondCount ? aDiagonal - aSecondCount : 0;
+			uint32_t high = Min<uint32_t>(aDiagonal, aFirstCount);
+			while(low < high) {
+				const uint32_t middle = low + (high - low) / 2;
+				if(aCompare(aSecond[aDiagonal - middle - 1], aFirst[middle])) {
+					high = middle;
+				}else {
+					low = middle + 1;
+				}
+			}
+			return low;
+		}
+	}
+
+	/*!
+		\brief Sort an array using the workers of a scheduler.
+		\detail
+		The array is divided into one block per worker, rounded up to a power of two, and each block is sorted with Sort.
+		Pairs of sorted blocks are then merged into a temporary buffer until one run remains. Each merge is divided
+		into equal parts of the output by binary searching the merge path, so every worker takes part in every round.
+		Small arrays, or schedulers without workers, are sorted on the calling thread. The sort is not stable.
+		\param aScheduler The scheduler that will execute the tasks.
+		\param aData The first element.
+		\param aCount The number of elements.
+		\param aCompare The ordering of the elements.
+		\tparam T The element type, must be copyable.
+		\see Sort
+	*/
+	template<class T, class C>
+	void SOLAIRE_DEFAULT_CALL ParallelSort(TaskScheduler& aScheduler, T* const aData, const uint32_t aCount, C aCompare) {
+		const uint32_t threads = aScheduler.GetThreadCount();
+		if(threads <= 1 || aCount < Implementation::SORT_PARALLEL_THRESHOLD) {
+			Sort(aData, aCount, aCompare);
+			return;
+		}
+
+		const uint32_t blocks = NextPowerOfTwo(threads);
+		auto GetBlockBegin = [aCount, blocks](const uint32_t aBlock)->uint32_t {
+			return static_cast<uint32_t>((static_cast<uint64_t>(aCount) * aBlock) / blocks);
+		};
+
+		auto sortBlock = [aData, &GetBlockBegin, &aCompare](const uint32_t aBlock) {
+			const uint32_t begin = GetBlockBegin(aBlock);
+			Sort(aData + begin, GetBlockBegin(aBlock + 1) - begin, aCompare);
+		};
+		Implementation::RunParallelTasks(aScheduler, blocks, sortBlock);
+
+		DynamicArray<T> buffer(aScheduler.GetAllocator(), aCount);
+		buffer.PushBackRange(aData, aCount);
+
+		T* src = aData;
+		T* dst = &buffer[0];
+		DynamicArray<Implementation::MergePart> mergeParts(aScheduler.GetAllocator(), threads);
+		for(uint32_t width = 1; width < blocks; width *= 2) {
+			// Each merge of two runs is divided so that there are about as many parts as threads
+			const uint32_t merges = blocks / (width * 2);
+			const uint32_t parts = Max<uint32_t>(threads / merges, 1);
+
+			// The split points are found before merging, because merging moves elements out of the source.
+			// Each part only compares its own elements, so it never reads an element that another part has moved
+			mergeParts.Clear();
+			for(uint32_t i = 0; i < merges; ++i) {
+				Implementation::MergePart part;
+				part.Begin = GetBlockBegin(i * width * 2);
+				part.Middle = GetBlockBegin(i * width * 2 + width);
+				part.End = GetBlockBegin(i * width * 2 + width * 2);
+				const uint32_t firstCount = part.Middle - part.Begin;
+				const uint32_t secondCount = part.End - part.Middle;
+				const uint32_t total = firstCount + secondCount;
+				part.OutEnd = 0;
+				part.FirstEnd = 0;
+				for(uint32_t j = 0; j < parts; ++j) {
+					part.OutBegin = part.OutEnd;
+					part.FirstBegin = part.FirstEnd;
+					part.OutEnd = static_cast<uint32_t>((static_cast<uint64_t>(total) * (j + 1)) / parts);
+					part.FirstEnd = Implementation::MergePath(src + part.Begin, firstCount, src + part.Middle, secondCount, part.OutEnd, aCompare);
+					mergeParts.PushBack(part);
+				}
+			}
+
+			auto merge = [&mergeParts, src, dst, &aCompare](const uint32_t aTask) {
+				const Implementation::MergePart& part = mergeParts[aTask];
+				T* const first = src + part.Begin;
+				T* const second = src + part.Middle;
+				const uint32_t firstEnd = part.FirstEnd;
+				const uint32_t secondEnd = part.OutEnd - part.FirstEnd;
+
+				uint32_t i = part.FirstBegin;
+				uint32_t j = part.OutBegin - i;
+				T* out = dst + part.Begin + part.OutBegin;
+				for(uint32_t k = part.OutBegin; k < part.OutEnd; ++k) {
+					if(j == secondEnd || (i < firstEnd && ! aCompare(second[j], first[i]))) {
+						*out++ = std::move(first[i++]);
+					}else {
+						*out++ = std::move(second[j++]);
+					}
+				}
+			};
+			Implementation::RunParallelTasks(aScheduler, mergeParts.Size(), merge);
+			std::swap(src, dst);
+		}
+
+		if(src != aData) {
+			auto copyBlock = [aData, src, &GetBlockBegin](const uint32_t aBlock) {
+				const uint32_t end = GetBlockBegin(aBlock + 1);
+				for(uint32_t i = GetBlockBegin(aBlock); i < end; ++i) aData[i] = std::move(src[i]);
+			};
+			Implementation::RunParallelTasks(aScheduler, blocks, copyBlock);
+		}
+	}
+
+	template<class T>
+	inline SOLAIRE_FORCE_INLINE void SOLAIRE_DEFAULT_CALL ParallelSort(TaskScheduler& aScheduler, T* const aData, const uint32_t aCount) {
+		ParallelSort(aScheduler, aData, aCount, Less<T>());
+	}
+
+	/*!
+		\brief Sort a container using the workers of a scheduler.
+		\param aScheduler The scheduler that will execute the tasks.
+		\param aContainer The container, must be contiguous.
+		\param aCompare The ordering of the elements.
+		\see ParallelSort(TaskScheduler&, T*, uint32_t, C)
+	*/
+	template<class T, class C>
+	void SOLAIRE_DEFAULT_CALL ParallelSort(TaskScheduler& aScheduler, FixedContainer<T>& aContainer, C aCompare) {
+		ParallelSort(aScheduler, Implementation::GetSortRange(aContainer), aContainer.Size(), aCompare);
+	}
+
+	template<class T>
+	inline SOLAIRE_FORCE_INLINE void SOLAIRE_DEFAULT_CALL ParallelSort(TaskScheduler& aScheduler, FixedContainer<T>& aContainer) {
+		ParallelSort(aScheduler, aContainer, Less<T>());
+	}
+}
+
+#endif
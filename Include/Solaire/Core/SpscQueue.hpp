@@ -0,0 +1,294 @@
+#ifndef SOLAIRE_SPSC_QUEUE_HPP
+#define SOLAIRE_SPSC_QUEUE_HPP
+
+//Copyright 2015 Adam Smith
+//
+//Licensed under the Apache License, Version 2.0 (the "License");
+//you may not use this file except in compliance with the License.
+//You may obtain a copy of the License at
+//
+//    http://www.apache.org/licenses/LICENSE-2.0
+//
+//Unless required by applicable law or agreed to in writing, software
+//distributed under the License is distributed on an "AS IS" BASIS,
+//WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//See the License for the specific language governing permissions and
+//limitations under the License.
+
+// Contact :
+// Email             : solairelibrary@mail.com
+// GitHub repository : https://github.com/SolaireLibrary/SolaireCPP
+
+/*!
+	\file SpscQueue.hpp
+	\brief
+	\author
+	Created			: Adam Smith
+	Last modified	: Adam Smith
+	\version 1.0
+	\date
+	Created			: 18th October 2026
+	Last Modified	: 18th October 2026
+*/
+
+#include <new>
+#include <atomic>
+#include <cstring>
+#include <utility>
+#include <stdexcept>
+#include <type_traits>
+#include "Init.hpp"
+#include "AllocatorI.hpp"
+#include "Maths.hpp"
+
+namespace Solaire {
+
+	/*!
+		\class SpscQueue
+		\brief A bounded lock-free queue for passing elements from one producer thread to one consumer thread.
+		\detail
+		The capacity is rounded up to a power of two and indices increase without wrapping, so a full queue is told apart
+		from an empty one by the difference between them.
+		The producer's tail and the consumer's head are on separate cache lines. Each side also keeps a copy of the other
+		side's index and only reloads it when the copy says the queue is full or empty, so in steady state each side only
+		touches the other's cache line once per batch rather than once per element.
+
+		Only one thread may call the producer functions (TryPush, TryEmplace, PushRange) and only one thread may call the
+		consumer functions (TryPop, PopRange, Consume) at a time.
+		\tparam T The type of element stored in the queue, must be nothrow move constructible.
+		\author Adam Smith
+		\date Created : 18th October 2026
+		\date Modified : 18th October 2026
+		\version 1.0
+	*/
+	template<class T>
+	class SpscQueue {
+	private:
+		enum : uint32_t {
+			CACHE_LINE = 64
+		};
+
+		struct alignas(CACHE_LINE) Producer {
+			std::atomic<uint32_t> Tail;
+			uint32_t CachedHead;
+		};
+
+		struct alignas(CACHE_LINE) Consumer {
+			std::atomic<uint32_t> Head;
+			uint32_t CachedTail;
+		};
+	private:
+		AllocatorI& mAllocator;
+		T* const mData;
+		const uint32_t mCapacity;
+		const uint32_t mMask;
+		Producer mProducer;
+		Consumer mConsumer;
+	private:
+		SpscQueue(const SpscQueue<T>&) = delete;
+		SpscQueue(SpscQueue<T>&&) = delete;
+		SpscQueue<T>& operator=(const SpscQueue<T>&) = delete;
+		SpscQueue<T>& operator=(SpscQueue<T>&&) = delete;
+
+		SOLAIRE_FORCE_INLINE uint32_t SOLAIRE_DEFAULT_CALL GetFreeSpace(const uint32_t aTail) throw() {
+			uint32_t space = mCapacity - (aTail - mProducer.CachedHead);
+			if(space == 0) {
+				mProducer.CachedHead = mConsumer.Head.load(std::memory_order_acquire);
+				space = mCapacity - (aTail - mProducer.CachedHead);
+			}
+			return space;
+		}
+
+		SOLAIRE_FORCE_INLINE uint32_t SOLAIRE_DEFAULT_CALL GetUsedSpace(const uint32_t aHead) throw() {
+			uint32_t used = mConsumer.CachedTail - aHead;
+			if(used == 0) {
+				mConsumer.CachedTail = mProducer.Tail.load(std::memory_order_acquire);
+				used = mConsumer.CachedTail - aHead;
+			}
+			return used;
+		}
+
+		static SOLAIRE_FORCE_INLINE void SOLAIRE_DEFAULT_CALL CopyRange(T* const aDst, const T* const aSrc, const uint32_t aCount) {
+			if(std::is_trivially_copyable<T>::value) {
+				if(aCount > 0) std::memcpy(static_cast<void*>(aDst), aSrc, sizeof(T) * aCount);
+			}else {
+				for(uint32_t i = 0; i < aCount; ++i) new(aDst + i) T(aSrc[i]);
+			}
+		}
+
+		static SOLAIRE_FORCE_INLINE void SOLAIRE_DEFAULT_CALL MoveRange(T* const aDst, T* const aSrc, const uint32_t aCount) {
+			if(std::is_trivially_copyable<T>::value) {
+				if(aCount > 0) std::memcpy(static_cast<void*>(aDst), aSrc, sizeof(T) * aCount);
+			}else {
+				for(uint32_t i = 0; i < aCount; ++i) {
+					aDst[i] = std::move(aSrc[i]);
+					aSrc[i].~T();
+				}
+			}
+		}
+
+		static SOLAIRE_FORCE_INLINE void SOLAIRE_DEFAULT_CALL DestroyRange(T* const aData, const uint32_t aCount) throw() {
+			if(! std::is_trivially_destructible<T>::value) {
+				for(uint32_t i = 0; i < aCount; ++i) aData[i].~T();
+			}
+		}
+	public:
+		/*!
+			\brief Create an empty queue.
+			\param aAllocator The allocator that the buffer will be allocated from.
+			\param aCapacity The minimum number of elements that the queue can hold.
+		*/
+		SpscQueue(AllocatorI& aAllocator, const uint32_t aCapacity) :
+			mAllocator(aAllocator),
+			mData(static_cast<T*>(aAllocator.Allocate(sizeof(T) * NextPowerOfTwo(aCapacity)))),
+			mCapacity(NextPowerOfTwo(aCapacity)),
+			mMask(NextPowerOfTwo(aCapacity) - 1)
+		{
+			SolaireRuntimeAssert(mData != nullptr, "SolaireCPP : SpscQueue failed to allocate memory");
+			mProducer.Tail = 0;
+			mProducer.CachedHead = 0;
+			mConsumer.Head = 0;
+			mConsumer.CachedTail = 0;
+		}
+
+		~SpscQueue() {
+			const uint32_t head = mConsumer.Head.load(std::memory_order_relaxed);
+			const uint32_t tail = mProducer.Tail.load(std::memory_order_relaxed);
+			for(uint32_t i = head; i != tail; ++i) mData[i & mMask].~T();
+			mAllocator.Deallocate(mData);
+		}
+
+		// Producer
+
+		/*!
+			\brief Construct an element at the back of the queue.
+			\tparam PARAMS The parameter types to pass to the element's constructor.
+			\param aParams The parameters to pass to the element's constructor.
+			\return False if the queue is full.
+		*/
+		template<class ...PARAMS>
+		bool SOLAIRE_DEFAULT_CALL TryEmplace(PARAMS&&... aParams) {
+			const uint32_t tail = mProducer.Tail.load(std::memory_order_relaxed);
+			if(GetFreeSpace(tail) == 0) return false;
+			new(mData + (tail & mMask)) T(std::forward<PARAMS>(aParams)...);
+			mProducer.Tail.store(tail + 1, std::memory_order_release);
+			return true;
+		}
+
+		SOLAIRE_FORCE_INLINE bool SOLAIRE_DEFAULT_CALL TryPush(const T& aValue) {
+			return TryEmplace(aValue);
+		}
+
+		SOLAIRE_FORCE_INLINE bool SOLAIRE_DEFAULT_CALL TryPush(T&& aValue) {
+			return TryEmplace(std::move(aValue));
+		}
+
+		/*!
+			\brief Copy as many elements as will fit to the back of the queue, they are published to the consumer together.
+			\param aValues The elements to copy.
+			\param aCount The number of elements in \a aValues.
+			\return The number of elements that were copied.
+		*/
+		uint32_t SOLAIRE_DEFAULT_CALL PushRange(const T* const aValues, const uint32_t aCount) {
+			const uint32_t tail = mProducer.Tail.load(std::memory_order_relaxed);
+			const uint32_t count = Min<uint32_t>(aCount, GetFreeSpace(tail));
+			if(count == 0) return 0;
+
+			// The free space wraps around the end of the buffer at most once
+			const uint32_t begin = tail & mMask;
+			const uint32_t first = Min<uint32_t>(count, mCapacity - begin);
+			CopyRange(mData + begin, aValues, first);
+			CopyRange(mData, aValues + first, count - first);
+
+			mProducer.Tail.store(tail + count, std::memory_order_release);
+			return count;
+		}
+
+		// Consumer
+
+		/*!
+			\brief Move the front element out of the queue.
+			\param aValue Assigned the element.
+			\return False if the queue is empty.
+		*/
+		bool SOLAIRE_DEFAULT_CALL TryPop(T& aValue) {
+			const uint32_t head = mConsumer.Head.load(std::memory_order_relaxed);
+			if(GetUsedSpace(head) == 0) return false;
+			T& front = mData[head & mMask];
+			aValue = std::move(front);
+			front.~T();
+			mConsumer.Head.store(head + 1, std::memory_order_release);
+			return true;
+		}
+
+		/*!
+			\brief Move up to \a aCount elements out of the front of the queue.
+			\param aValues Assigned the elements, must be able to hold \a aCount elements.
+			\param aCount The maximum number of elements to move.
+			\return The number of elements that were moved.
+		*/
+		uint32_t SOLAIRE_DEFAULT_CALL PopRange(T* const aValues, const uint32_t aCount) {
+			const uint32_t head = mConsumer.Head.load(std::memory_order_relaxed);
+			const uint32_t count = Min<uint32_t>(aCount, GetUsedSpace(head));
+			if(count == 0) return 0;
+
+			const uint32_t begin = head & mMask;
+			const uint32_t first = Min<uint32_t>(count, mCapacity - begin);
+			MoveRange(aValues, mData + begin, first);
+			MoveRange(aValues + first, mData, count - first);
+
+			mConsumer.Head.store(head + count, std::memory_order_release);
+			return count;
+		}
+
+		/*!
+			\brief Process up to \a aCount elements in place, then remove them from the queue.
+			\param aFunction A function with the signature void(T* aSpan, uint32_t aLength), called once or twice with the
+			contiguous runs of elements in queue order.
+			\param aCount The maximum number of elements to process.
+			\return The number of elements that were processed.
+		*/
+		template<class F>
+		uint32_t SOLAIRE_DEFAULT_CALL Consume(F aFunction, const uint32_t aCount = UINT32_MAX) {
+			const uint32_t head = mConsumer.Head.load(std::memory_order_relaxed);
+			const uint32_t count = Min<uint32_t>(aCount, GetUsedSpace(head));
+			if(count == 0) return 0;
+
+			const uint32_t begin = head & mMask;
+			const uint32_t first = Min<uint32_t>(count, mCapacity - begin);
+			aFunction(mData + begin, first);
+			if(count > first) aFunction(mData, count - first);
+			DestroyRange(mData + begin, first);
+			DestroyRange(mData, count - first);
+
+			mConsumer.Head.store(head + count, std::memory_order_release);
+			return count;
+		}
+
+		// Either thread
+
+		/*!
+			\brief Get the number of elements in the queue.
+			\detail The result may already be out of date if the other thread is using the queue.
+			\return The number of elements.
+		*/
+		SOLAIRE_FORCE_INLINE uint32_t SOLAIRE_DEFAULT_CALL Size() const throw() {
+			const uint32_t head = mConsumer.Head.load(std::memory_order_acquire);
+			return mProducer.Tail.load(std::memory_order_acquire) - head;
+		}
+
+		SOLAIRE_FORCE_INLINE bool SOLAIRE_DEFAULT_CALL IsEmpty() const throw() {
+			return Size() == 0;
+		}
+
+		SOLAIRE_FORCE_INLINE uint32_t SOLAIRE_DEFAULT_CALL GetCapacity() const throw() {
+			return mCapacity;
+		}
+
+		SOLAIRE_FORCE_INLINE AllocatorI& SOLAIRE_DEFAULT_CALL GetAllocator() const throw() {
+			return mAllocator;
+		}
+	};
+}
+
+#endif
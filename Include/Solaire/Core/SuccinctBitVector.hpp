@@ -0,0 +1,376 @@
+#ifndef SOLAIRE_SUCCINCT_BIT_VECTOR_HPP
+#define SOLAIRE_SUCCINCT_BIT_VECTOR_HPP
+
+//Copyright 2015 Adam Smith
+//
+//Licensed under the Apache License, Version 2.0 (the "License");
+//you may not use this file except in compliance with the License.
+//You may obtain a copy of the License at
+//
+//    http://www.apache.org/licenses/LICENSE-2.0
+//
+//Unless required by applicable law or agreed to in writing, software
+//distributed under the License is distributed on an "AS IS" BASIS,
+//WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//See the License for the specific language governing permissions and
+//limitations under the License.
+
+// Contact :
+// Email             : solairelibrary@mail.com
+// GitHub repository : https://github.com/SolaireLibrary/SolaireCPP
+
+/*!
+	\file SuccinctBitVector.hpp
+	\brief
+	\author
+	Created			: Adam Smith
+	Last modified	: Adam Smith
+	\version 1.0
+	\date
+	Created			: 18th October 2026
+	Last Modified	: 18th October 2026
+*/
+
+#include <cstring>
+#include <stdexcept>
+#include "AllocatorI.hpp"
+#include "DynamicBitset.hpp"
+#include "Maths.hpp"
+#include "..\Maths\PopCount.hpp"
+
+#ifdef __BMI2__
+	#include <immintrin.h>
+#endif
+
+namespace Solaire {
+
+	/*!
+		\class SuccinctBitVector
+		\brief An immutable array of bits that answers rank and select queries without expanding the bits.
+		\detail
+		The bits are divided into blocks of 2048 bits, each block has one 64 bit index entry that holds the number of set
+		bits before the block in its low 32 bits and the set bit counts of its first three 512 bit sub-blocks in 10 bit
+		fields above that. This adds 3.125% to the size of the bits and makes Rank a lookup plus at most 8 popcounts.
+		Select finds the block by binary searching between samples taken every 8192 set (or clear) bits, then finishes
+		inside the block with the sub-block counts and popcounts.
+		\author Adam Smith
+		\date Created : 18th October 2026
+		\date Modified : 18th October 2026
+		\version 1.0
+	*/
+	class SuccinctBitVector {
+	public:
+		enum : uint32_t {
+			NOT_FOUND = UINT32_MAX
+		};
+	private:
+		enum : uint32_t {
+			WORD_BITS = 64,
+			SUB_BLOCK_BITS = 512,
+			SUB_BLOCK_WORDS = SUB_BLOCK_BITS / WORD_BITS,
+			BLOCK_BITS = 2048,
+			BLOCK_WORDS = BLOCK_BITS / WORD_BITS,
+			SUB_BLOCK_COUNT_BITS = 10,
+			SAMPLE_RATE = 8192
+		};
+	private:
+		AllocatorI* mAllocator;
+		uint64_t* mWords;
+		uint64_t* mBlocks;
+		uint32_t* mSamples1;
+		uint32_t* mSamples0;
+		uint32_t mSize;
+		uint32_t mBlockCount;
+		uint32_t mCount1;
+		uint32_t mSampleCount1;
+		uint32_t mSampleCount0;
+	private:
+		SuccinctBitVector(const SuccinctBitVector&) = delete;
+		SuccinctBitVector& operator=(const SuccinctBitVector&) = delete;
+
+		static SOLAIRE_FORCE_INLINE uint32_t SOLAIRE_DEFAULT_CALL SelectInWord(uint64_t aWord, uint32_t aRank) throw() {
+			#ifdef __BMI2__
+				return CountTrailingZeros(static_cast<uint64_t>(_pdep_u64(1ULL << aRank, aWord)));
+			#else
+				uint32_t shift = 0;
+				while(true) {
+					const uint32_t count = PopCountFast(static_cast<uint32_t>((aWord >> shift) & 0xFF));
+					if(aRank < count) break;
+					aRank -= count;
+					shift += 8;
+				}
+				aWord >>= shift;
+				while(aRank-- > 0) aWord &= aWord - 1;
+				return shift + CountTrailingZeros(aWord);
+			#endif
+		}
+
+		SOLAIRE_FORCE_INLINE uint64_t SOLAIRE_DEFAULT_CALL GetWord(const uint32_t aIndex) const throw() {
+			return aIndex < (mSize + WORD_BITS - 1) / WORD_BITS ? mWords[aIndex] : 0;
+		}
+
+		// The number of set bits before block aBlock
+		SOLAIRE_FORCE_INLINE uint32_t SOLAIRE_DEFAULT_CALL BlockRank1(const uint32_t aBlock) const throw() {
+			return static_cast<uint32_t>(mBlocks[aBlock]);
+		}
+
+		// The number of clear bits before block aBlock
+		SOLAIRE_FORCE_INLINE uint32_t SOLAIRE_DEFAULT_CALL BlockRank0(const uint32_t aBlock) const throw() {
+			return aBlock * BLOCK_BITS - BlockRank1(aBlock);
+		}
+
+		SOLAIRE_FORCE_INLINE uint32_t SOLAIRE_DEFAULT_CALL SubBlockCount1(const uint32_t aBlock, const uint32_t aSubBlock) const throw() {
+			return static_cast<uint32_t>(mBlocks[aBlock] >> (32 + SUB_BLOCK_COUNT_BITS * aSubBlock)) & ((1 << SUB_BLOCK_COUNT_BITS) - 1);
+		}
+
+		void SOLAIRE_DEFAULT_CALL Build(const uint64_t* const aWords) {
+			const uint32_t wordCount = (mSize + WORD_BITS - 1) / WORD_BITS;
+			mBlockCount = mSize / BLOCK_BITS + 1;
+
+			mWords = static_cast<uint64_t*>(mAllocator->Allocate(Max<uint32_t>(wordCount, 1) * sizeof(uint64_t)));
+			mBlocks = static_cast<uint64_t*>(mAllocator->Allocate(mBlockCount * sizeof(uint64_t)));
+			SolaireRuntimeAssert(mWords != nullptr && mBlocks != nullptr, "SolaireCPP : SuccinctBitVector failed to allocate memory");
+
+			if(wordCount > 0) {
+				std::memcpy(mWords, aWords, wordCount * sizeof(uint64_t));
+				// Bits past the end are kept clear so that whole words can be counted
+				if(mSize % WORD_BITS) mWords[wordCount - 1] &= (1ULL << (mSize % WORD_BITS)) - 1;
+			}
+
+			uint32_t count = 0;
+			for(uint32_t i = 0; i < mBlockCount; ++i) {
+				uint64_t entry = count;
+				for(uint32_t j = 0; j < BLOCK_WORDS / SUB_BLOCK_WORDS; ++j) {
+					uint32_t subCount = 0;
+					for(uint32_t k = 0; k < SUB_BLOCK_WORDS; ++k) subCount += PopCountFast(GetWord(i * BLOCK_WORDS + j * SUB_BLOCK_WORDS + k));
+					if(j < 3) entry |= static_cast<uint64_t>(subCount) << (32 + SUB_BLOCK_COUNT_BITS * j);
+					count += subCount;
+				}
+				mBlocks[i] = entry;
+			}
+			mCount1 = count;
+
+			// Sample the block that contains every SAMPLE_RATE'th set and clear bit
+			mSampleCount1 = mCount1 / SAMPLE_RATE + 1;
+			mSampleCount0 = (mSize - mCount1) / SAMPLE_RATE + 1;
+			mSamples1 = static_cast<uint32_t*>(mAllocator->Allocate(mSampleCount1 * sizeof(uint32_t)));
+			mSamples0 = static_cast<uint32_t*>(mAllocator->Allocate(mSampleCount0 * sizeof(uint32_t)));
+			SolaireRuntimeAssert(mSamples1 != nullptr && mSamples0 != nullptr, "SolaireCPP : SuccinctBitVector failed to allocate memory");
+
+			uint32_t sample1 = 0;
+			uint32_t sample0 = 0;
+			for(uint32_t i = 0; i < mBlockCount; ++i) {
+				const uint32_t end1 = i + 1 < mBlockCount ? BlockRank1(i + 1) : mCount1;
+				const uint32_t end0 = i + 1 < mBlockCount ? BlockRank0(i + 1) : mSize - mCount1;
+				while(sample1 < mSampleCount1 && sample1 * SAMPLE_RATE < end1) mSamples1[sample1++] = i;
+				while(sample0 < mSampleCount0 && sample0 * SAMPLE_RATE < end0) mSamples0[sample0++] = i;
+			}
+			while(sample1 < mSampleCount1) mSamples1[sample1++] = mBlockCount - 1;
+			while(sample0 < mSampleCount0) mSamples0[sample0++] = mBlockCount - 1;
+		}
+
+		void SOLAIRE_DEFAULT_CALL Destroy() throw() {
+			if(mWords) mAllocator->Deallocate(mWords);
+			if(mBlocks) mAllocator->Deallocate(mBlocks);
+			if(mSamples1) mAllocator->Deallocate(mSamples1);
+			if(mSamples0) mAllocator->Deallocate(mSamples0);
+			mWords = nullptr;
+			mBlocks = nullptr;
+			mSamples1 = nullptr;
+			mSamples0 = nullptr;
+		}
+
+		template<bool ONES>
+		uint32_t SOLAIRE_DEFAULT_CALL SelectImplementation(uint32_t aRank) const throw() {
+			const uint32_t* const samples = ONES ? mSamples1 : mSamples0;
+			const uint32_t sampleCount = ONES ? mSampleCount1 : mSampleCount0;
+
+			// Find the last block that starts at or before the bit
+			const uint32_t sample = aRank / SAMPLE_RATE;
+			uint32_t low = samples[sample];
+			uint32_t high = sample + 1 < sampleCount ? samples[sample + 1] : mBlockCount - 1;
+			while(low < high) {
+				const uint32_t mid = low + (high - low + 1) / 2;
+				if((ONES ? BlockRank1(mid) : BlockRank0(mid)) <= aRank) low = mid;
+				else high = mid - 1;
+			}
+			aRank -= ONES ? BlockRank1(low) : BlockRank0(low);
+
+			// Find the sub-block
+			uint32_t subBlock = 0;
+			while(subBlock < 3) {
+				const uint32_t count = ONES ? SubBlockCount1(low, subBlock) : SUB_BLOCK_BITS - SubBlockCount1(low, subBlock);
+				if(aRank < count) break;
+				aRank -= count;
+				++subBlock;
+			}
+
+			// Find the word
+			uint32_t word = low * BLOCK_WORDS + subBlock * SUB_BLOCK_WORDS;
+			while(true) {
+				const uint64_t bits = ONES ? GetWord(word) : ~GetWord(word);
+				const uint32_t count = PopCountFast(bits);
+				if(aRank < count) return word * WORD_BITS + SelectInWord(bits, aRank);
+				aRank -= count;
+				++word;
+			}
+		}
+	public:
+		/*!
+			\brief Build the rank and select index for a copy of some bits.
+			\param aAllocator The allocator that the bits and index will be allocated from.
+			\param aWords The bits, packed into words with the lowest index in the lowest bit.
+			\param aSize The number of bits.
+		*/
+		SuccinctBitVector(AllocatorI& aAllocator, const uint64_t* const aWords, const uint32_t aSize) :
+			mAllocator(&aAllocator),
+			mWords(nullptr),
+			mBlocks(nullptr),
+			mSamples1(nullptr),
+			mSamples0(nullptr),
+			mSize(aSize),
+			mBlockCount(0),
+			mCount1(0),
+			mSampleCount1(0),
+			mSampleCount0(0)
+		{
+			Build(aWords);
+		}
+
+		SuccinctBitVector(AllocatorI& aAllocator, const DynamicBitset& aBits) :
+			SuccinctBitVector(aAllocator, aBits.GetWords(), aBits.Size())
+		{}
+
+		SuccinctBitVector(SuccinctBitVector&& aOther) throw() :
+			mAllocator(aOther.mAllocator),
+			mWords(aOther.mWords),
+			mBlocks(aOther.mBlocks),
+			mSamples1(aOther.mSamples1),
+			mSamples0(aOther.mSamples0),
+			mSize(aOther.mSize),
+			mBlockCount(aOther.mBlockCount),
+			mCount1(aOther.mCount1),
+			mSampleCount1(aOther.mSampleCount1),
+			mSampleCount0(aOther.mSampleCount0)
+		{
+			aOther.mWords = nullptr;
+			aOther.mBlocks = nullptr;
+			aOther.mSamples1 = nullptr;
+			aOther.mSamples0 = nullptr;
+			aOther.mSize = 0;
+			aOther.mBlockCount = 0;
+			aOther.mCount1 = 0;
+		}
+
+		~SuccinctBitVector() throw() {
+			Destroy();
+		}
+
+		SuccinctBitVector& SOLAIRE_DEFAULT_CALL operator=(SuccinctBitVector&& aOther) throw() {
+			if(&aOther == this) return *this;
+			Destroy();
+			mAllocator = aOther.mAllocator;
+			mWords = aOther.mWords;
+			mBlocks = aOther.mBlocks;
+			mSamples1 = aOther.mSamples1;
+			mSamples0 = aOther.mSamples0;
+			mSize = aOther.mSize;
+			mBlockCount = aOther.mBlockCount;
+			mCount1 = aOther.mCount1;
+			mSampleCount1 = aOther.mSampleCount1;
+			mSampleCount0 = aOther.mSampleCount0;
+			aOther.mWords = nullptr;
+			aOther.mBlocks = nullptr;
+			aOther.mSamples1 = nullptr;
+			aOther.mSamples0 = nullptr;
+			aOther.mSize = 0;
+			aOther.mBlockCount = 0;
+			aOther.mCount1 = 0;
+			return *this;
+		}
+
+		SOLAIRE_FORCE_INLINE bool SOLAIRE_DEFAULT_CALL Get(const uint32_t aIndex) const throw() {
+			return (mWords[aIndex / WORD_BITS] >> (aIndex % WORD_BITS)) & 1;
+		}
+
+		SOLAIRE_FORCE_INLINE bool SOLAIRE_DEFAULT_CALL operator[](const uint32_t aIndex) const throw() {
+			return Get(aIndex);
+		}
+
+		/*!
+			\brief Count the set bits before a position.
+			\param aIndex The position, must not be greater than Size().
+			\return The number of set bits in the range [0, \a aIndex).
+		*/
+		uint32_t SOLAIRE_DEFAULT_CALL Rank1(const uint32_t aIndex) const throw() {
+			const uint32_t block = aIndex / BLOCK_BITS;
+			const uint32_t subBlock = (aIndex % BLOCK_BITS) / SUB_BLOCK_BITS;
+			uint32_t rank = BlockRank1(block);
+			for(uint32_t i = 0; i < subBlock; ++i) rank += SubBlockCount1(block, i);
+
+			const uint32_t end = aIndex / WORD_BITS;
+			for(uint32_t i = block * BLOCK_WORDS + subBlock * SUB_BLOCK_WORDS; i < end; ++i) rank += PopCountFast(mWords[i]);
+
+			const uint32_t bits = aIndex % WORD_BITS;
+			if(bits != 0) rank += PopCountFast(mWords[end] & ((static_cast<uint64_t>(1) << bits) - 1));
+			return rank;
+		}
+
+		/*!
+			\brief Count the clear bits before a position.
+			\param aIndex The position, must not be greater than Size().
+			\return The number of clear bits in the range [0, \a aIndex).
+		*/
+		SOLAIRE_FORCE_INLINE uint32_t SOLAIRE_DEFAULT_CALL Rank0(const uint32_t aIndex) const throw() {
+			return aIndex - Rank1(aIndex);
+		}
+
+		/*!
+			\brief Find the position of a set bit.
+			\param aRank The number of set bits before the bit to find.
+			\return The position of the bit, or NOT_FOUND if there are not enough set bits.
+		*/
+		SOLAIRE_FORCE_INLINE uint32_t SOLAIRE_DEFAULT_CALL Select1(const uint32_t aRank) const throw() {
+			return aRank < mCount1 ? SelectImplementation<true>(aRank) : static_cast<uint32_t>(NOT_FOUND);
+		}
+
+		/*!
+			\brief Find the position of a clear bit.
+			\param aRank The number of clear bits before the bit to find.
+			\return The position of the bit, or NOT_FOUND if there are not enough clear bits.
+		*/
+		SOLAIRE_FORCE_INLINE uint32_t SOLAIRE_DEFAULT_CALL Select0(const uint32_t aRank) const throw() {
+			return aRank < mSize - mCount1 ? SelectImplementation<false>(aRank) : static_cast<uint32_t>(NOT_FOUND);
+		}
+
+		SOLAIRE_FORCE_INLINE uint32_t SOLAIRE_DEFAULT_CALL Size() const throw() {
+			return mSize;
+		}
+
+		SOLAIRE_FORCE_INLINE uint32_t SOLAIRE_DEFAULT_CALL Count1() const throw() {
+			return mCount1;
+		}
+
+		SOLAIRE_FORCE_INLINE uint32_t SOLAIRE_DEFAULT_CALL Count0() const throw() {
+			return mSize - mCount1;
+		}
+
+		SOLAIRE_FORCE_INLINE const uint64_t* SOLAIRE_DEFAULT_CALL GetWords() const throw() {
+			return mWords;
+		}
+
+		/*!
+			\brief Get the size of the rank and select index.
+			\return The number of bytes used in addition to the bits.
+		*/
+		SOLAIRE_FORCE_INLINE uint32_t SOLAIRE_DEFAULT_CALL GetIndexBytes() const throw() {
+			return (mBlockCount * sizeof(uint64_t)) + ((mSampleCount1 + mSampleCount0) * sizeof(uint32_t));
+		}
+
+		SOLAIRE_FORCE_INLINE AllocatorI& SOLAIRE_DEFAULT_CALL GetAllocator() const throw() {
+			return *mAllocator;
+		}
+	};
+}
+
+#endif
@@ -0,0 +1,273 @@
+#ifndef SOLAIRE_TASK_SCHEDULER_HPP
+#define SOLAIRE_TASK_SCHEDULER_HPP
+
+//Copyright 2015 Adam Smith
+//
+//Licensed under the Apache License, Version 2.0 (the "License");
+//you may not use this file except in compliance with the License.
+//You may obtain a copy of the License at
+//
+//    http://www.apache.org/licenses/LICENSE-2.0
+//
+//Unless required by applicable law or agreed to in writing, software
+//distributed under the License is distributed on an "AS IS" BASIS,
+//WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//See the License for the specific language governing permissions and
+//limitations under the License.
+
+// Contact :
+// Email             : solairelibrary@mail.com
+// GitHub repository : https://github.com/SolaireLibrary/SolaireCPP
+
+/*!
+	\file TaskScheduler.hpp
+	\brief
+	\author
+	Created			: Adam Smith
+	Last modified	: Adam Smith
+	\version 1.0
+	\date
+	Created			: 18th October 2026
+	Last Modified	: 18th October 2026
+*/
+
+#include <new>
+#include <atomic>
+#include <utility>
+#include <type_traits>
+#ifndef SOLAIRE_DISABLE_MULTITHREADING
+	#include <mutex>
+	#include <thread>
+	#include <condition_variable>
+#endif
+#include "Allocator.hpp"
+#include "DynamicArray.hpp"
+#include "LockFreeStack.hpp"
+#include "MpmcQueue.hpp"
+#include "WorkStealingDeque.hpp"
+
+namespace Solaire {
+
+	class TaskScheduler;
+	class TaskGroup;
+
+	namespace Implementation {
+		/*!
+			\brief A task and the function it will call, tasks are recycled by the TaskScheduler that created them.
+		*/
+		struct TaskSlot {
+			enum : uint32_t {
+				STORAGE_BYTES = 48
+			};
+
+			void(SOLAIRE_DEFAULT_CALL *Invoke)(TaskSlot&);
+			TaskGroup* Group;
+			typename std::aligned_storage<STORAGE_BYTES, 16>::type Storage;
+		};
+
+		template<class F>
+		static void SOLAIRE_DEFAULT_CALL InvokeTask(TaskSlot& aSlot) {
+			F& function = *reinterpret_cast<F*>(&aSlot.Storage);
+			function();
+			function.~F();
+		}
+	}
+
+	/*!
+		\class TaskScheduler
+		\brief A fixed pool of worker threads that execute the tasks of TaskGroups.
+		\detail
+		Each worker has a WorkStealingDeque. Tasks created by a worker are pushed onto its own deque and popped in LIFO
+		order, an idle worker steals the oldest task from a randomly chosen worker. Tasks created by other threads go into a
+		shared MpmcQueue that every worker checks before stealing.
+		A thread that waits for a TaskGroup executes tasks while it waits, so tasks may wait on nested groups.
+		Idle workers spin briefly then sleep until a task is submitted.
+
+		The allocator is used by several threads, deques grow on the worker that owns them, so it must be thread safe.
+		\author Adam Smith
+		\date Created : 18th October 2026
+		\date Modified : 18th October 2026
+		\version 1.0
+		\see TaskGroup
+	*/
+	class TaskScheduler {
+	public:
+		friend TaskGroup;
+
+		enum Affinity : uint8_t {
+			AFFINITY_NONE,			//!< Let the OS move workers between cores.
+			AFFINITY_PER_CORE		//!< Pin worker N to hardware thread N, wrapping if there are more workers than hardware threads.
+		};
+
+		enum : uint32_t {
+			NOT_A_WORKER = UINT32_MAX
+		};
+	private:
+		typedef Implementation::TaskSlot TaskSlot;
+
+		struct Worker {
+			WorkStealingDeque<TaskSlot*> Deque;
+			uint32_t Seed;
+
+			Worker(AllocatorI& aAllocator, const uint32_t aSeed);
+		};
+
+		enum : uint32_t {
+			SLOTS_PER_BLOCK = 256,
+			INJECTION_CAPACITY = 1024,
+			SPIN_COUNT = 64
+		};
+	private:
+		Allocator& mAllocator;
+		uint32_t mThreadCount;
+		void* mWorkerMemory;
+		Worker* mWorkers;
+		MpmcQueue<TaskSlot*> mInjection;
+		LockFreeStack<TaskSlot*> mFreeSlots;
+		DynamicArray<void*> mSlotBlocks;
+		std::atomic<uint32_t> mSleeping;
+		#ifndef SOLAIRE_DISABLE_MULTITHREADING
+			std::thread* mThreads;
+			std::mutex mLock;
+			std::condition_variable mWake;
+			bool mStop;
+		#endif
+	private:
+		TaskScheduler(const TaskScheduler&) = delete;
+		TaskScheduler(TaskScheduler&&) = delete;
+		TaskScheduler& operator=(const TaskScheduler&) = delete;
+		TaskScheduler& operator=(TaskScheduler&&) = delete;
+
+		TaskSlot* SOLAIRE_DEFAULT_CALL AllocateSlot();
+		void SOLAIRE_DEFAULT_CALL Submit(TaskSlot* const aSlot);
+		void SOLAIRE_DEFAULT_CALL Execute(TaskSlot* const aSlot);
+		TaskSlot* SOLAIRE_DEFAULT_CALL FindTask(const uint32_t aWorker);
+		bool SOLAIRE_DEFAULT_CALL HasTasks() const throw();
+		bool SOLAIRE_DEFAULT_CALL RunTask();
+
+		#ifndef SOLAIRE_DISABLE_MULTITHREADING
+			void SOLAIRE_DEFAULT_CALL WorkerMain(const uint32_t aWorker);
+		#endif
+	public:
+		/*!
+			\brief Create a scheduler and start its workers.
+			\param aAllocator The allocator that the scheduler will allocate from, must be thread safe.
+			\param aThreadCount The number of worker threads, 0 uses one per hardware thread.
+			\param aAffinity How workers are assigned to hardware threads.
+		*/
+		TaskScheduler(Allocator& aAllocator, const uint32_t aThreadCount = 0, const Affinity aAffinity = AFFINITY_NONE);
+
+		/*!
+			\brief Stop the workers and destroy the scheduler.
+			\detail Every TaskGroup must have been waited on.
+		*/
+		~TaskScheduler();
+
+		SOLAIRE_FORCE_INLINE uint32_t SOLAIRE_DEFAULT_CALL GetThreadCount() const throw() {
+			return mThreadCount;
+		}
+
+		SOLAIRE_FORCE_INLINE Allocator& SOLAIRE_DEFAULT_CALL GetAllocator() const throw() {
+			return mAllocator;
+		}
+
+		/*!
+			\brief Get the index of the calling thread.
+			\return The worker index, or NOT_A_WORKER if the thread is not one of this scheduler's workers.
+		*/
+		uint32_t SOLAIRE_DEFAULT_CALL GetWorkerIndex() const throw();
+	};
+
+	/*!
+		\class TaskGroup
+		\brief A set of tasks that can be waited on together, with an optional continuation.
+		\detail
+		Run may be called by the thread that owns the group, or by a task of the group to add more work. Then must be called
+		after the last task has been added. Waiting does not block the thread, it executes tasks until the group and its
+		continuation have completed. A group is used once, it is waited on when it is destroyed.
+		\author Adam Smith
+		\date Created : 18th October 2026
+		\date Modified : 18th October 2026
+		\version 1.0
+		\see TaskScheduler
+	*/
+	class TaskGroup {
+	public:
+		friend TaskScheduler;
+	private:
+		TaskScheduler& mScheduler;
+		Implementation::TaskSlot* mContinuation;
+		std::atomic<uint32_t> mPending;
+		std::atomic<bool> mDone;
+		bool mReleased;
+	private:
+		TaskGroup(const TaskGroup&) = delete;
+		TaskGroup(TaskGroup&&) = delete;
+		TaskGroup& operator=(const TaskGroup&) = delete;
+		TaskGroup& operator=(TaskGroup&&) = delete;
+
+		void SOLAIRE_DEFAULT_CALL Release();
+
+		template<class F>
+		Implementation::TaskSlot* SOLAIRE_DEFAULT_CALL CreateTask(F&& aFunction) {
+			typedef typename std::decay<F>::type Function;
+			static_assert(sizeof(Function) <= Implementation::TaskSlot::STORAGE_BYTES, "SolaireCPP : TaskGroup function is too large, capture by reference");
+			static_assert(std::alignment_of<Function>::value <= 16, "SolaireCPP : TaskGroup function alignment is too large");
+
+			Implementation::TaskSlot* const slot = mScheduler.AllocateSlot();
+			new(&slot->Storage) Function(std::forward<F>(aFunction));
+			slot->Invoke = &Implementation::InvokeTask<Function>;
+			slot->Group = this;
+			return slot;
+		}
+	public:
+		TaskGroup(TaskScheduler& aScheduler);
+
+		/*!
+			\brief Wait for the group to complete.
+		*/
+		~TaskGroup();
+
+		/*!
+			\brief Add a task to the group.
+			\param aFunction A function with the signature void(), at most 48 bytes.
+		*/
+		template<class F>
+		void SOLAIRE_DEFAULT_CALL Run(F&& aFunction) {
+			++mPending;
+			mScheduler.Submit(CreateTask(std::forward<F>(aFunction)));
+		}
+
+		/*!
+			\brief Set a function to execute on a worker once every task in the group has completed.
+			\detail No more tasks can be added until the group has been waited on.
+			\param aFunction A function with the signature void(), at most 48 bytes.
+		*/
+		template<class F>
+		void SOLAIRE_DEFAULT_CALL Then(F&& aFunction) {
+			mContinuation = CreateTask(std::forward<F>(aFunction));
+			mReleased = true;
+			Release();
+		}
+
+		/*!
+			\brief Execute tasks until every task in the group, and its continuation, have completed.
+		*/
+		void SOLAIRE_DEFAULT_CALL Wait();
+
+		/*!
+			\brief Check if the group has completed without waiting.
+			\detail Only returns true after Then or Wait has been called.
+			\return True if every task and the continuation have completed.
+		*/
+		SOLAIRE_FORCE_INLINE bool SOLAIRE_DEFAULT_CALL IsDone() const throw() {
+			return mDone.load(std::memory_order_acquire);
+		}
+
+		SOLAIRE_FORCE_INLINE TaskScheduler& SOLAIRE_DEFAULT_CALL GetScheduler() const throw() {
+			return mScheduler;
+		}
+	};
+}
+
+#endif
@@ -0,0 +1,228 @@
+#ifndef SOLAIRE_WORK_STEALING_DEQUE_HPP
+#define SOLAIRE_WORK_STEALING_DEQUE_HPP
+
+//Copyright 2015 Adam Smith
+//
+//Licensed under the Apache License, Version 2.0 (the "License");
+//you may not use this file except in compliance with the License.
+//You may obtain a copy of the License at
+//
+//    http://www.apache.org/licenses/LICENSE-2.0
+//
+//Unless required by applicable law or agreed to in writing, software
+//distributed under the License is distributed on an "AS IS" BASIS,
+//WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//See the License for the specific language governing permissions and
+//limitations under the License.
+
+// Contact :
+// Email             : solairelibrary@mail.com
+// GitHub repository : https://github.com/SolaireLibrary/SolaireCPP
+
+/*!
+	\file WorkStealingDeque.hpp
+	\brief
+	\author
+	Created			: Adam Smith
+	Last modified	: Adam Smith
+	\version 1.0
+	\date
+	Created			: 18th October 2026
+	Last Modified	: 18th October 2026
+*/
+
+#include <new>
+#include <atomic>
+#include <stdexcept>
+#include <type_traits>
+#include "Init.hpp"
+#include "AllocatorI.hpp"
+#include "Maths.hpp"
+
+namespace Solaire {
+
+	/*!
+		\class WorkStealingDeque
+		\brief A Chase-Lev deque, one owner thread pushes and pops at the bottom while other threads steal from the top.
+		\detail
+		Push and Pop may only be called by the owner thread, Steal may be called by any thread. No operation takes a lock,
+		the owner only synchronises with thieves when the deque holds a single element.
+		The memory ordering follows Le, Pop, Cohen and Zappa Nardelli's C11 formulation of the algorithm.
+
+		When the buffer is full the owner copies it into one twice the size. A thief may still be reading the old buffer,
+		so replaced buffers are kept until the deque is destroyed, which costs at most the size of the current buffer.
+		\tparam T The type of element stored in the deque, must be trivially copyable because a thief may read an element
+		that it then fails to claim.
+		\author Adam Smith
+		\date Created : 18th October 2026
+		\date Modified : 18th October 2026
+		\version 1.0
+	*/
+	template<class T>
+	class WorkStealingDeque {
+	public:
+		static_assert(std::is_trivially_copyable<T>::value, "SolaireCPP : WorkStealingDeque elements must be trivially copyable");
+	private:
+		enum : uint32_t {
+			CACHE_LINE = 64,
+			MIN_CAPACITY = 16
+		};
+
+		struct Buffer {
+			Buffer* Retired;
+			int64_t Mask;
+			std::atomic<T>* Data;
+
+			SOLAIRE_FORCE_INLINE T SOLAIRE_DEFAULT_CALL Get(const int64_t aIndex) const throw() {
+				return Data[aIndex & Mask].load(std::memory_order_relaxed);
+			}
+
+			SOLAIRE_FORCE_INLINE void SOLAIRE_DEFAULT_CALL Put(const int64_t aIndex, const T& aValue) throw() {
+				Data[aIndex & Mask].store(aValue, std::memory_order_relaxed);
+			}
+		};
+
+		struct alignas(CACHE_LINE) Index {
+			std::atomic<int64_t> Value;
+		};
+	private:
+		AllocatorI& mAllocator;
+		std::atomic<Buffer*> mBuffer;
+		Index mTop;
+		Index mBottom;
+	private:
+		WorkStealingDeque(const WorkStealingDeque<T>&) = delete;
+		WorkStealingDeque(WorkStealingDeque<T>&&) = delete;
+		WorkStealingDeque<T>& operator=(const WorkStealingDeque<T>&) = delete;
+		WorkStealingDeque<T>& operator=(WorkStealingDeque<T>&&) = delete;
+
+		Buffer* SOLAIRE_DEFAULT_CALL AllocateBuffer(const uint32_t aCapacity, Buffer* const aRetired) {
+			// The elements are stored after the header, aligned for std::atomic<T>
+			const uint32_t header = CeilToMultiple<uint32_t>(sizeof(Buffer), std::alignment_of<std::atomic<T>>::value);
+			void* const memory = mAllocator.Allocate(header + sizeof(std::atomic<T>) * aCapacity);
+			SolaireRuntimeAssert(memory != nullptr, "SolaireCPP : WorkStealingDeque failed to allocate memory");
+
+			Buffer* const buffer = static_cast<Buffer*>(memory);
+			buffer->Retired = aRetired;
+			buffer->Mask = aCapacity - 1;
+			buffer->Data = reinterpret_cast<std::atomic<T>*>(static_cast<uint8_t*>(memory) + header);
+			for(uint32_t i = 0; i < aCapacity; ++i) new(buffer->Data + i) std::atomic<T>();
+			return buffer;
+		}
+
+		Buffer* SOLAIRE_DEFAULT_CALL Grow(Buffer* const aBuffer, const int64_t aTop, const int64_t aBottom) {
+			Buffer* const buffer = AllocateBuffer(static_cast<uint32_t>(aBuffer->Mask + 1) * 2, aBuffer);
+			for(int64_t i = aTop; i < aBottom; ++i) buffer->Put(i, aBuffer->Get(i));
+			mBuffer.store(buffer, std::memory_order_release);
+			return buffer;
+		}
+	public:
+		/*!
+			\brief Create an empty deque.
+			\param aAllocator The allocator that buffers will be allocated from.
+			\param aCapacity The initial capacity, rounded up to a power of two.
+		*/
+		WorkStealingDeque(AllocatorI& aAllocator, const uint32_t aCapacity = MIN_CAPACITY) :
+			mAllocator(aAllocator),
+			mBuffer(nullptr)
+		{
+			mBuffer = AllocateBuffer(NextPowerOfTwo(Max<uint32_t>(aCapacity, MIN_CAPACITY)), nullptr);
+			mTop.Value = 0;
+			mBottom.Value = 0;
+		}
+
+		~WorkStealingDeque() {
+			Buffer* buffer = mBuffer.load(std::memory_order_relaxed);
+			while(buffer != nullptr) {
+				Buffer* const retired = buffer->Retired;
+				mAllocator.Deallocate(buffer);
+				buffer = retired;
+			}
+		}
+
+		/*!
+			\brief Push an element onto the bottom of the deque, only the owner thread may call this.
+			\param aValue The element.
+		*/
+		void SOLAIRE_DEFAULT_CALL Push(const T& aValue) {
+			const int64_t bottom = mBottom.Value.load(std::memory_order_relaxed);
+			const int64_t top = mTop.Value.load(std::memory_order_acquire);
+			Buffer* buffer = mBuffer.load(std::memory_order_relaxed);
+			if(bottom - top > buffer->Mask) buffer = Grow(buffer, top, bottom);
+
+			buffer->Put(bottom, aValue);
+			// A release store rather than a release fence, the same ordering but visible to race detectors
+			mBottom.Value.store(bottom + 1, std::memory_order_release);
+		}
+
+		/*!
+			\brief Pop the element at the bottom of the deque, only the owner thread may call this.
+			\param aValue Assigned the element.
+			\return False if the deque is empty.
+		*/
+		bool SOLAIRE_DEFAULT_CALL Pop(T& aValue) {
+			const int64_t bottom = mBottom.Value.load(std::memory_order_relaxed) - 1;
+			Buffer* const buffer = mBuffer.load(std::memory_order_relaxed);
+			mBottom.Value.store(bottom, std::memory_order_relaxed);
+			std::atomic_thread_fence(std::memory_order_seq_cst);
+			int64_t top = mTop.Value.load(std::memory_order_relaxed);
+
+			if(top > bottom) {
+				mBottom.Value.store(bottom + 1, std::memory_order_relaxed);
+				return false;
+			}
+
+			aValue = buffer->Get(bottom);
+			if(top == bottom) {
+				// The last element, race the thieves for it
+				const bool won = mTop.Value.compare_exchange_strong(top, top + 1, std::memory_order_seq_cst, std::memory_order_relaxed);
+				mBottom.Value.store(bottom + 1, std::memory_order_relaxed);
+				return won;
+			}
+			return true;
+		}
+
+		/*!
+			\brief Steal the element at the top of the deque, any thread may call this.
+			\param aValue Assigned the element.
+			\return False if the deque is empty or another thread claimed the element first.
+		*/
+		bool SOLAIRE_DEFAULT_CALL Steal(T& aValue) {
+			int64_t top = mTop.Value.load(std::memory_order_acquire);
+			std::atomic_thread_fence(std::memory_order_seq_cst);
+			const int64_t bottom = mBottom.Value.load(std::memory_order_acquire);
+			if(top >= bottom) return false;
+
+			// Acquire pairs with the release in Grow, so the copied elements are visible
+			const T value = mBuffer.load(std::memory_order_acquire)->Get(top);
+			if(! mTop.Value.compare_exchange_strong(top, top + 1, std::memory_order_seq_cst, std::memory_order_relaxed)) return false;
+			aValue = value;
+			return true;
+		}
+
+		/*!
+			\brief Get the number of elements in the deque.
+			\detail The result may already be out of date if other threads are using the deque.
+			\return The number of elements.
+		*/
+		SOLAIRE_FORCE_INLINE uint32_t SOLAIRE_DEFAULT_CALL Size() const throw() {
+			const int64_t bottom = mBottom.Value.load(std::memory_order_relaxed);
+			const int64_t top = mTop.Value.load(std::memory_order_relaxed);
+			return bottom > top ? static_cast<uint32_t>(bottom - top) : 0;
+		}
+
+		SOLAIRE_FORCE_INLINE bool SOLAIRE_DEFAULT_CALL IsEmpty() const throw() {
+			return Size() == 0;
+		}
+
+		SOLAIRE_FORCE_INLINE uint32_t SOLAIRE_DEFAULT_CALL GetCapacity() const throw() {
+			return static_cast<uint32_t>(mBuffer.load(std::memory_order_relaxed)->Mask + 1);
+		}
+
+		SOLAIRE_FORCE_INLINE AllocatorI& SOLAIRE_DEFAULT_CALL GetAllocator() const throw() {
+			return mAllocator;
+		}
+	};
+}
+
+#endif
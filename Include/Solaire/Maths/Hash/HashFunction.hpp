@@ -44,6 +44,11 @@ namespace Solaire{
         virtual HashType SOLAIRE_EXPORT_CALL Hash(const void* const aValue, const size_t aBytes) const throw() = 0;
     };
 
+    template<class HASH_TYPE, typename Enable>
+    SOLAIRE_EXPORT_CALL HashFunction<HASH_TYPE, Enable>::~HashFunction() throw() {
+
+    }
+
 }
 
 #endif
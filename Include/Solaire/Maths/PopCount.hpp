@@ -28,12 +28,19 @@
 	\version 1.0
 	\date
 	Created			: 26th September 2015
-	Last Modified	: 15th November 2015
+	Last Modified	: 18th October 2026
 */
 
 #include <cstdint>
+#include <cstring>
+#include "..\Core\Init.hpp"
 #include "..\Core\Maths.hpp"
 
+#ifdef __AVX2__
+	#include <immintrin.h>
+	#define SOLAIRE_POP_COUNT_AVX2
+#endif
+
 namespace Solaire{
 
     namespace Implementation{
@@ -71,12 +78,86 @@ namespace Solaire{
 			PopCount32(aValue & INT_0);
     }
 
-	static uint32_t PopCount(const void* const aSrc, uint32_t aBytes) {
+	/*!
+		\brief Count the set bits in a word.
+		\detail Uses the processor's population count instruction where the compiler can be sure that it is available.
+		\param aValue The word to count.
+		\return The number of set bits.
+	*/
+	inline uint32_t PopCountFast(const uint64_t aValue) throw() {
+		#if SOLAIRE_COMPILER == SOLAIRE_MSVC && defined(_M_X64) && defined(__AVX__)
+			return static_cast<uint32_t>(__popcnt64(aValue));
+		#elif SOLAIRE_COMPILER == SOLAIRE_MSVC
+			uint64_t value = aValue - ((aValue >> 1) & 0x5555555555555555ULL);
+			value = (value & 0x3333333333333333ULL) + ((value >> 2) & 0x3333333333333333ULL);
+			value = (value + (value >> 4)) & 0x0F0F0F0F0F0F0F0FULL;
+			return static_cast<uint32_t>((value * 0x0101010101010101ULL) >> 56);
+		#else
+			return static_cast<uint32_t>(__builtin_popcountll(aValue));
+		#endif
+	}
+
+	inline uint32_t PopCountFast(const uint32_t aValue) throw() {
+		#if SOLAIRE_COMPILER == SOLAIRE_MSVC && defined(__AVX__)
+			return __popcnt(aValue);
+		#elif SOLAIRE_COMPILER == SOLAIRE_MSVC
+			return PopCountFast(static_cast<uint64_t>(aValue));
+		#else
+			return static_cast<uint32_t>(__builtin_popcount(aValue));
+		#endif
+	}
+
+	/*!
+		\brief Count the set bits in an array of words.
+		\detail With AVX2 32 bytes are counted at once using a nibble lookup table.
+		\param aWords The words to count.
+		\param aCount The number of words.
+		\return The number of set bits.
+	*/
+	inline uint64_t PopCountWords(const uint64_t* aWords, uint32_t aCount) throw() {
+		uint64_t count = 0;
+
+		#ifdef SOLAIRE_POP_COUNT_AVX2
+			const __m256i lookup = _mm256_setr_epi8(
+				0, 1, 1, 2, 1, 2, 2, 3, 1, 2, 2, 3, 2, 3, 3, 4,
+				0, 1, 1, 2, 1, 2, 2, 3, 1, 2, 2, 3, 2, 3, 3, 4
+			);
+			const __m256i lowMask = _mm256_set1_epi8(0x0F);
+			__m256i total = _mm256_setzero_si256();
+
+			while(aCount >= 4) {
+				// Each byte counter can hold at most 8 bits * 31 iterations before overflowing
+				__m256i bytes = _mm256_setzero_si256();
+				const uint32_t blocks = Min<uint32_t>(aCount / 4, 31);
+				for(uint32_t i = 0; i < blocks; ++i) {
+					const __m256i words = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(aWords));
+					const __m256i low = _mm256_and_si256(words, lowMask);
+					const __m256i high = _mm256_and_si256(_mm256_srli_epi16(words, 4), lowMask);
+					bytes = _mm256_add_epi8(bytes, _mm256_add_epi8(_mm256_shuffle_epi8(lookup, low), _mm256_shuffle_epi8(lookup, high)));
+					aWords += 4;
+				}
+				aCount -= blocks * 4;
+				total = _mm256_add_epi64(total, _mm256_sad_epu8(bytes, _mm256_setzero_si256()));
+			}
+
+			count += static_cast<uint64_t>(_mm256_extract_epi64(total, 0));
+			count += static_cast<uint64_t>(_mm256_extract_epi64(total, 1));
+			count += static_cast<uint64_t>(_mm256_extract_epi64(total, 2));
+			count += static_cast<uint64_t>(_mm256_extract_epi64(total, 3));
+		#endif
+
+		for(uint32_t i = 0; i < aCount; ++i) count += PopCountFast(aWords[i]);
+		return count;
+	}
+
+	inline uint32_t PopCount(const void* const aSrc, uint32_t aBytes) {
 		uint32_t count = 0;
 		const uint8_t* src = static_cast<const uint8_t*>(aSrc);
 
 		while(aBytes >= 8) {
-			count += PopCount64(*reinterpret_cast<const uint64_t*>(src));
+			uint64_t word;
+			std::memcpy(&word, src, 8);
+			count += PopCountFast(word);
 			src += 8;
 			aBytes -= 8;
 		}
@@ -0,0 +1,165 @@
+//Copyright 2015 Adam Smith
+//
+//Licensed under the Apache License, Version 2.0 (the "License");
+//you may not use this file except in compliance with the License.
+//You may obtain a copy of the License at
+//
+//    http://www.apache.org/licenses/LICENSE-2.0
+//
+//Unless required by applicable law or agreed to in writing, software
+//distributed under the License is distributed on an "AS IS" BASIS,
+//WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//See the License for the specific language governing permissions and
+//limitations under the License.
+
+// Contact :
+// Email             : solairelibrary@mail.com
+// GitHub repository : https://github.com/SolaireLibrary/SolaireCPP
+
+#include <cstring>
+#include "Solaire\Components\Archetype.hpp"
+#include "Solaire\Core\Maths.hpp"
+
+namespace Solaire {
+
+	// Archetype
+
+	Archetype::Archetype(Allocator& aAllocator, const ComponentMask aMask) :
+		mAllocator(aAllocator),
+		mChunks(aAllocator),
+		mMask(aMask),
+		mComponentCount(0),
+		mChunkCapacity(0),
+		mSize(0),
+		mEntityOffset(0)
+	{
+		uint32_t rowBytes = sizeof(Entity);
+		for(uint32_t i = 0; i < MAX_COMPONENT_TYPES; ++i) {
+			mColumns[i] = NO_COLUMN;
+			mAddEdges[i] = nullptr;
+			mRemoveEdges[i] = nullptr;
+		}
+
+		ComponentMask mask = aMask;
+		while(mask != 0) {
+			const ComponentID id = CountTrailingZeros(mask);
+			mask &= mask - 1;
+
+			const ComponentInfo& info = GetComponentInfo(id);
+			SolaireRuntimeAssert(info.Alignment <= COLUMN_ALIGNMENT, "SolaireCPP : Archetype component alignment is greater than COLUMN_ALIGNMENT");
+			mColumns[id] = static_cast<uint8_t>(mComponentCount);
+			mComponents[mComponentCount++] = id;
+			rowBytes += info.Size;
+		}
+
+		// Columns are padded to the alignment, so the first estimate may need to be reduced
+		const uint32_t usable = CHUNK_BYTES - COLUMN_ALIGNMENT;
+		mChunkCapacity = usable / rowBytes;
+		while(mChunkCapacity > 0 && LayoutBytes(mChunkCapacity) > usable) --mChunkCapacity;
+		SolaireRuntimeAssert(mChunkCapacity > 0, "SolaireCPP : Archetype row is larger than CHUNK_BYTES");
+
+		uint32_t offset = 0;
+		mEntityOffset = offset;
+		offset += CeilToMultiple<uint32_t>(sizeof(Entity) * mChunkCapacity, COLUMN_ALIGNMENT);
+		for(uint32_t i = 0; i < mComponentCount; ++i) {
+			mOffsets[i] = offset;
+			offset += CeilToMultiple<uint32_t>(GetComponentInfo(mComponents[i]).Size * mChunkCapacity, COLUMN_ALIGNMENT);
+		}
+	}
+
+	Archetype::~Archetype() {
+		Clear();
+	}
+
+	uint32_t SOLAIRE_DEFAULT_CALL Archetype::LayoutBytes(const uint32_t aCapacity) const throw() {
+		uint32_t bytes = CeilToMultiple<uint32_t>(sizeof(Entity) * aCapacity, COLUMN_ALIGNMENT);
+		for(uint32_t i = 0; i < mComponentCount; ++i) {
+			bytes += CeilToMultiple<uint32_t>(GetComponentInfo(mComponents[i]).Size * aCapacity, COLUMN_ALIGNMENT);
+		}
+		return bytes;
+	}
+
+	void SOLAIRE_DEFAULT_CALL Archetype::DestroyRow(const uint32_t aRow) throw() {
+		for(uint32_t i = 0; i < mComponentCount; ++i) {
+			const ComponentInfo& info = GetComponentInfo(mComponents[i]);
+			if(! info.IsTrivial) info.Destroy(GetCell(aRow, i));
+		}
+	}
+
+	uint32_t SOLAIRE_DEFAULT_CALL Archetype::PushRow(const Entity aEntity) {
+		if(mSize == mChunks.Size() * mChunkCapacity) {
+			void* const memory = mAllocator.Allocate(CHUNK_BYTES);
+			SolaireRuntimeAssert(memory != nullptr, "SolaireCPP : Archetype failed to allocate chunk");
+			Chunk chunk;
+			chunk.Memory = memory;
+			chunk.Base = reinterpret_cast<uint8_t*>(CeilToMultiple<uintptr_t>(reinterpret_cast<uintptr_t>(memory), COLUMN_ALIGNMENT));
+			chunk.Count = 0;
+			mChunks.PushBack(chunk);
+		}
+
+		const uint32_t row = mSize++;
+		++mChunks[row / mChunkCapacity].Count;
+		GetEntityCell(row) = aEntity;
+		return row;
+	}
+
+	Entity SOLAIRE_DEFAULT_CALL Archetype::EraseRow(const uint32_t aRow, const bool aDestroy) throw() {
+		if(aDestroy) DestroyRow(aRow);
+
+		const uint32_t last = mSize - 1;
+		Entity moved;
+		if(aRow != last) {
+			for(uint32_t i = 0; i < mComponentCount; ++i) {
+				const ComponentInfo& info = GetComponentInfo(mComponents[i]);
+				if(info.IsTrivial) {
+					std::memcpy(GetCell(aRow, i), GetCell(last, i), info.Size);
+				}else {
+					info.Relocate(GetCell(aRow, i), GetCell(last, i));
+				}
+			}
+			moved = GetEntityCell(last);
+			GetEntityCell(aRow) = moved;
+		}
+
+		mSize = last;
+		Chunk& chunk = mChunks[last / mChunkCapacity];
+		if(--chunk.Count == 0) {
+			mAllocator.Deallocate(chunk.Memory);
+			mChunks.PopBack();
+		}
+		return moved;
+	}
+
+	void SOLAIRE_DEFAULT_CALL Archetype::MoveRow(Archetype& aSrc, const uint32_t aSrcRow, Archetype& aDst, const uint32_t aDstRow) throw() {
+		for(uint32_t i = 0; i < aSrc.mComponentCount; ++i) {
+			const ComponentID id = aSrc.mComponents[i];
+			const ComponentInfo& info = GetComponentInfo(id);
+			void* const src = aSrc.GetCell(aSrcRow, i);
+			const uint8_t column = aDst.mColumns[id];
+
+			if(column == NO_COLUMN) {
+				if(! info.IsTrivial) info.Destroy(src);
+			}else if(info.IsTrivial) {
+				std::memcpy(aDst.GetCell(aDstRow, column), src, info.Size);
+			}else {
+				info.Relocate(aDst.GetCell(aDstRow, column), src);
+			}
+		}
+	}
+
+	void SOLAIRE_DEFAULT_CALL Archetype::Clear() throw() {
+		const uint32_t chunks = mChunks.Size();
+		for(uint32_t i = 0; i < chunks; ++i) {
+			Chunk& chunk = mChunks[i];
+			for(uint32_t j = 0; j < mComponentCount; ++j) {
+				const ComponentInfo& info = GetComponentInfo(mComponents[j]);
+				if(info.IsTrivial) continue;
+				uint8_t* const column = chunk.Base + mOffsets[j];
+				for(uint32_t k = 0; k < chunk.Count; ++k) info.Destroy(column + info.Size * k);
+			}
+			mAllocator.Deallocate(chunk.Memory);
+		}
+		mChunks.Clear();
+		mSize = 0;
+	}
+}
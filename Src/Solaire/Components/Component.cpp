@@ -0,0 +1,39 @@
+//Copyright 2015 Adam Smith
+//
+//Licensed under the Apache License, Version 2.0 (the "License");
+//you may not use this file except in compliance with the License.
+//You may obtain a copy of the License at
+//
+//    http://www.apache.org/licenses/LICENSE-2.0
+//
+//Unless required by applicable law or agreed to in writing, software
+//distributed under the License is distributed on an "AS IS" BASIS,
+//WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//See the License for the specific language governing permissions and
+//limitations under the License.
+
+// Contact :
+// Email             : solairelibrary@mail.com
+// GitHub repository : https://github.com/SolaireLibrary/SolaireCPP
+
+#include <atomic>
+#include "Solaire\Components\Component.hpp"
+
+namespace Solaire {
+
+	static ComponentInfo COMPONENT_INFO[MAX_COMPONENT_TYPES];
+	static std::atomic<uint32_t> COMPONENT_COUNT(0);
+
+	namespace Implementation {
+		ComponentID SOLAIRE_DEFAULT_CALL RegisterComponent(const ComponentInfo& aInfo) {
+			const ComponentID id = COMPONENT_COUNT++;
+			SolaireRuntimeAssert(id < MAX_COMPONENT_TYPES, "SolaireCPP : RegisterComponent called with more than MAX_COMPONENT_TYPES types");
+			COMPONENT_INFO[id] = aInfo;
+			return id;
+		}
+	}
+
+	const ComponentInfo& SOLAIRE_DEFAULT_CALL GetComponentInfo(const ComponentID aID) throw() {
+		return COMPONENT_INFO[aID];
+	}
+}
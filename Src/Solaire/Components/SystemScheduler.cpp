@@ -0,0 +1,127 @@
+//Copyright 2015 Adam Smith
+//
+//Licensed under the Apache License, Version 2.0 (the "License");
+//you may not use this file except in compliance with the License.
+//You may obtain a copy of the License at
+//
+//    http://www.apache.org/licenses/LICENSE-2.0
+//
+//Unless required by applicable law or agreed to in writing, software
+//distributed under the License is distributed on an "AS IS" BASIS,
+//WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//See the License for the specific language governing permissions and
+//limitations under the License.
+
+// Contact :
+// Email             : solairelibrary@mail.com
+// GitHub repository : https://github.com/SolaireLibrary/SolaireCPP
+
+#include "Solaire\Components\SystemScheduler.hpp"
+
+namespace Solaire {
+
+	// SystemScheduler::Node
+
+	SystemScheduler::Node::Node(Allocator& aAllocator, System& aTarget) :
+		Target(&aTarget),
+		Dependents(aAllocator),
+		DependencyCount(0),
+		TaskCount(0),
+		Remaining(0),
+		NextTask(0),
+		CompletedTasks(0)
+	{}
+
+	// SystemScheduler
+
+	SystemScheduler::SystemScheduler(Allocator& aAllocator, World& aWorld, TaskScheduler& aScheduler) :
+		mAllocator(aAllocator),
+		mWorld(aWorld),
+		mScheduler(aScheduler),
+		mNodes(aAllocator)
+	{}
+
+	SystemScheduler::~SystemScheduler() {
+		const uint32_t count = mNodes.Size();
+		for(uint32_t i = 0; i < count; ++i) {
+			mNodes[i]->~Node();
+			mAllocator.Deallocate(mNodes[i]);
+		}
+	}
+
+	void SOLAIRE_DEFAULT_CALL SystemScheduler::AddSystem(System& aSystem) {
+		const ComponentMask reads = aSystem.GetReadMask();
+		const ComponentMask writes = aSystem.GetWriteMask();
+		const uint32_t index = mNodes.Size();
+
+		Node* const node = mAllocator.RawAllocate<Node>(mAllocator, aSystem);
+		for(uint32_t i = 0; i < index; ++i) {
+			Node& other = *mNodes[i];
+			const ComponentMask otherReads = other.Target->GetReadMask();
+			const ComponentMask otherWrites = other.Target->GetWriteMask();
+			if((writes & (otherReads | otherWrites)) != 0 || (otherWrites & reads) != 0) {
+				other.Dependents.PushBack(index);
+				++node->DependencyCount;
+			}
+		}
+		mNodes.PushBack(node);
+	}
+
+	void SOLAIRE_DEFAULT_CALL SystemScheduler::Run() {
+		const uint32_t count = mNodes.Size();
+		if(count == 0) return;
+
+		for(uint32_t i = 0; i < count; ++i) {
+			Node& node = *mNodes[i];
+			node.TaskCount = node.Target->Prepare(mWorld);
+			node.Remaining = node.DependencyCount;
+			node.NextTask = 0;
+			node.CompletedTasks = 0;
+		}
+
+		// Dependents are added to the group by the job that completes their last dependency
+		TaskGroup group(mScheduler);
+		for(uint32_t i = 0; i < count; ++i) {
+			if(mNodes[i]->DependencyCount == 0) Schedule(group, i);
+		}
+		group.Wait();
+	}
+
+	void SOLAIRE_DEFAULT_CALL SystemScheduler::RunJob(TaskGroup& aGroup, const uint32_t aNode) {
+		Node& node = *mNodes[aNode];
+		while(true) {
+			const uint32_t task = node.NextTask++;
+			if(task >= node.TaskCount) return;
+			node.Target->Execute(mWorld, task);
+			if(++node.CompletedTasks == node.TaskCount) {
+				Complete(aGroup, aNode);
+				return;
+			}
+		}
+	}
+
+	void SOLAIRE_DEFAULT_CALL SystemScheduler::Schedule(TaskGroup& aGroup, const uint32_t aNode) {
+		const Node& node = *mNodes[aNode];
+		if(node.TaskCount == 0) {
+			Complete(aGroup, aNode);
+			return;
+		}
+
+		// One job per thread that can help, including the thread waiting in Run
+		const uint32_t jobs = Min<uint32_t>(node.TaskCount, mScheduler.GetThreadCount() + 1);
+		for(uint32_t i = 0; i < jobs; ++i) {
+			aGroup.Run([this, &aGroup, aNode]() {
+				RunJob(aGroup, aNode);
+			});
+		}
+	}
+
+	void SOLAIRE_DEFAULT_CALL SystemScheduler::Complete(TaskGroup& aGroup, const uint32_t aNode) {
+		const DynamicArray<uint32_t>& dependents = mNodes[aNode]->Dependents;
+		const uint32_t count = dependents.Size();
+		for(uint32_t i = 0; i < count; ++i) {
+			const uint32_t dependent = dependents[i];
+			if(--mNodes[dependent]->Remaining == 0) Schedule(aGroup, dependent);
+		}
+	}
+}
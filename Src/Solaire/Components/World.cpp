@@ -0,0 +1,129 @@
+//Copyright 2015 Adam Smith
+//
+//Licensed under the Apache License, Version 2.0 (the "License");
+//you may not use this file except in compliance with the License.
+//You may obtain a copy of the License at
+//
+//    http://www.apache.org/licenses/LICENSE-2.0
+//
+//Unless required by applicable law or agreed to in writing, software
+//distributed under the License is distributed on an "AS IS" BASIS,
+//WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//See the License for the specific language governing permissions and
+//limitations under the License.
+
+// Contact :
+// Email             : solairelibrary@mail.com
+// GitHub repository : https://github.com/SolaireLibrary/SolaireCPP
+
+#include "Solaire\Components\World.hpp"
+
+namespace Solaire {
+
+	// World
+
+	World::World(Allocator& aAllocator) :
+		mAllocator(aAllocator),
+		mEntities(aAllocator),
+		mArchetypes(aAllocator),
+		mRoot(nullptr)
+	{
+		mRoot = &FindArchetype(0);
+	}
+
+	World::~World() {
+		const uint32_t count = mArchetypes.Size();
+		for(uint32_t i = 0; i < count; ++i) {
+			Archetype* const archetype = mArchetypes[i];
+			archetype->~Archetype();
+			mAllocator.Deallocate(archetype);
+		}
+	}
+
+	Archetype& SOLAIRE_DEFAULT_CALL World::FindArchetype(const ComponentMask aMask) {
+		const uint32_t count = mArchetypes.Size();
+		for(uint32_t i = 0; i < count; ++i) {
+			if(mArchetypes[i]->GetMask() == aMask) return *mArchetypes[i];
+		}
+
+		Archetype* const archetype = mAllocator.RawAllocate<Archetype>(mAllocator, aMask);
+		mArchetypes.PushBack(archetype);
+		return *archetype;
+	}
+
+	void SOLAIRE_DEFAULT_CALL World::MoveEntity(EntityLocation& aLocation, const Entity aEntity, Archetype& aTarget) {
+		Archetype& source = *aLocation.Owner;
+		const uint32_t row = aTarget.PushRow(aEntity);
+		Archetype::MoveRow(source, aLocation.Row, aTarget, row);
+
+		const Entity moved = source.EraseRow(aLocation.Row, false);
+		if(moved != Entity()) mEntities.Find(moved)->Row = aLocation.Row;
+
+		aLocation.Owner = &aTarget;
+		aLocation.Row = row;
+	}
+
+	Entity SOLAIRE_DEFAULT_CALL World::CreateEntity() {
+		EntityLocation location;
+		location.Owner = mRoot;
+		location.Row = 0;
+		const Entity entity = mEntities.Insert(location);
+		mEntities.Find(entity)->Row = mRoot->PushRow(entity);
+		return entity;
+	}
+
+	bool SOLAIRE_DEFAULT_CALL World::DestroyEntity(const Entity aEntity) throw() {
+		EntityLocation* const location = mEntities.Find(aEntity);
+		if(location == nullptr) return false;
+
+		const uint32_t row = location->Row;
+		const Entity moved = location->Owner->EraseRow(row, true);
+		if(moved != Entity()) mEntities.Find(moved)->Row = row;
+		mEntities.Erase(aEntity);
+		return true;
+	}
+
+	void* SOLAIRE_DEFAULT_CALL World::AddComponent(const Entity aEntity, const ComponentID aID, bool& aExists) {
+		EntityLocation* const location = mEntities.Find(aEntity);
+		SolaireRuntimeAssert(location != nullptr, "SolaireCPP : World::AddComponent called on a destroyed entity");
+
+		Archetype& source = *location->Owner;
+		void* const existing = source.GetComponent(location->Row, aID);
+		aExists = existing != nullptr;
+		if(aExists) return existing;
+
+		Archetype* target = source.GetAddEdge(aID);
+		if(target == nullptr) {
+			target = &FindArchetype(source.GetMask() | (static_cast<ComponentMask>(1) << aID));
+			source.SetAddEdge(aID, target);
+			target->SetRemoveEdge(aID, &source);
+		}
+
+		MoveEntity(*location, aEntity, *target);
+		return target->GetComponent(location->Row, aID);
+	}
+
+	bool SOLAIRE_DEFAULT_CALL World::RemoveComponent(const Entity aEntity, const ComponentID aID) {
+		EntityLocation* const location = mEntities.Find(aEntity);
+		if(location == nullptr) return false;
+
+		Archetype& source = *location->Owner;
+		if(source.GetComponent(location->Row, aID) == nullptr) return false;
+
+		Archetype* target = source.GetRemoveEdge(aID);
+		if(target == nullptr) {
+			target = &FindArchetype(source.GetMask() & ~(static_cast<ComponentMask>(1) << aID));
+			source.SetRemoveEdge(aID, target);
+			target->SetAddEdge(aID, &source);
+		}
+
+		MoveEntity(*location, aEntity, *target);
+		return true;
+	}
+
+	void* SOLAIRE_DEFAULT_CALL World::GetComponent(const Entity aEntity, const ComponentID aID) const throw() {
+		const EntityLocation* const location = mEntities.Find(aEntity);
+		if(location == nullptr) return nullptr;
+		return location->Owner->GetComponent(location->Row, aID);
+	}
+}
@@ -0,0 +1,136 @@
+//Copyright 2015 Adam Smith
+//
+//Licensed under the Apache License, Version 2.0 (the "License");
+//you may not use this file except in compliance with the License.
+//You may obtain a copy of the License at
+//
+//    http://www.apache.org/licenses/LICENSE-2.0
+//
+//Unless required by applicable law or agreed to in writing, software
+//distributed under the License is distributed on an "AS IS" BASIS,
+//WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//See the License for the specific language governing permissions and
+//limitations under the License.
+
+// Contact :
+// Email             : solairelibrary@mail.com
+// GitHub repository : https://github.com/SolaireLibrary/SolaireCPP
+
+#include "Solaire\Core\Init.hpp"
+#include "Solaire\Core\PoolAllocator.hpp"
+#include "Solaire\Core\Maths.hpp"
+
+namespace Solaire {
+
+	// PoolAllocator
+
+	PoolAllocator::PoolAllocator(AllocatorI& aParent, const uint32_t aBlockSize, const uint32_t aAlignment, const uint32_t aChunkBlocks) throw() :
+		mParent(aParent),
+		mChunks(nullptr),
+		mFree(nullptr),
+		mBlockSize(CeilToMultiple<uint32_t>(Max<uint32_t>(aBlockSize, sizeof(Block)), Max<uint32_t>(aAlignment, sizeof(Block)))),
+		mAlignment(Max<uint32_t>(aAlignment, sizeof(Block))),
+		mChunkBlocks(aChunkBlocks == 0 ? 1 : aChunkBlocks),
+		mBlockCount(0),
+		mAllocatedCount(0)
+	{}
+
+	SOLAIRE_EXPORT_CALL PoolAllocator::~PoolAllocator() {
+		DeallocateAll();
+	}
+
+	bool SOLAIRE_DEFAULT_CALL PoolAllocator::AllocateChunk() throw() {
+		// The parent's alignment is unknown, so the chunk is padded to align the first block
+		const uint32_t header = sizeof(Chunk) + mAlignment - 1;
+		void* const memory = mParent.Allocate(header + mBlockSize * mChunkBlocks);
+		if(memory == nullptr) return false;
+
+		Chunk* const chunk = static_cast<Chunk*>(memory);
+		chunk->Next = mChunks;
+		mChunks = chunk;
+
+		const uintptr_t first = CeilToMultiple<uintptr_t>(reinterpret_cast<uintptr_t>(memory) + sizeof(Chunk), mAlignment);
+		uint8_t* const blocks = reinterpret_cast<uint8_t*>(first);
+		for(uint32_t i = mChunkBlocks; i > 0; --i) {
+			Block* const block = reinterpret_cast<Block*>(blocks + mBlockSize * (i - 1));
+			block->Next = mFree;
+			mFree = block;
+		}
+
+		mBlockCount += mChunkBlocks;
+		return true;
+	}
+
+	bool SOLAIRE_DEFAULT_CALL PoolAllocator::IsBlock(const void* const aAddress) const throw() {
+		const uintptr_t address = reinterpret_cast<uintptr_t>(aAddress);
+		for(const Chunk* chunk = mChunks; chunk; chunk = chunk->Next) {
+			const uintptr_t first = CeilToMultiple<uintptr_t>(reinterpret_cast<uintptr_t>(chunk) + sizeof(Chunk), mAlignment);
+			if(address >= first && address < first + mBlockSize * mChunkBlocks) return (address - first) % mBlockSize == 0;
+		}
+		return false;
+	}
+
+	bool SOLAIRE_DEFAULT_CALL PoolAllocator::Reserve(const uint32_t aCount) throw() {
+		while(mBlockCount - mAllocatedCount < aCount) {
+			if(! AllocateChunk()) return false;
+		}
+		return true;
+	}
+
+	uint32_t SOLAIRE_DEFAULT_CALL PoolAllocator::GetBlockSize() const throw() {
+		return mBlockSize;
+	}
+
+	uint32_t SOLAIRE_DEFAULT_CALL PoolAllocator::GetBlockCount() const throw() {
+		return mBlockCount;
+	}
+
+	AllocatorI& SOLAIRE_DEFAULT_CALL PoolAllocator::GetParent() const throw() {
+		return mParent;
+	}
+
+	uint32_t SOLAIRE_EXPORT_CALL PoolAllocator::GetAllocatedBytes() const throw() {
+		return mAllocatedCount * mBlockSize;
+	}
+
+	uint32_t SOLAIRE_EXPORT_CALL PoolAllocator::GetFreeBytes() const throw() {
+		const uint64_t bytes = static_cast<uint64_t>(mBlockCount - mAllocatedCount) * mBlockSize + mParent.GetFreeBytes();
+		return bytes > UINT32_MAX ? UINT32_MAX : static_cast<uint32_t>(bytes);
+	}
+
+	uint32_t SOLAIRE_EXPORT_CALL PoolAllocator::SizeOf(const void* const aObject) throw() {
+		return IsBlock(aObject) ? mBlockSize : 0;
+	}
+
+	void* SOLAIRE_EXPORT_CALL PoolAllocator::Allocate(const size_t aBytes) throw() {
+		if(aBytes > mBlockSize) return nullptr;
+		if(mFree == nullptr && ! AllocateChunk()) return nullptr;
+		Block* const block = mFree;
+		mFree = block->Next;
+		++mAllocatedCount;
+		return block;
+	}
+
+	bool SOLAIRE_EXPORT_CALL PoolAllocator::Deallocate(const void* const aObject) throw() {
+		if(aObject == nullptr) return false;
+		Block* const block = static_cast<Block*>(const_cast<void*>(aObject));
+		block->Next = mFree;
+		mFree = block;
+		--mAllocatedCount;
+		return true;
+	}
+
+	bool SOLAIRE_EXPORT_CALL PoolAllocator::DeallocateAll() throw() {
+		bool result = true;
+		while(mChunks) {
+			Chunk* const next = mChunks->Next;
+			if(! mParent.Deallocate(mChunks)) result = false;
+			mChunks = next;
+		}
+		mFree = nullptr;
+		mBlockCount = 0;
+		mAllocatedCount = 0;
+		return result;
+	}
+
+}
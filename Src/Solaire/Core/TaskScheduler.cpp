@@ -0,0 +1,293 @@
+//Copyright 2015 Adam Smith
+//
+//Licensed under the Apache License, Version 2.0 (the "License");
+//you may not use this file except in compliance with the License.
+//You may obtain a copy of the License at
+//
+//    http://www.apache.org/licenses/LICENSE-2.0
+//
+//Unless required by applicable law or agreed to in writing, software
+//distributed under the License is distributed on an "AS IS" BASIS,
+//WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//See the License for the specific language governing permissions and
+//limitations under the License.
+
+// Contact :
+// Email             : solairelibrary@mail.com
+// GitHub repository : https://github.com/SolaireLibrary/SolaireCPP
+
+#include "Solaire\Core\TaskScheduler.hpp"
+#include "Solaire\Core\Maths.hpp"
+#if SOLAIRE_OS == SOLAIRE_LINUX
+	#include <pthread.h>
+#endif
+
+namespace Solaire {
+
+	static SOLAIRE_THREADLOCAL const TaskScheduler* CURRENT_SCHEDULER = nullptr;
+	static SOLAIRE_THREADLOCAL uint32_t CURRENT_WORKER = TaskScheduler::NOT_A_WORKER;
+	static SOLAIRE_THREADLOCAL uint32_t CURRENT_SEED = 0x9E3779B9;
+
+	static inline SOLAIRE_FORCE_INLINE uint32_t SOLAIRE_DEFAULT_CALL NextRandom(uint32_t& aSeed) throw() {
+		// xorshift32
+		aSeed ^= aSeed << 13;
+		aSeed ^= aSeed >> 17;
+		aSeed ^= aSeed << 5;
+		return aSeed;
+	}
+
+	#ifndef SOLAIRE_DISABLE_MULTITHREADING
+
+	static void SOLAIRE_DEFAULT_CALL SetThreadAffinity(std::thread& aThread, const uint32_t aCore) throw() {
+		#if SOLAIRE_OS == SOLAIRE_WINDOWS
+			const uint32_t bits = sizeof(DWORD_PTR) * 8;
+			SetThreadAffinityMask(aThread.native_handle(), static_cast<DWORD_PTR>(1) << (aCore % bits));
+		#elif SOLAIRE_OS == SOLAIRE_LINUX
+			cpu_set_t set;
+			CPU_ZERO(&set);
+			CPU_SET(aCore % CPU_SETSIZE, &set);
+			pthread_setaffinity_np(aThread.native_handle(), sizeof(set), &set);
+		#endif
+	}
+
+	#endif
+
+	// TaskScheduler::Worker
+
+	TaskScheduler::Worker::Worker(AllocatorI& aAllocator, const uint32_t aSeed) :
+		Deque(aAllocator, 256),
+		Seed(aSeed)
+	{}
+
+	// TaskScheduler
+
+	TaskScheduler::TaskScheduler(Allocator& aAllocator, const uint32_t aThreadCount, const Affinity aAffinity) :
+		mAllocator(aAllocator),
+		mThreadCount(aThreadCount),
+		mWorkerMemory(nullptr),
+		mWorkers(nullptr),
+		mInjection(aAllocator, INJECTION_CAPACITY),
+		mFreeSlots(aAllocator),
+		mSlotBlocks(aAllocator),
+		mSleeping(0)
+		#ifndef SOLAIRE_DISABLE_MULTITHREADING
+			,
+			mThreads(nullptr),
+			mStop(false)
+		#endif
+	{
+		#ifdef SOLAIRE_DISABLE_MULTITHREADING
+			// Tasks are executed as soon as they are submitted
+			mThreadCount = 0;
+		#else
+			const uint32_t hardwareThreads = Max<uint32_t>(std::thread::hardware_concurrency(), 1);
+			if(mThreadCount == 0) mThreadCount = hardwareThreads;
+
+			// The deque indices are cache line aligned, but the allocator's alignment is unknown
+			const uint32_t alignment = std::alignment_of<Worker>::value;
+			mWorkerMemory = mAllocator.Allocate(sizeof(Worker) * mThreadCount + alignment - 1);
+			SolaireRuntimeAssert(mWorkerMemory != nullptr, "SolaireCPP : TaskScheduler failed to allocate workers");
+			mWorkers = reinterpret_cast<Worker*>(CeilToMultiple<uintptr_t>(reinterpret_cast<uintptr_t>(mWorkerMemory), alignment));
+			for(uint32_t i = 0; i < mThreadCount; ++i) new(mWorkers + i) Worker(mAllocator, (i + 1) * 0x9E3779B9);
+
+			mThreads = static_cast<std::thread*>(mAllocator.Allocate(sizeof(std::thread) * mThreadCount));
+			SolaireRuntimeAssert(mThreads != nullptr, "SolaireCPP : TaskScheduler failed to allocate threads");
+			for(uint32_t i = 0; i < mThreadCount; ++i) {
+				new(mThreads + i) std::thread(&TaskScheduler::WorkerMain, this, i);
+				if(aAffinity == AFFINITY_PER_CORE) SetThreadAffinity(mThreads[i], i % hardwareThreads);
+			}
+		#endif
+	}
+
+	TaskScheduler::~TaskScheduler() {
+		#ifndef SOLAIRE_DISABLE_MULTITHREADING
+			SolaireSynchronized(mLock,
+				mStop = true;
+			)
+			mWake.notify_all();
+
+			for(uint32_t i = 0; i < mThreadCount; ++i) {
+				mThreads[i].join();
+				mThreads[i].~thread();
+			}
+			mAllocator.Deallocate(mThreads);
+
+			for(uint32_t i = 0; i < mThreadCount; ++i) mWorkers[i].~Worker();
+			mAllocator.Deallocate(mWorkerMemory);
+		#endif
+
+		mFreeSlots.Clear();
+		const uint32_t blocks = mSlotBlocks.Size();
+		for(uint32_t i = 0; i < blocks; ++i) mAllocator.Deallocate(mSlotBlocks[i]);
+	}
+
+	uint32_t SOLAIRE_DEFAULT_CALL TaskScheduler::GetWorkerIndex() const throw() {
+		return CURRENT_SCHEDULER == this ? CURRENT_WORKER : NOT_A_WORKER;
+	}
+
+	TaskScheduler::TaskSlot* SOLAIRE_DEFAULT_CALL TaskScheduler::AllocateSlot() {
+		TaskSlot* slot;
+		if(mFreeSlots.TryPop(slot)) return slot;
+
+		// Task storage is 16 byte aligned, but the allocator's alignment is unknown
+		const uint32_t alignment = std::alignment_of<TaskSlot>::value;
+		void* memory = nullptr;
+		SolaireSynchronized(mLock,
+			memory = mAllocator.Allocate(sizeof(TaskSlot) * SLOTS_PER_BLOCK + alignment - 1);
+			if(memory != nullptr) mSlotBlocks.PushBack(memory);
+		)
+		SolaireRuntimeAssert(memory != nullptr, "SolaireCPP : TaskScheduler failed to allocate tasks");
+		TaskSlot* const block = reinterpret_cast<TaskSlot*>(CeilToMultiple<uintptr_t>(reinterpret_cast<uintptr_t>(memory), alignment));
+
+		// Keep the first slot, the rest are published to the free list with a single CAS
+		TaskSlot* spare[SLOTS_PER_BLOCK - 1];
+		for(uint32_t i = 1; i < SLOTS_PER_BLOCK; ++i) spare[i - 1] = block + i;
+		mFreeSlots.PushBackRange(spare, SLOTS_PER_BLOCK - 1);
+		return block;
+	}
+
+	void SOLAIRE_DEFAULT_CALL TaskScheduler::Submit(TaskSlot* const aSlot) {
+		if(mThreadCount == 0) {
+			Execute(aSlot);
+			return;
+		}
+
+		const uint32_t worker = GetWorkerIndex();
+		if(worker != NOT_A_WORKER) {
+			mWorkers[worker].Deque.Push(aSlot);
+		}else if(! mInjection.TryPush(aSlot)) {
+			// Every worker is busy and the queue is full, so the submitting thread does the work
+			Execute(aSlot);
+			return;
+		}
+
+		#ifndef SOLAIRE_DISABLE_MULTITHREADING
+			// Orders the push before the sleeper count is read, see WorkerMain
+			std::atomic_thread_fence(std::memory_order_seq_cst);
+			if(mSleeping.load(std::memory_order_relaxed) != 0) {
+				{
+					std::lock_guard<std::mutex> lock(mLock);
+				}
+				mWake.notify_one();
+			}
+		#endif
+	}
+
+	void SOLAIRE_DEFAULT_CALL TaskScheduler::Execute(TaskSlot* const aSlot) {
+		TaskGroup* const group = aSlot->Group;
+		aSlot->Invoke(*aSlot);
+		mFreeSlots.PushBack(aSlot);
+		group->Release();
+	}
+
+	TaskScheduler::TaskSlot* SOLAIRE_DEFAULT_CALL TaskScheduler::FindTask(const uint32_t aWorker) {
+		TaskSlot* slot;
+		if(aWorker != NOT_A_WORKER && mWorkers[aWorker].Deque.Pop(slot)) return slot;
+		if(mInjection.TryPop(slot)) return slot;
+
+		// Start at a random victim so that thieves spread out
+		uint32_t& seed = aWorker == NOT_A_WORKER ? CURRENT_SEED : mWorkers[aWorker].Seed;
+		const uint32_t first = NextRandom(seed) % mThreadCount;
+		for(uint32_t i = 0; i < mThreadCount; ++i) {
+			const uint32_t victim = (first + i) % mThreadCount;
+			if(victim != aWorker && mWorkers[victim].Deque.Steal(slot)) return slot;
+		}
+		return nullptr;
+	}
+
+	bool SOLAIRE_DEFAULT_CALL TaskScheduler::HasTasks() const throw() {
+		if(! mInjection.IsEmpty()) return true;
+		for(uint32_t i = 0; i < mThreadCount; ++i) {
+			if(! mWorkers[i].Deque.IsEmpty()) return true;
+		}
+		return false;
+	}
+
+	bool SOLAIRE_DEFAULT_CALL TaskScheduler::RunTask() {
+		if(mThreadCount == 0) return false;
+		TaskSlot* const slot = FindTask(GetWorkerIndex());
+		if(slot == nullptr) return false;
+		Execute(slot);
+		return true;
+	}
+
+	#ifndef SOLAIRE_DISABLE_MULTITHREADING
+
+	void SOLAIRE_DEFAULT_CALL TaskScheduler::WorkerMain(const uint32_t aWorker) {
+		CURRENT_SCHEDULER = this;
+		CURRENT_WORKER = aWorker;
+
+		uint32_t idle = 0;
+		while(true) {
+			TaskSlot* const slot = FindTask(aWorker);
+			if(slot != nullptr) {
+				Execute(slot);
+				idle = 0;
+				continue;
+			}
+
+			if(++idle < SPIN_COUNT) {
+				std::this_thread::yield();
+				continue;
+			}
+
+			std::unique_lock<std::mutex> lock(mLock);
+			if(mStop) return;
+			++mSleeping;
+			std::atomic_thread_fence(std::memory_order_seq_cst);
+			// A task submitted after this check will see the sleeper and notify under the lock
+			if(! HasTasks()) mWake.wait(lock);
+			--mSleeping;
+			idle = 0;
+		}
+	}
+
+	#endif
+
+	// TaskGroup
+
+	TaskGroup::TaskGroup(TaskScheduler& aScheduler) :
+		mScheduler(aScheduler),
+		mContinuation(nullptr),
+		mPending(1),
+		mDone(false),
+		mReleased(false)
+	{}
+
+	TaskGroup::~TaskGroup() {
+		Wait();
+	}
+
+	void SOLAIRE_DEFAULT_CALL TaskGroup::Release() {
+		// mPending starts at 1 for the owner, which is released by Then or Wait
+		if(--mPending != 0) return;
+
+		Implementation::TaskSlot* const continuation = mContinuation;
+		if(continuation != nullptr) {
+			// No other thread can reference the group until the continuation is submitted
+			mContinuation = nullptr;
+			mPending = 1;
+			mScheduler.Submit(continuation);
+		}else {
+			mDone.store(true, std::memory_order_release);
+		}
+	}
+
+	void SOLAIRE_DEFAULT_CALL TaskGroup::Wait() {
+		if(! mReleased) {
+			mReleased = true;
+			Release();
+		}
+
+		uint32_t idle = 0;
+		while(! mDone.load(std::memory_order_acquire)) {
+			if(mScheduler.RunTask()) {
+				idle = 0;
+			}else if(++idle > 64) {
+				#ifndef SOLAIRE_DISABLE_MULTITHREADING
+					std::this_thread::yield();
+				#endif
+			}
+		}
+	}
+}
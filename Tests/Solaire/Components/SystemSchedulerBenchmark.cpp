@@ -0,0 +1,197 @@
+//Copyright 2015 Adam Smith
+//
+//Licensed under the Apache License, Version 2.0 (the "License");
+//you may not use this file except in compliance with the License.
+//You may obtain a copy of the License at
+//
+//    http://www.apache.org/licenses/LICENSE-2.0
+//
+//Unless required by applicable law or agreed to in writing, software
+//distributed under the License is distributed on an "AS IS" BASIS,
+//WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//See the License for the specific language governing permissions and
+//limitations under the License.
+
+// Contact :
+// Email             : solairelibrary@mail.com
+// GitHub repository : https://github.com/SolaireLibrary/SolaireCPP
+
+/*!
+	\file SystemSchedulerBenchmark.cpp
+	\brief Scaling benchmark for SystemScheduler at 1 to N threads, where N is the first argument or the number of hardware
+	threads.
+	\detail
+	A world of entities with a mix of archetypes is updated by four systems, two of which conflict with each other and two
+	of which can run alongside them. Each thread count runs the systems a fixed number of times on a new TaskScheduler and
+	prints the average time per run. The component values are checked after each thread count, so the benchmark also fails
+	if the schedule does not respect the systems' dependencies. Returns 0 on success.
+	\author
+	Created			: Adam Smith
+	Last modified	: Adam Smith
+	\version 1.0
+	\date
+	Created			: 18th October 2026
+	Last Modified	: 18th October 2026
+*/
+
+#include <cstdio>
+#include <cstdlib>
+#include <atomic>
+#include <chrono>
+#include <thread>
+#include "Solaire\Components\SystemScheduler.hpp"
+
+using namespace Solaire;
+
+namespace {
+
+	class MallocAllocator : public Allocator {
+	private:
+		std::atomic<uint32_t> mAllocations;
+	public:
+		MallocAllocator() :
+			mAllocations(0)
+		{}
+
+		uint32_t SOLAIRE_EXPORT_CALL GetAllocatedBytes() const throw() override {
+			return 0;
+		}
+
+		uint32_t SOLAIRE_EXPORT_CALL GetFreeBytes() const throw() override {
+			return UINT32_MAX;
+		}
+
+		uint32_t SOLAIRE_EXPORT_CALL SizeOf(const void* const) throw() override {
+			return 0;
+		}
+
+		void* SOLAIRE_EXPORT_CALL Allocate(const size_t aBytes) throw() override {
+			++mAllocations;
+			return std::malloc(aBytes);
+		}
+
+		bool SOLAIRE_EXPORT_CALL Deallocate(const void* const aObject) throw() override {
+			--mAllocations;
+			std::free(const_cast<void*>(aObject));
+			return true;
+		}
+
+		bool SOLAIRE_EXPORT_CALL DeallocateAll() throw() override {
+			return false;
+		}
+
+		uint32_t SOLAIRE_DEFAULT_CALL GetAllocationCount() const throw() {
+			return mAllocations;
+		}
+	};
+
+	struct Position {
+		float X, Y, Z;
+	};
+
+	struct Velocity {
+		float X, Y, Z;
+	};
+
+	struct Mass {
+		float Value;
+	};
+
+	struct Counter {
+		uint32_t Value;
+	};
+
+	enum : uint32_t {
+		ENTITIES = 400000,
+		RUNS = 50
+	};
+
+	bool SOLAIRE_DEFAULT_CALL RunBenchmark(Allocator& aAllocator, World& aWorld, const uint32_t aThreads, double& aMilliseconds) {
+		// Move reads Velocity and Gravity writes it, so Gravity waits for Move. Count and Check both write Counter.
+		auto move = MakeChunkSystem<Position, const Velocity>(aAllocator, [](const uint32_t aCount, Position* const aPosition, const Velocity* const aVelocity) {
+			for(uint32_t i = 0; i < aCount; ++i) {
+				aPosition[i].X += aVelocity[i].X;
+				aPosition[i].Y += aVelocity[i].Y;
+				aPosition[i].Z += aVelocity[i].Z;
+			}
+		});
+		auto gravity = MakeChunkSystem<Velocity, const Mass>(aAllocator, [](const uint32_t aCount, Velocity* const aVelocity, const Mass* const aMass) {
+			for(uint32_t i = 0; i < aCount; ++i) aVelocity[i].Y -= 0.0f * aMass[i].Value;
+		});
+		auto count = MakeChunkSystem<Counter>(aAllocator, [](const uint32_t aCount, Counter* const aCounter) {
+			for(uint32_t i = 0; i < aCount; ++i) ++aCounter[i].Value;
+		});
+		auto check = MakeChunkSystem<const Position, Counter>(aAllocator, [](const uint32_t aCount, const Position* const aPosition, Counter* const aCounter) {
+			for(uint32_t i = 0; i < aCount; ++i) aCounter[i].Value += aPosition[i].X > 0.0f ? 1 : 0;
+		});
+
+		float before = 0.0f;
+		aWorld.ForEach<const Position>([&before](const Position& aPosition) {
+			before = aPosition.X;
+		});
+
+		TaskScheduler tasks(aAllocator, aThreads);
+		SystemScheduler scheduler(aAllocator, aWorld, tasks);
+		scheduler.AddSystem(move);
+		scheduler.AddSystem(gravity);
+		scheduler.AddSystem(count);
+		scheduler.AddSystem(check);
+
+		const auto begin = std::chrono::steady_clock::now();
+		for(uint32_t i = 0; i < RUNS; ++i) scheduler.Run();
+		const auto end = std::chrono::steady_clock::now();
+		aMilliseconds = std::chrono::duration<double, std::milli>(end - begin).count() / RUNS;
+
+		bool result = true;
+		const float expected = before + RUNS;
+		aWorld.ForEach<const Position>([&](const Position& aPosition) {
+			result = result && aPosition.X == expected && aPosition.Z == 3.0f * expected;
+		});
+		return result;
+	}
+}
+
+int main(int aArgCount, char** aArgs) {
+	MallocAllocator allocator;
+	bool result = true;
+	{
+		World world(allocator);
+		for(uint32_t i = 0; i < ENTITIES; ++i) {
+			const Entity entity = world.CreateEntity();
+			world.AddComponent<Position>(entity, Position{0.0f, 0.0f, 0.0f});
+			world.AddComponent<Velocity>(entity, Velocity{1.0f, 2.0f, 3.0f});
+			if(i % 3 == 0) world.AddComponent<Mass>(entity, Mass{2.0f});
+			if(i % 5 == 0) world.AddComponent<Counter>(entity, Counter{0});
+		}
+
+		uint32_t maxThreads = aArgCount > 1 ? std::strtoul(aArgs[1], nullptr, 10) : std::thread::hardware_concurrency();
+		if(maxThreads == 0) maxThreads = 1;
+
+		// Thread counts double until they reach maxThreads, which is always run even when it is not a power of two
+		uint32_t runs = 0;
+		uint32_t threads = 1;
+		std::printf("%8s %12s\n", "threads", "ms/run");
+		while(result) {
+			double milliseconds;
+			result = RunBenchmark(allocator, world, threads, milliseconds);
+			std::printf("%8u %12.3f\n", threads, milliseconds);
+			++runs;
+			if(threads == maxThreads) break;
+			threads = threads * 2 < maxThreads ? threads * 2 : maxThreads;
+		}
+
+		// Each run of Count and Check adds two to every counter
+		const uint32_t expected = runs * RUNS * 2;
+		world.ForEach<const Counter>([&](const Counter& aCounter) {
+			result = result && aCounter.Value == expected;
+		});
+	}
+
+	if(allocator.GetAllocationCount() != 0) {
+		std::fprintf(stderr, "SystemScheduler : memory was not deallocated\n");
+		result = false;
+	}
+
+	std::printf("SystemScheduler : %s\n", result ? "passed" : "failed");
+	return result ? EXIT_SUCCESS : EXIT_FAILURE;
+}
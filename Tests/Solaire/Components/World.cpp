@@ -0,0 +1,149 @@
+//Copyright 2015 Adam Smith
+//
+//Licensed under the Apache License, Version 2.0 (the "License");
+//you may not use this file except in compliance with the License.
+//You may obtain a copy of the License at
+//
+//    http://www.apache.org/licenses/LICENSE-2.0
+//
+//Unless required by applicable law or agreed to in writing, software
+//distributed under the License is distributed on an "AS IS" BASIS,
+//WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//See the License for the specific language governing permissions and
+//limitations under the License.
+
+// Contact :
+// Email             : solairelibrary@mail.com
+// GitHub repository : https://github.com/SolaireLibrary/SolaireCPP
+
+/*!
+	\file World.cpp
+	\brief Regression test for accessing the components of a World through const component types.
+	\detail
+	A const component type must refer to the same components as the type without const. Views, queries and per-entity
+	lookups are made with both, and must see the same values. Returns 0 on success.
+	\author
+	Created			: Adam Smith
+	Last modified	: Adam Smith
+	\version 1.0
+	\date
+	Created			: 18th October 2026
+	Last Modified	: 18th October 2026
+*/
+
+#include <cstdio>
+#include <cstdlib>
+#include "Solaire\Components\World.hpp"
+
+using namespace Solaire;
+
+namespace {
+
+	class MallocAllocator : public Allocator {
+	private:
+		uint32_t mAllocations;
+	public:
+		MallocAllocator() :
+			mAllocations(0)
+		{}
+
+		uint32_t SOLAIRE_EXPORT_CALL GetAllocatedBytes() const throw() override {
+			return 0;
+		}
+
+		uint32_t SOLAIRE_EXPORT_CALL GetFreeBytes() const throw() override {
+			return UINT32_MAX;
+		}
+
+		uint32_t SOLAIRE_EXPORT_CALL SizeOf(const void* const) throw() override {
+			return 0;
+		}
+
+		void* SOLAIRE_EXPORT_CALL Allocate(const size_t aBytes) throw() override {
+			++mAllocations;
+			return std::malloc(aBytes);
+		}
+
+		bool SOLAIRE_EXPORT_CALL Deallocate(const void* const aObject) throw() override {
+			--mAllocations;
+			std::free(const_cast<void*>(aObject));
+			return true;
+		}
+
+		bool SOLAIRE_EXPORT_CALL DeallocateAll() throw() override {
+			return false;
+		}
+
+		uint32_t SOLAIRE_DEFAULT_CALL GetAllocationCount() const throw() {
+			return mAllocations;
+		}
+	};
+
+	struct Position {
+		int X;
+	};
+
+	struct Velocity {
+		int X;
+	};
+
+	enum : uint32_t {
+		ENTITIES = 100
+	};
+
+	bool gPassed = true;
+
+	void SOLAIRE_DEFAULT_CALL Check(const bool aCondition, const char* const aMessage) {
+		if(aCondition) return;
+		std::fprintf(stderr, "World : %s\n", aMessage);
+		gPassed = false;
+	}
+
+	void SOLAIRE_DEFAULT_CALL TestConstComponents(World& aWorld) {
+		Entity entities[ENTITIES];
+		for(uint32_t i = 0; i < ENTITIES; ++i) {
+			entities[i] = aWorld.CreateEntity();
+			aWorld.AddComponent<Position>(entities[i], Position{static_cast<int>(i)});
+			if(i % 2 == 0) aWorld.AddComponent<Velocity>(entities[i], Velocity{1});
+		}
+
+		Check(GetComponentMask<const Position>() == GetComponentMask<Position>(), "const Position does not have the same mask as Position");
+
+		const Position* const position = aWorld.GetComponent<const Position>(entities[3]);
+		Check(position != nullptr && position->X == 3, "GetComponent with a const type");
+		Check(aWorld.HasComponent<const Position>(entities[3]), "HasComponent with a const type");
+		Check(! aWorld.HasComponent<const Velocity>(entities[3]), "HasComponent with a const type found a missing component");
+
+		ComponentView<Position> view(aWorld);
+		ComponentView<const Position> constView(aWorld);
+		Check(constView.Size() == ENTITIES && constView.Size() == view.Size(), "const view size");
+		bool same = constView.Size() == view.Size();
+		for(uint32_t i = 0; i < view.Size() && same; ++i) same = &constView[i] == &view[i];
+		Check(same, "const view elements are not the elements of the non-const view");
+
+		int sum = 0;
+		aWorld.ForEach<const Position, Velocity>([&sum](const Position& aPosition, Velocity& aVelocity) {
+			sum += aPosition.X;
+			aVelocity.X = aPosition.X;
+		});
+		Check(sum == (ENTITIES / 2) * (ENTITIES - 2) / 2, "ForEach with a const type");
+		Check(aWorld.GetComponent<Velocity>(entities[4])->X == 4, "ForEach did not write the non-const component");
+
+		Check(aWorld.RemoveComponent<const Velocity>(entities[4]), "RemoveComponent with a const type");
+		Check(! aWorld.HasComponent<Velocity>(entities[4]), "RemoveComponent with a const type left the component");
+
+		for(uint32_t i = 0; i < ENTITIES; ++i) aWorld.DestroyEntity(entities[i]);
+	}
+}
+
+int main() {
+	MallocAllocator allocator;
+	{
+		World world(allocator);
+		TestConstComponents(world);
+	}
+	Check(allocator.GetAllocationCount() == 0, "memory was not deallocated");
+
+	std::printf("World : %s\n", gPassed ? "passed" : "failed");
+	return gPassed ? EXIT_SUCCESS : EXIT_FAILURE;
+}
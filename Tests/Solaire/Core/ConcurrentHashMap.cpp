@@ -0,0 +1,206 @@
+//Copyright 2015 Adam Smith
+//
+//Licensed under the Apache License, Version 2.0 (the "License");
+//you may not use this file except in compliance with the License.
+//You may obtain a copy of the License at
+//
+//    http://www.apache.org/licenses/LICENSE-2.0
+//
+//Unless required by applicable law or agreed to in writing, software
+//distributed under the License is distributed on an "AS IS" BASIS,
+//WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//See the License for the specific language governing permissions and
+//limitations under the License.
+
+// Contact :
+// Email             : solairelibrary@mail.com
+// GitHub repository : https://github.com/SolaireLibrary/SolaireCPP
+
+/*!
+	\file ConcurrentHashMap.cpp
+	\brief Multi-threaded stress test for ConcurrentHashMap, intended to also be built with ASan and TSan.
+	\detail
+	Writers insert, overwrite and erase keys that only they own, while readers look up random keys without locking. Every
+	value stores its key and a version twice, so a reader that copies a slot while it is being written sees a mismatch.
+	The maps start empty, so shards grow and retire tables while readers are probing them. Once the threads have joined,
+	the map must hold exactly the last value each writer stored, and every table must be freed when it is destroyed. The
+	same run is repeated with a value type that is not trivially copyable, which uses locked reads. Returns 0 on success.
+	\author
+	Created			: Adam Smith
+	Last modified	: Adam Smith
+	\version 1.0
+	\date
+	Created			: 18th October 2026
+	Last Modified	: 18th October 2026
+*/
+
+#include <cstdio>
+#include <cstdlib>
+#include <atomic>
+#include <string>
+#include <thread>
+#include <vector>
+#include "Solaire\Core\ConcurrentHashMap.hpp"
+#include "Solaire\Maths\Hash\Djb2.hpp"
+
+using namespace Solaire;
+
+namespace {
+
+	class MallocAllocator : public AllocatorI {
+	private:
+		std::atomic<uint32_t> mAllocations;
+	public:
+		MallocAllocator() :
+			mAllocations(0)
+		{}
+
+		uint32_t SOLAIRE_EXPORT_CALL GetAllocatedBytes() const throw() override {
+			return 0;
+		}
+
+		uint32_t SOLAIRE_EXPORT_CALL GetFreeBytes() const throw() override {
+			return UINT32_MAX;
+		}
+
+		uint32_t SOLAIRE_EXPORT_CALL SizeOf(const void* const) throw() override {
+			return 0;
+		}
+
+		void* SOLAIRE_EXPORT_CALL Allocate(const size_t aBytes) throw() override {
+			++mAllocations;
+			return std::malloc(aBytes);
+		}
+
+		bool SOLAIRE_EXPORT_CALL Deallocate(const void* const aObject) throw() override {
+			--mAllocations;
+			std::free(const_cast<void*>(aObject));
+			return true;
+		}
+
+		bool SOLAIRE_EXPORT_CALL DeallocateAll() throw() override {
+			return false;
+		}
+
+		uint32_t SOLAIRE_DEFAULT_CALL GetAllocationCount() const throw() {
+			return mAllocations;
+		}
+	};
+
+	// Both halves hold (key << 32) | version, a torn copy has halves that differ
+	struct Versioned {
+		uint64_t First;
+		uint64_t Second;
+	};
+
+	enum : uint32_t {
+		WRITERS = 4,
+		READERS = 4,
+		KEY_RANGE = 1 << 14,
+		OPERATIONS = 200000
+	};
+
+	std::atomic<bool> gPassed(true);
+
+	void SOLAIRE_DEFAULT_CALL Fail(const char* const aMessage, const uint32_t aKey) {
+		std::fprintf(stderr, "ConcurrentHashMap : %s (key %u)\n", aMessage, aKey);
+		gPassed = false;
+	}
+
+	inline SOLAIRE_FORCE_INLINE uint32_t SOLAIRE_DEFAULT_CALL NextRandom(uint32_t& aSeed) throw() {
+		aSeed ^= aSeed << 13;
+		aSeed ^= aSeed >> 17;
+		aSeed ^= aSeed << 5;
+		return aSeed;
+	}
+
+	inline SOLAIRE_FORCE_INLINE uint64_t SOLAIRE_DEFAULT_CALL Encode(const uint32_t aKey, const uint32_t aVersion) throw() {
+		return (static_cast<uint64_t>(aKey) << 32) | aVersion;
+	}
+
+	// Version 0 means that the writer has erased the key, or never inserted it
+	struct Ops {
+		static void SOLAIRE_DEFAULT_CALL Store(ConcurrentHashMap<uint32_t, Versioned>& aMap, const uint32_t aKey, const uint32_t aVersion) {
+			const uint64_t value = Encode(aKey, aVersion);
+			aMap.Insert(aKey, Versioned{value, value});
+		}
+
+		static void SOLAIRE_DEFAULT_CALL Store(ConcurrentHashMap<uint32_t, std::string>& aMap, const uint32_t aKey, const uint32_t aVersion) {
+			aMap.Insert(aKey, std::to_string(Encode(aKey, aVersion)));
+		}
+
+		static uint32_t SOLAIRE_DEFAULT_CALL Load(const ConcurrentHashMap<uint32_t, Versioned>& aMap, const uint32_t aKey) {
+			Versioned value;
+			if(! aMap.Find(aKey, value)) return 0;
+			if(value.First != value.Second) Fail("read a torn value", aKey);
+			if((value.First >> 32) != aKey) Fail("read the value of another key", aKey);
+			return static_cast<uint32_t>(value.First);
+		}
+
+		static uint32_t SOLAIRE_DEFAULT_CALL Load(const ConcurrentHashMap<uint32_t, std::string>& aMap, const uint32_t aKey) {
+			std::string value;
+			if(! aMap.Find(aKey, value)) return 0;
+			const uint64_t decoded = std::strtoull(value.c_str(), nullptr, 10);
+			if((decoded >> 32) != aKey) Fail("read the value of another key", aKey);
+			return static_cast<uint32_t>(decoded);
+		}
+	};
+
+	template<class V>
+	void SOLAIRE_DEFAULT_CALL RunStress(AllocatorI& aAllocator, const HashFunction<uint32_t>& aHash, const uint32_t aOperations) {
+		ConcurrentHashMap<uint32_t, V> map(aAllocator, aHash);
+		std::vector<uint32_t> versions(KEY_RANGE, 0);
+		std::atomic<uint32_t> runningWriters(WRITERS);
+
+		std::vector<std::thread> threads;
+		for(uint32_t i = 0; i < WRITERS; ++i) {
+			// Writer i owns the keys that are equal to i modulo WRITERS, so versions has no shared elements
+			threads.emplace_back([&, i]() {
+				uint32_t seed = (i + 1) * 0x9E3779B9;
+				for(uint32_t j = 1; j <= aOperations; ++j) {
+					const uint32_t key = (NextRandom(seed) % (KEY_RANGE / WRITERS)) * WRITERS + i;
+					if(NextRandom(seed) % 4 == 0) {
+						map.Erase(key);
+						versions[key] = 0;
+					}else {
+						Ops::Store(map, key, j);
+						versions[key] = j;
+					}
+				}
+				--runningWriters;
+			});
+		}
+
+		for(uint32_t i = 0; i < READERS; ++i) {
+			threads.emplace_back([&, i]() {
+				uint32_t seed = (i + 1) * 0x85EBCA6B;
+				while(runningWriters != 0) Ops::Load(map, NextRandom(seed) % KEY_RANGE);
+			});
+		}
+
+		for(std::thread& thread : threads) thread.join();
+
+		uint32_t size = 0;
+		for(uint32_t key = 0; key < KEY_RANGE; ++key) {
+			if(Ops::Load(map, key) != versions[key]) Fail("the final value is not the last value stored", key);
+			if(versions[key] != 0) ++size;
+		}
+		if(map.Size() != size) Fail("the size does not match the number of keys stored", size);
+	}
+}
+
+int main() {
+	MallocAllocator allocator;
+	Djb2 hash;
+
+	RunStress<Versioned>(allocator, hash, OPERATIONS);
+	RunStress<std::string>(allocator, hash, OPERATIONS / 4);
+
+	if(allocator.GetAllocationCount() != 0) {
+		std::fprintf(stderr, "ConcurrentHashMap : %u tables were not deallocated\n", allocator.GetAllocationCount());
+		gPassed = false;
+	}
+
+	std::printf("ConcurrentHashMap : %s\n", gPassed ? "passed" : "failed");
+	return gPassed ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -0,0 +1,197 @@
+//Copyright 2015 Adam Smith
+//
+//Licensed under the Apache License, Version 2.0 (the "License");
+//you may not use this file except in compliance with the License.
+//You may obtain a copy of the License at
+//
+//    http://www.apache.org/licenses/LICENSE-2.0
+//
+//Unless required by applicable law or agreed to in writing, software
+//distributed under the License is distributed on an "AS IS" BASIS,
+//WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//See the License for the specific language governing permissions and
+//limitations under the License.
+
+// Contact :
+// Email             : solairelibrary@mail.com
+// GitHub repository : https://github.com/SolaireLibrary/SolaireCPP
+
+/*!
+	\file ConcurrentHashMapBenchmark.cpp
+	\brief Throughput benchmark for ConcurrentHashMap at 1 to 64 threads.
+	\detail
+	Each run performs a fixed number of operations split evenly between the threads, on keys drawn uniformly from a range
+	that starts half full. The read-mostly mix is 90% Find, 5% Insert and 5% Erase, the write-heavy mix is 50% Find, 25%
+	Insert and 25% Erase. The same runs are repeated on a HashMap behind a single mutex for comparison. Prints millions of
+	operations per second for each mix and thread count.
+	\author
+	Created			: Adam Smith
+	Last modified	: Adam Smith
+	\version 1.0
+	\date
+	Created			: 18th October 2026
+	Last Modified	: 18th October 2026
+*/
+
+#include <cstdio>
+#include <cstdlib>
+#include <atomic>
+#include <chrono>
+#include <mutex>
+#include <thread>
+#include <vector>
+#include "Solaire\Core\ConcurrentHashMap.hpp"
+#include "Solaire\Maths\Hash\Djb2.hpp"
+
+using namespace Solaire;
+
+namespace {
+
+	class MallocAllocator : public AllocatorI {
+	public:
+		uint32_t SOLAIRE_EXPORT_CALL GetAllocatedBytes() const throw() override {
+			return 0;
+		}
+
+		uint32_t SOLAIRE_EXPORT_CALL GetFreeBytes() const throw() override {
+			return UINT32_MAX;
+		}
+
+		uint32_t SOLAIRE_EXPORT_CALL SizeOf(const void* const) throw() override {
+			return 0;
+		}
+
+		void* SOLAIRE_EXPORT_CALL Allocate(const size_t aBytes) throw() override {
+			return std::malloc(aBytes);
+		}
+
+		bool SOLAIRE_EXPORT_CALL Deallocate(const void* const aObject) throw() override {
+			std::free(const_cast<void*>(aObject));
+			return true;
+		}
+
+		bool SOLAIRE_EXPORT_CALL DeallocateAll() throw() override {
+			return false;
+		}
+	};
+
+	enum : uint32_t {
+		KEY_RANGE = 1 << 16,
+		TOTAL_OPERATIONS = 1 << 22,
+		MAX_THREADS = 64
+	};
+
+	struct Mix {
+		const char* Name;
+		uint32_t FindPercent;
+		uint32_t InsertPercent;
+	};
+
+	const Mix MIXES[] = {
+		{"read-mostly", 90, 5},
+		{"write-heavy", 50, 25}
+	};
+
+	inline SOLAIRE_FORCE_INLINE uint32_t SOLAIRE_DEFAULT_CALL NextRandom(uint32_t& aSeed) throw() {
+		aSeed ^= aSeed << 13;
+		aSeed ^= aSeed >> 17;
+		aSeed ^= aSeed << 5;
+		return aSeed;
+	}
+
+	class ConcurrentTarget {
+	private:
+		ConcurrentHashMap<uint32_t, uint64_t> mMap;
+	public:
+		ConcurrentTarget(AllocatorI& aAllocator, const HashFunction<uint32_t>& aHash) :
+			mMap(aAllocator, aHash)
+		{}
+
+		SOLAIRE_FORCE_INLINE bool SOLAIRE_DEFAULT_CALL Find(const uint32_t aKey) {
+			uint64_t value;
+			return mMap.Find(aKey, value);
+		}
+
+		SOLAIRE_FORCE_INLINE void SOLAIRE_DEFAULT_CALL Insert(const uint32_t aKey) {
+			mMap.Insert(aKey, aKey);
+		}
+
+		SOLAIRE_FORCE_INLINE void SOLAIRE_DEFAULT_CALL Erase(const uint32_t aKey) {
+			mMap.Erase(aKey);
+		}
+	};
+
+	class LockedTarget {
+	private:
+		std::mutex mLock;
+		HashMap<uint32_t, uint64_t> mMap;
+	public:
+		LockedTarget(AllocatorI& aAllocator, const HashFunction<uint32_t>& aHash) :
+			mMap(aAllocator, aHash)
+		{}
+
+		SOLAIRE_FORCE_INLINE bool SOLAIRE_DEFAULT_CALL Find(const uint32_t aKey) {
+			std::lock_guard<std::mutex> lock(mLock);
+			return mMap.Find(aKey) != nullptr;
+		}
+
+		SOLAIRE_FORCE_INLINE void SOLAIRE_DEFAULT_CALL Insert(const uint32_t aKey) {
+			std::lock_guard<std::mutex> lock(mLock);
+			mMap.Insert(aKey, aKey);
+		}
+
+		SOLAIRE_FORCE_INLINE void SOLAIRE_DEFAULT_CALL Erase(const uint32_t aKey) {
+			std::lock_guard<std::mutex> lock(mLock);
+			mMap.Erase(aKey);
+		}
+	};
+
+	template<class TARGET>
+	double SOLAIRE_DEFAULT_CALL Run(AllocatorI& aAllocator, const HashFunction<uint32_t>& aHash, const Mix& aMix, const uint32_t aThreads) {
+		TARGET target(aAllocator, aHash);
+		for(uint32_t i = 0; i < KEY_RANGE; i += 2) target.Insert(i);
+
+		const uint32_t operations = TOTAL_OPERATIONS / aThreads;
+		std::atomic<bool> start(false);
+		std::atomic<uint32_t> found(0);
+		std::vector<std::thread> threads;
+		for(uint32_t i = 0; i < aThreads; ++i) {
+			threads.emplace_back([&, i]() {
+				uint32_t seed = (i + 1) * 0x9E3779B9;
+				uint32_t hits = 0;
+				while(! start.load(std::memory_order_acquire)) std::this_thread::yield();
+				for(uint32_t j = 0; j < operations; ++j) {
+					const uint32_t key = NextRandom(seed) % KEY_RANGE;
+					const uint32_t operation = NextRandom(seed) % 100;
+					if(operation < aMix.FindPercent) hits += target.Find(key) ? 1 : 0;
+					else if(operation < aMix.FindPercent + aMix.InsertPercent) target.Insert(key);
+					else target.Erase(key);
+				}
+				found += hits;
+			});
+		}
+
+		const auto begin = std::chrono::steady_clock::now();
+		start.store(true, std::memory_order_release);
+		for(std::thread& thread : threads) thread.join();
+		const auto end = std::chrono::steady_clock::now();
+
+		const double seconds = std::chrono::duration<double>(end - begin).count();
+		return static_cast<double>(operations * aThreads) / seconds / 1000000.0;
+	}
+}
+
+int main() {
+	MallocAllocator allocator;
+	Djb2 hash;
+
+	std::printf("%-12s %8s %16s %16s\n", "mix", "threads", "sharded Mops/s", "mutex Mops/s");
+	for(const Mix& mix : MIXES) {
+		for(uint32_t threads = 1; threads <= MAX_THREADS; threads *= 2) {
+			const double sharded = Run<ConcurrentTarget>(allocator, hash, mix, threads);
+			const double locked = Run<LockedTarget>(allocator, hash, mix, threads);
+			std::printf("%-12s %8u %16.2f %16.2f\n", mix.Name, threads, sharded, locked);
+		}
+	}
+	return EXIT_SUCCESS;
+}
@@ -0,0 +1,180 @@
+//Copyright 2015 Adam Smith
+//
+//Licensed under the Apache License, Version 2.0 (the "License");
+//you may not use this file except in compliance with the License.
+//You may obtain a copy of the License at
+//
+//    http://www.apache.org/licenses/LICENSE-2.0
+//
+//Unless required by applicable law or agreed to in writing, software
+//distributed under the License is distributed on an "AS IS" BASIS,
+//WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//See the License for the specific language governing permissions and
+//limitations under the License.
+
+// Contact :
+// Email             : solairelibrary@mail.com
+// GitHub repository : https://github.com/SolaireLibrary/SolaireCPP
+
+/*!
+	\file IntrusiveList.cpp
+	\brief Regression test for moving the objects of an IntrusiveList or LinkedList to either end.
+	\detail
+	Moving the front object to the front used to splice a hook before itself, which left the list pointing at a cycle.
+	Every move is checked by walking the list in both directions, then the list is cleared. Returns 0 on success.
+	\author
+	Created			: Adam Smith
+	Last modified	: Adam Smith
+	\version 1.0
+	\date
+	Created			: 18th October 2026
+	Last Modified	: 18th October 2026
+*/
+
+#include <cstdio>
+#include <cstdlib>
+#include "Solaire\Core\IntrusiveList.hpp"
+#include "Solaire\Core\LinkedList.hpp"
+
+using namespace Solaire;
+
+namespace {
+
+	class MallocAllocator : public Allocator {
+	private:
+		uint32_t mAllocations;
+	public:
+		MallocAllocator() :
+			mAllocations(0)
+		{}
+
+		uint32_t SOLAIRE_EXPORT_CALL GetAllocatedBytes() const throw() override {
+			return 0;
+		}
+
+		uint32_t SOLAIRE_EXPORT_CALL GetFreeBytes() const throw() override {
+			return UINT32_MAX;
+		}
+
+		uint32_t SOLAIRE_EXPORT_CALL SizeOf(const void* const) throw() override {
+			return 0;
+		}
+
+		void* SOLAIRE_EXPORT_CALL Allocate(const size_t aBytes) throw() override {
+			++mAllocations;
+			return std::malloc(aBytes);
+		}
+
+		bool SOLAIRE_EXPORT_CALL Deallocate(const void* const aObject) throw() override {
+			--mAllocations;
+			std::free(const_cast<void*>(aObject));
+			return true;
+		}
+
+		bool SOLAIRE_EXPORT_CALL DeallocateAll() throw() override {
+			return false;
+		}
+
+		uint32_t SOLAIRE_DEFAULT_CALL GetAllocationCount() const throw() {
+			return mAllocations;
+		}
+	};
+
+	struct Item : public IntrusiveListHook<> {
+		int Value;
+	};
+
+	enum : uint32_t {
+		ITEMS = 4
+	};
+
+	bool gPassed = true;
+
+	void SOLAIRE_DEFAULT_CALL Check(const bool aCondition, const char* const aMessage) {
+		if(aCondition) return;
+		std::fprintf(stderr, "IntrusiveList : %s\n", aMessage);
+		gPassed = false;
+	}
+
+	// Walks the list from both ends, so a broken link in either direction is caught without looping forever
+	void SOLAIRE_DEFAULT_CALL CheckOrder(const IntrusiveList<Item>& aList, const int* const aValues, const uint32_t aCount, const char* const aMessage) {
+		bool result = aList.Size() == aCount;
+
+		Item* item = aList.Front();
+		for(uint32_t i = 0; i < aCount && result; ++i) {
+			result = item != nullptr && item->Value == aValues[i];
+			if(result) item = aList.GetNext(*item);
+		}
+		result = result && item == nullptr;
+
+		item = aList.Back();
+		for(uint32_t i = aCount; i > 0 && result; --i) {
+			result = item != nullptr && item->Value == aValues[i - 1];
+			if(result) item = aList.GetPrevious(*item);
+		}
+		result = result && item == nullptr;
+
+		Check(result, aMessage);
+	}
+
+	void SOLAIRE_DEFAULT_CALL TestIntrusiveList() {
+		Item items[ITEMS];
+		IntrusiveList<Item> list;
+		for(uint32_t i = 0; i < ITEMS; ++i) {
+			items[i].Value = static_cast<int>(i);
+			list.PushBack(items[i]);
+		}
+
+		const int unchanged[ITEMS] = {0, 1, 2, 3};
+		list.MoveToFront(*list.Front());
+		CheckOrder(list, unchanged, ITEMS, "MoveToFront of the front object changed the list");
+		list.MoveToBack(*list.Back());
+		CheckOrder(list, unchanged, ITEMS, "MoveToBack of the back object changed the list");
+
+		const int backToFront[ITEMS] = {3, 0, 1, 2};
+		list.MoveToFront(*list.Back());
+		CheckOrder(list, backToFront, ITEMS, "MoveToFront of the back object");
+
+		list.MoveToBack(*list.Front());
+		CheckOrder(list, unchanged, ITEMS, "MoveToBack of the front object");
+
+		list.Clear();
+		Check(list.IsEmpty(), "Clear after moving objects");
+
+		// With a single object it is both the front and the back
+		list.PushBack(items[0]);
+		list.MoveToFront(items[0]);
+		list.MoveToBack(items[0]);
+		CheckOrder(list, unchanged, 1, "moving the only object");
+		list.Clear();
+	}
+
+	void SOLAIRE_DEFAULT_CALL TestLinkedList() {
+		MallocAllocator allocator;
+		{
+			LinkedList<int> list(allocator);
+			for(uint32_t i = 0; i < ITEMS; ++i) list.PushBack(static_cast<int>(i));
+
+			list.MoveToFront(*list.GetFirstNode());
+			list.MoveToBack(*list.GetLastNode());
+			bool result = list.Size() == ITEMS;
+			for(uint32_t i = 0; i < ITEMS && result; ++i) result = list[i] == static_cast<int>(i);
+			Check(result, "LinkedList moving the first and last nodes changed the list");
+
+			list.MoveToFront(*list.GetLastNode());
+			Check(list[0] == 3 && list[1] == 0 && list[3] == 2, "LinkedList MoveToFront of the last node");
+
+			list.Clear();
+			Check(list.Size() == 0 && list.GetFirstNode() == nullptr, "LinkedList Clear after moving nodes");
+		}
+		Check(allocator.GetAllocationCount() == 0, "LinkedList nodes were not deallocated");
+	}
+}
+
+int main() {
+	TestIntrusiveList();
+	TestLinkedList();
+
+	std::printf("IntrusiveList : %s\n", gPassed ? "passed" : "failed");
+	return gPassed ? EXIT_SUCCESS : EXIT_FAILURE;
+}
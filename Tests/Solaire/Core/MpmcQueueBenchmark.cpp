@@ -0,0 +1,224 @@
+//Copyright 2015 Adam Smith
+//
+//Licensed under the Apache License, Version 2.0 (the "License");
+//you may not use this file except in compliance with the License.
+//You may obtain a copy of the License at
+//
+//    http://www.apache.org/licenses/LICENSE-2.0
+//
+//Unless required by applicable law or agreed to in writing, software
+//distributed under the License is distributed on an "AS IS" BASIS,
+//WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//See the License for the specific language governing permissions and
+//limitations under the License.
+
+// Contact :
+// Email             : solairelibrary@mail.com
+// GitHub repository : https://github.com/SolaireLibrary/SolaireCPP
+
+/*!
+	\file MpmcQueueBenchmark.cpp
+	\brief Contention benchmark for MpmcQueue at 2 to 64 threads.
+	\detail
+	Half of the threads are producers and half are consumers. Each run passes a fixed number of elements through the queue
+	with the waiting Push and Pop, so both the lock-free path and the sleep and wake path are measured as contention grows.
+	The same runs are repeated on a std::deque behind a mutex and a pair of condition variables for comparison. Prints
+	millions of elements per second for each thread count and capacity.
+	Every element holds its producer and sequence number. Each consumer checks that the elements of every producer arrive
+	in order, and the sum of all elements popped must match the sum pushed. Returns 0 on success.
+	\author
+	Created			: Adam Smith
+	Last modified	: Adam Smith
+	\version 1.0
+	\date
+	Created			: 18th October 2026
+	Last Modified	: 18th October 2026
+*/
+
+#include <cstdio>
+#include <cstdlib>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <thread>
+#include <vector>
+#include "Solaire\Core\MpmcQueue.hpp"
+
+using namespace Solaire;
+
+namespace {
+
+	class MallocAllocator : public AllocatorI {
+	public:
+		uint32_t SOLAIRE_EXPORT_CALL GetAllocatedBytes() const throw() override {
+			return 0;
+		}
+
+		uint32_t SOLAIRE_EXPORT_CALL GetFreeBytes() const throw() override {
+			return UINT32_MAX;
+		}
+
+		uint32_t SOLAIRE_EXPORT_CALL SizeOf(const void* const) throw() override {
+			return 0;
+		}
+
+		void* SOLAIRE_EXPORT_CALL Allocate(const size_t aBytes) throw() override {
+			return std::malloc(aBytes);
+		}
+
+		bool SOLAIRE_EXPORT_CALL Deallocate(const void* const aObject) throw() override {
+			std::free(const_cast<void*>(aObject));
+			return true;
+		}
+
+		bool SOLAIRE_EXPORT_CALL DeallocateAll() throw() override {
+			return false;
+		}
+	};
+
+	enum : uint32_t {
+		TOTAL_ELEMENTS = 1 << 20,
+		MIN_THREADS = 2,
+		MAX_THREADS = 64
+	};
+
+	const uint32_t CAPACITIES[] = {64, 4096};
+
+	std::atomic<bool> gPassed(true);
+
+	void SOLAIRE_DEFAULT_CALL Fail(const char* const aMessage, const uint32_t aThreads) {
+		if(gPassed.exchange(false)) std::fprintf(stderr, "MpmcQueue : %s (%u threads)\n", aMessage, aThreads);
+	}
+
+	inline SOLAIRE_FORCE_INLINE uint64_t SOLAIRE_DEFAULT_CALL Encode(const uint32_t aProducer, const uint32_t aSequence) throw() {
+		return (static_cast<uint64_t>(aProducer) << 32) | aSequence;
+	}
+
+	class LockFreeTarget {
+	private:
+		MpmcQueue<uint64_t> mQueue;
+	public:
+		LockFreeTarget(AllocatorI& aAllocator, const uint32_t aCapacity) :
+			mQueue(aAllocator, aCapacity)
+		{}
+
+		SOLAIRE_FORCE_INLINE void SOLAIRE_DEFAULT_CALL Push(const uint64_t aValue) {
+			mQueue.Push(aValue);
+		}
+
+		SOLAIRE_FORCE_INLINE void SOLAIRE_DEFAULT_CALL Pop(uint64_t& aValue) {
+			mQueue.Pop(aValue);
+		}
+	};
+
+	class LockedTarget {
+	private:
+		std::mutex mLock;
+		std::condition_variable mNotFull;
+		std::condition_variable mNotEmpty;
+		std::deque<uint64_t> mQueue;
+		const uint32_t mCapacity;
+	public:
+		LockedTarget(AllocatorI&, const uint32_t aCapacity) :
+			mCapacity(aCapacity)
+		{}
+
+		SOLAIRE_FORCE_INLINE void SOLAIRE_DEFAULT_CALL Push(const uint64_t aValue) {
+			{
+				std::unique_lock<std::mutex> lock(mLock);
+				mNotFull.wait(lock, [this]()->bool {
+					return mQueue.size() < mCapacity;
+				});
+				mQueue.push_back(aValue);
+			}
+			mNotEmpty.notify_one();
+		}
+
+		SOLAIRE_FORCE_INLINE void SOLAIRE_DEFAULT_CALL Pop(uint64_t& aValue) {
+			{
+				std::unique_lock<std::mutex> lock(mLock);
+				mNotEmpty.wait(lock, [this]()->bool {
+					return ! mQueue.empty();
+				});
+				aValue = mQueue.front();
+				mQueue.pop_front();
+			}
+			mNotFull.notify_one();
+		}
+	};
+
+	template<class TARGET>
+	double SOLAIRE_DEFAULT_CALL Run(AllocatorI& aAllocator, const uint32_t aCapacity, const uint32_t aThreads) {
+		TARGET target(aAllocator, aCapacity);
+		const uint32_t producers = aThreads / 2;
+		const uint32_t consumers = aThreads - producers;
+		const uint32_t perProducer = TOTAL_ELEMENTS / producers;
+		const uint32_t total = perProducer * producers;
+
+		std::atomic<bool> start(false);
+		std::atomic<uint32_t> remaining(total);
+		std::atomic<uint64_t> popped(0);
+		std::vector<std::thread> threads;
+
+		for(uint32_t i = 0; i < producers; ++i) {
+			threads.emplace_back([&, i]() {
+				while(! start.load(std::memory_order_acquire)) std::this_thread::yield();
+				for(uint32_t j = 0; j < perProducer; ++j) target.Push(Encode(i, j));
+			});
+		}
+
+		for(uint32_t i = 0; i < consumers; ++i) {
+			threads.emplace_back([&]() {
+				// The next sequence number this consumer may see from each producer
+				std::vector<uint32_t> next(producers, 0);
+				uint64_t sum = 0;
+				while(! start.load(std::memory_order_acquire)) std::this_thread::yield();
+
+				// Claim an element before popping it, so that every Pop has an element to wait for
+				uint32_t count = remaining.load(std::memory_order_relaxed);
+				while(count > 0) {
+					if(! remaining.compare_exchange_weak(count, count - 1, std::memory_order_relaxed)) continue;
+					uint64_t value;
+					target.Pop(value);
+					const uint32_t producer = static_cast<uint32_t>(value >> 32);
+					const uint32_t sequence = static_cast<uint32_t>(value);
+					if(producer >= producers || sequence < next[producer]) Fail("elements of a producer arrived out of order", aThreads);
+					else next[producer] = sequence + 1;
+					sum += value;
+					count = remaining.load(std::memory_order_relaxed);
+				}
+				popped += sum;
+			});
+		}
+
+		const auto begin = std::chrono::steady_clock::now();
+		start.store(true, std::memory_order_release);
+		for(std::thread& thread : threads) thread.join();
+		const auto end = std::chrono::steady_clock::now();
+
+		uint64_t expected = 0;
+		for(uint32_t i = 0; i < producers; ++i) for(uint32_t j = 0; j < perProducer; ++j) expected += Encode(i, j);
+		if(popped != expected) Fail("the elements popped are not the elements pushed", aThreads);
+
+		const double seconds = std::chrono::duration<double>(end - begin).count();
+		return static_cast<double>(total) / seconds / 1000000.0;
+	}
+}
+
+int main() {
+	MallocAllocator allocator;
+
+	std::printf("%-12s %8s %16s %16s\n", "capacity", "threads", "lock-free Mops/s", "mutex Mops/s");
+	for(const uint32_t capacity : CAPACITIES) {
+		for(uint32_t threads = MIN_THREADS; threads <= MAX_THREADS; threads *= 2) {
+			const double lockFree = Run<LockFreeTarget>(allocator, capacity, threads);
+			const double locked = Run<LockedTarget>(allocator, capacity, threads);
+			std::printf("%-12u %8u %16.2f %16.2f\n", capacity, threads, lockFree, locked);
+		}
+	}
+
+	std::printf("MpmcQueue : %s\n", gPassed ? "passed" : "failed");
+	return gPassed ? EXIT_SUCCESS : EXIT_FAILURE;
+}
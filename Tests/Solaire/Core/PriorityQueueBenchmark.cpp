@@ -0,0 +1,353 @@
+//Copyright 2015 Adam Smith
+//
+//Licensed under the Apache License, Version 2.0 (the "License");
+//you may not use this file except in compliance with the License.
+//You may obtain a copy of the License at
+//
+//    http://www.apache.org/licenses/LICENSE-2.0
+//
+//Unless required by applicable law or agreed to in writing, software
+//distributed under the License is distributed on an "AS IS" BASIS,
+//WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//See the License for the specific language governing permissions and
+//limitations under the License.
+
+// Contact :
+// Email             : solairelibrary@mail.com
+// GitHub repository : https://github.com/SolaireLibrary/SolaireCPP
+
+/*!
+	\file PriorityQueueBenchmark.cpp
+	\brief Benchmark comparing DaryHeap and PairingHeap with std::priority_queue.
+	\detail
+	Three workloads are run at several heap sizes, each printed in nanoseconds per operation :
+	push pop : push every element, then pop them all.
+	hold : starting from a full heap, repeatedly pop the top element and push it back with a larger priority, which keeps
+	the size constant as in an event queue.
+	decrease key : push every element, decrease the priority of random elements, then pop them all. IndexedDaryHeap and
+	PairingHeap change the priority in place, std::priority_queue pushes a duplicate and skips the stale entry when it is
+	popped, as a Dijkstra search would.
+	Every heap must pop its elements in order. Returns 0 on success.
+	\author
+	Created			: Adam Smith
+	Last modified	: Adam Smith
+	\version 1.0
+	\date
+	Created			: 18th October 2026
+	Last Modified	: 18th October 2026
+*/
+
+#include <cstdio>
+#include <cstdlib>
+#include <chrono>
+#include <functional>
+#include <queue>
+#include <utility>
+#include <vector>
+#include "Solaire\Core\PriorityQueue.hpp"
+
+using namespace Solaire;
+
+namespace {
+
+	class MallocAllocator : public Allocator {
+	public:
+		uint32_t SOLAIRE_EXPORT_CALL GetAllocatedBytes() const throw() override {
+			return 0;
+		}
+
+		uint32_t SOLAIRE_EXPORT_CALL GetFreeBytes() const throw() override {
+			return UINT32_MAX;
+		}
+
+		uint32_t SOLAIRE_EXPORT_CALL SizeOf(const void* const) throw() override {
+			return 0;
+		}
+
+		void* SOLAIRE_EXPORT_CALL Allocate(const size_t aBytes) throw() override {
+			return std::malloc(aBytes);
+		}
+
+		bool SOLAIRE_EXPORT_CALL Deallocate(const void* const aObject) throw() override {
+			std::free(const_cast<void*>(aObject));
+			return true;
+		}
+
+		bool SOLAIRE_EXPORT_CALL DeallocateAll() throw() override {
+			return false;
+		}
+	};
+
+	const uint32_t SIZES[] = {1000, 100000, 1000000};
+
+	enum : uint32_t {
+		HOLD_OPERATIONS = 1 << 21,
+		DECREASES_PER_ELEMENT = 4
+	};
+
+	bool gPassed = true;
+
+	void SOLAIRE_DEFAULT_CALL Check(const bool aCondition, const char* const aHeap, const char* const aWorkload, const uint32_t aSize) {
+		if(aCondition) return;
+		std::fprintf(stderr, "PriorityQueue : %s did not pop every element in order in %s at size %u\n", aHeap, aWorkload, aSize);
+		gPassed = false;
+	}
+
+	inline SOLAIRE_FORCE_INLINE uint32_t SOLAIRE_DEFAULT_CALL NextRandom(uint32_t& aSeed) throw() {
+		aSeed ^= aSeed << 13;
+		aSeed ^= aSeed >> 17;
+		aSeed ^= aSeed << 5;
+		return aSeed;
+	}
+
+	// Targets for push pop and hold, each is a min heap of uint32_t
+
+	class StdTarget {
+	private:
+		std::priority_queue<uint32_t, std::vector<uint32_t>, std::greater<uint32_t>> mHeap;
+	public:
+		StdTarget(Allocator&) {}
+
+		SOLAIRE_FORCE_INLINE void SOLAIRE_DEFAULT_CALL Push(const uint32_t aValue) {
+			mHeap.push(aValue);
+		}
+
+		SOLAIRE_FORCE_INLINE uint32_t SOLAIRE_DEFAULT_CALL Pop() {
+			const uint32_t value = mHeap.top();
+			mHeap.pop();
+			return value;
+		}
+	};
+
+	template<uint32_t ARITY>
+	class DaryTarget {
+	private:
+		DaryHeap<uint32_t, ARITY> mHeap;
+	public:
+		DaryTarget(Allocator& aAllocator) :
+			mHeap(aAllocator)
+		{}
+
+		SOLAIRE_FORCE_INLINE void SOLAIRE_DEFAULT_CALL Push(const uint32_t aValue) {
+			mHeap.Push(aValue);
+		}
+
+		SOLAIRE_FORCE_INLINE uint32_t SOLAIRE_DEFAULT_CALL Pop() {
+			return mHeap.Pop();
+		}
+	};
+
+	class PairingTarget {
+	private:
+		PairingHeap<uint32_t> mHeap;
+	public:
+		PairingTarget(Allocator& aAllocator) :
+			mHeap(aAllocator)
+		{}
+
+		SOLAIRE_FORCE_INLINE void SOLAIRE_DEFAULT_CALL Push(const uint32_t aValue) {
+			mHeap.Push(aValue);
+		}
+
+		SOLAIRE_FORCE_INLINE uint32_t SOLAIRE_DEFAULT_CALL Pop() {
+			return mHeap.Pop();
+		}
+	};
+
+	// Targets for decrease key, element i has the priority aKeys[i]
+
+	class LazyTarget {
+	private:
+		typedef std::pair<uint32_t, uint32_t> Entry;
+		std::priority_queue<Entry, std::vector<Entry>, std::greater<Entry>> mHeap;
+		const std::vector<uint32_t>& mKeys;
+	public:
+		LazyTarget(Allocator&, const std::vector<uint32_t>& aKeys) :
+			mKeys(aKeys)
+		{}
+
+		SOLAIRE_FORCE_INLINE void SOLAIRE_DEFAULT_CALL Push(const uint32_t aElement) {
+			mHeap.push(Entry(mKeys[aElement], aElement));
+		}
+
+		SOLAIRE_FORCE_INLINE void SOLAIRE_DEFAULT_CALL DecreaseKey(const uint32_t aElement) {
+			mHeap.push(Entry(mKeys[aElement], aElement));
+		}
+
+		// Returns false once every element has been popped
+		SOLAIRE_FORCE_INLINE bool SOLAIRE_DEFAULT_CALL Pop(uint32_t& aKey) {
+			while(! mHeap.empty()) {
+				const Entry entry = mHeap.top();
+				mHeap.pop();
+				if(entry.first == mKeys[entry.second]) {
+					aKey = entry.first;
+					return true;
+				}
+			}
+			return false;
+		}
+	};
+
+	class IndexedTarget {
+	private:
+		IndexedDaryHeap<uint32_t> mHeap;
+		std::vector<IndexedDaryHeap<uint32_t>::Handle> mHandles;
+		const std::vector<uint32_t>& mKeys;
+	public:
+		IndexedTarget(Allocator& aAllocator, const std::vector<uint32_t>& aKeys) :
+			mHeap(aAllocator),
+			mHandles(aKeys.size()),
+			mKeys(aKeys)
+		{}
+
+		SOLAIRE_FORCE_INLINE void SOLAIRE_DEFAULT_CALL Push(const uint32_t aElement) {
+			mHandles[aElement] = mHeap.Push(mKeys[aElement]);
+		}
+
+		SOLAIRE_FORCE_INLINE void SOLAIRE_DEFAULT_CALL DecreaseKey(const uint32_t aElement) {
+			mHeap.DecreaseKey(mHandles[aElement], mKeys[aElement]);
+		}
+
+		SOLAIRE_FORCE_INLINE bool SOLAIRE_DEFAULT_CALL Pop(uint32_t& aKey) {
+			if(mHeap.IsEmpty()) return false;
+			aKey = mHeap.Pop();
+			return true;
+		}
+	};
+
+	class PairingDecreaseTarget {
+	private:
+		PairingHeap<uint32_t> mHeap;
+		std::vector<PairingHeap<uint32_t>::Handle> mHandles;
+		const std::vector<uint32_t>& mKeys;
+	public:
+		PairingDecreaseTarget(Allocator& aAllocator, const std::vector<uint32_t>& aKeys) :
+			mHeap(aAllocator),
+			mHandles(aKeys.size()),
+			mKeys(aKeys)
+		{}
+
+		SOLAIRE_FORCE_INLINE void SOLAIRE_DEFAULT_CALL Push(const uint32_t aElement) {
+			mHandles[aElement] = mHeap.Push(mKeys[aElement]);
+		}
+
+		SOLAIRE_FORCE_INLINE void SOLAIRE_DEFAULT_CALL DecreaseKey(const uint32_t aElement) {
+			mHeap.DecreaseKey(mHandles[aElement], mKeys[aElement]);
+		}
+
+		SOLAIRE_FORCE_INLINE bool SOLAIRE_DEFAULT_CALL Pop(uint32_t& aKey) {
+			if(mHeap.IsEmpty()) return false;
+			aKey = mHeap.Pop();
+			return true;
+		}
+	};
+
+	template<class TARGET>
+	double SOLAIRE_DEFAULT_CALL RunPushPop(Allocator& aAllocator, const char* const aHeap, const uint32_t aSize) {
+		TARGET target(aAllocator);
+		uint32_t seed = 0x9E3779B9;
+
+		const auto begin = std::chrono::steady_clock::now();
+		for(uint32_t i = 0; i < aSize; ++i) target.Push(NextRandom(seed));
+		bool ordered = true;
+		uint32_t previous = 0;
+		for(uint32_t i = 0; i < aSize; ++i) {
+			const uint32_t value = target.Pop();
+			ordered = ordered && value >= previous;
+			previous = value;
+		}
+		const auto end = std::chrono::steady_clock::now();
+
+		Check(ordered, aHeap, "push pop", aSize);
+		return std::chrono::duration<double, std::nano>(end - begin).count() / (aSize * 2.0);
+	}
+
+	template<class TARGET>
+	double SOLAIRE_DEFAULT_CALL RunHold(Allocator& aAllocator, const char* const aHeap, const uint32_t aSize) {
+		TARGET target(aAllocator);
+		uint32_t seed = 0x9E3779B9;
+		for(uint32_t i = 0; i < aSize; ++i) target.Push(NextRandom(seed) >> 8);
+
+		// Priorities only increase, so every pop must be at least the previous one
+		const auto begin = std::chrono::steady_clock::now();
+		bool ordered = true;
+		uint32_t previous = 0;
+		for(uint32_t i = 0; i < HOLD_OPERATIONS; ++i) {
+			const uint32_t value = target.Pop();
+			ordered = ordered && value >= previous;
+			previous = value;
+			target.Push(value + (NextRandom(seed) & 1023));
+		}
+		const auto end = std::chrono::steady_clock::now();
+
+		Check(ordered, aHeap, "hold", aSize);
+		return std::chrono::duration<double, std::nano>(end - begin).count() / (HOLD_OPERATIONS * 2.0);
+	}
+
+	template<class TARGET>
+	double SOLAIRE_DEFAULT_CALL RunDecreaseKey(Allocator& aAllocator, const char* const aHeap, const uint32_t aSize) {
+		std::vector<uint32_t> keys(aSize);
+		uint32_t seed = 0x9E3779B9;
+		for(uint32_t i = 0; i < aSize; ++i) keys[i] = NextRandom(seed) | 0x80000000;
+		TARGET target(aAllocator, keys);
+		const uint32_t decreases = aSize * DECREASES_PER_ELEMENT;
+
+		const auto begin = std::chrono::steady_clock::now();
+		for(uint32_t i = 0; i < aSize; ++i) target.Push(i);
+		for(uint32_t i = 0; i < decreases; ++i) {
+			const uint32_t element = NextRandom(seed) % aSize;
+			// Always decrease, so that an element never has two entries in the lazy queue with its current priority
+			keys[element] -= (NextRandom(seed) & 0xFFFF) + 1;
+			target.DecreaseKey(element);
+		}
+		bool ordered = true;
+		uint32_t popped = 0;
+		uint32_t previous = 0;
+		uint32_t key;
+		while(target.Pop(key)) {
+			ordered = ordered && key >= previous;
+			previous = key;
+			++popped;
+		}
+		const auto end = std::chrono::steady_clock::now();
+
+		Check(ordered && popped == aSize, aHeap, "decrease key", aSize);
+		return std::chrono::duration<double, std::nano>(end - begin).count() / (aSize * 2.0 + decreases);
+	}
+}
+
+int main() {
+	MallocAllocator allocator;
+
+	std::printf("nanoseconds per operation\n");
+	std::printf("%-12s %10s %12s %12s %12s %12s %12s\n", "push pop", "size", "std", "Dary<2>", "Dary<4>", "Dary<8>", "Pairing");
+	for(const uint32_t size : SIZES) {
+		const double standard = RunPushPop<StdTarget>(allocator, "std::priority_queue", size);
+		const double binary = RunPushPop<DaryTarget<2>>(allocator, "DaryHeap<2>", size);
+		const double quaternary = RunPushPop<DaryTarget<4>>(allocator, "DaryHeap<4>", size);
+		const double octonary = RunPushPop<DaryTarget<8>>(allocator, "DaryHeap<8>", size);
+		const double pairing = RunPushPop<PairingTarget>(allocator, "PairingHeap", size);
+		std::printf("%-12s %10u %12.1f %12.1f %12.1f %12.1f %12.1f\n", "", size, standard, binary, quaternary, octonary, pairing);
+	}
+
+	std::printf("%-12s %10s %12s %12s %12s %12s %12s\n", "hold", "size", "std", "Dary<2>", "Dary<4>", "Dary<8>", "Pairing");
+	for(const uint32_t size : SIZES) {
+		const double standard = RunHold<StdTarget>(allocator, "std::priority_queue", size);
+		const double binary = RunHold<DaryTarget<2>>(allocator, "DaryHeap<2>", size);
+		const double quaternary = RunHold<DaryTarget<4>>(allocator, "DaryHeap<4>", size);
+		const double octonary = RunHold<DaryTarget<8>>(allocator, "DaryHeap<8>", size);
+		const double pairing = RunHold<PairingTarget>(allocator, "PairingHeap", size);
+		std::printf("%-12s %10u %12.1f %12.1f %12.1f %12.1f %12.1f\n", "", size, standard, binary, quaternary, octonary, pairing);
+	}
+
+	std::printf("%-12s %10s %12s %12s %12s\n", "decrease key", "size", "std lazy", "Indexed<4>", "Pairing");
+	for(const uint32_t size : SIZES) {
+		const double lazy = RunDecreaseKey<LazyTarget>(allocator, "std::priority_queue", size);
+		const double indexed = RunDecreaseKey<IndexedTarget>(allocator, "IndexedDaryHeap<4>", size);
+		const double pairing = RunDecreaseKey<PairingDecreaseTarget>(allocator, "PairingHeap", size);
+		std::printf("%-12s %10u %12.1f %12.1f %12.1f\n", "", size, lazy, indexed, pairing);
+	}
+
+	std::printf("PriorityQueue : %s\n", gPassed ? "passed" : "failed");
+	return gPassed ? EXIT_SUCCESS : EXIT_FAILURE;
+}
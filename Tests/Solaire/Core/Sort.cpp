@@ -0,0 +1,336 @@
+//Copyright 2015 Adam Smith
+//
+//Licensed under the Apache License, Version 2.0 (the "License");
+//you may not use this file except in compliance with the License.
+//You may obtain a copy of the License at
+//
+//    http://www.apache.org/licenses/LICENSE-2.0
+//
+//Unless required by applicable law or agreed to in writing, software
+//distributed under the License is distributed on an "AS IS" BASIS,
+//WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//See the License for the specific language governing permissions and
+//limitations under the License.
+
+// Contact :
+// Email             : solairelibrary@mail.com
+// GitHub repository : https://github.com/SolaireLibrary/SolaireCPP
+
+/*!
+	\file Sort.cpp
+	\brief Correctness test for Sort, RadixSort and ParallelSort.
+	\detail
+	Every sort is run on random, sorted, reversed, sawtooth, organ pipe, few unique and all equal inputs at sizes on both
+	sides of the insertion sort, radix sort and parallel sort thresholds, and the result must match std::sort. RadixSort is
+	also run on signed integers and on floating point keys that include negative values, both zeros and infinities, and
+	must keep equal keys in their original order. The container overloads are run on a DynamicArray. Returns 0 on
+	success.
+	\author
+	Created			: Adam Smith
+	Last modified	: Adam Smith
+	\version 1.0
+	\date
+	Created			: 18th October 2026
+	Last Modified	: 18th October 2026
+*/
+
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <algorithm>
+#include <atomic>
+#include <functional>
+#include <limits>
+#include <vector>
+#include "Solaire\Core\Sort.hpp"
+#include "Solaire\Core\TaskScheduler.hpp"
+
+using namespace Solaire;
+
+namespace {
+
+	class MallocAllocator : public Allocator {
+	private:
+		std::atomic<uint32_t> mAllocations;
+	public:
+		MallocAllocator() :
+			mAllocations(0)
+		{}
+
+		uint32_t SOLAIRE_EXPORT_CALL GetAllocatedBytes() const throw() override {
+			return 0;
+		}
+
+		uint32_t SOLAIRE_EXPORT_CALL GetFreeBytes() const throw() override {
+			return UINT32_MAX;
+		}
+
+		uint32_t SOLAIRE_EXPORT_CALL SizeOf(const void* const) throw() override {
+			return 0;
+		}
+
+		void* SOLAIRE_EXPORT_CALL Allocate(const size_t aBytes) throw() override {
+			++mAllocations;
+			return std::malloc(aBytes);
+		}
+
+		bool SOLAIRE_EXPORT_CALL Deallocate(const void* const aObject) throw() override {
+			--mAllocations;
+			std::free(const_cast<void*>(aObject));
+			return true;
+		}
+
+		bool SOLAIRE_EXPORT_CALL DeallocateAll() throw() override {
+			return false;
+		}
+
+		uint32_t SOLAIRE_DEFAULT_CALL GetAllocationCount() const throw() {
+			return mAllocations;
+		}
+	};
+
+	enum Pattern : uint32_t {
+		PATTERN_RANDOM,
+		PATTERN_SORTED,
+		PATTERN_REVERSED,
+		PATTERN_SAWTOOTH,
+		PATTERN_ORGAN_PIPE,
+		PATTERN_FEW_UNIQUE,
+		PATTERN_EQUAL,
+		PATTERN_COUNT
+	};
+
+	const char* const PATTERN_NAMES[PATTERN_COUNT] = {
+		"random", "sorted", "reversed", "sawtooth", "organ pipe", "few unique", "equal"
+	};
+
+	const uint32_t SIZES[] = {0, 1, 2, 3, 23, 24, 25, 63, 64, 65, 129, 1000, 4095, 4096, 4097, 100003};
+
+	enum : uint32_t {
+		THREADS = 4
+	};
+
+	bool gPassed = true;
+
+	void SOLAIRE_DEFAULT_CALL Check(const bool aCondition, const char* const aSort, const char* const aType, const Pattern aPattern, const uint32_t aSize) {
+		if(aCondition) return;
+		std::fprintf(stderr, "Sort : %s of %s failed on %s input of size %u\n", aSort, aType, PATTERN_NAMES[aPattern], aSize);
+		gPassed = false;
+	}
+
+	inline SOLAIRE_FORCE_INLINE uint32_t SOLAIRE_DEFAULT_CALL NextRandom(uint32_t& aSeed) throw() {
+		aSeed ^= aSeed << 13;
+		aSeed ^= aSeed >> 17;
+		aSeed ^= aSeed << 5;
+		return aSeed;
+	}
+
+	std::vector<uint32_t> SOLAIRE_DEFAULT_CALL Generate(const Pattern aPattern, const uint32_t aSize) {
+		std::vector<uint32_t> values(aSize);
+		uint32_t seed = 0x9E3779B9 ^ aSize;
+		for(uint32_t i = 0; i < aSize; ++i) {
+			switch(aPattern) {
+			case PATTERN_RANDOM:
+				values[i] = NextRandom(seed);
+				break;
+			case PATTERN_SORTED:
+				values[i] = i;
+				break;
+			case PATTERN_REVERSED:
+				values[i] = aSize - i;
+				break;
+			case PATTERN_SAWTOOTH:
+				values[i] = i % 37;
+				break;
+			case PATTERN_ORGAN_PIPE:
+				values[i] = i < aSize / 2 ? i : aSize - i;
+				break;
+			case PATTERN_FEW_UNIQUE:
+				values[i] = NextRandom(seed) % 4;
+				break;
+			default:
+				values[i] = 7;
+				break;
+			}
+		}
+		return values;
+	}
+
+	// Maps the generated values onto each type, so that signed and floating point keys include negative values
+	struct Convert {
+		static uint32_t SOLAIRE_DEFAULT_CALL To(const uint32_t aValue, uint32_t*) {
+			return aValue;
+		}
+
+		static int32_t SOLAIRE_DEFAULT_CALL To(const uint32_t aValue, int32_t*) {
+			return static_cast<int32_t>(aValue);
+		}
+
+		static uint64_t SOLAIRE_DEFAULT_CALL To(const uint32_t aValue, uint64_t*) {
+			return (static_cast<uint64_t>(aValue) << 32) | (aValue ^ 0x5555);
+		}
+
+		static float SOLAIRE_DEFAULT_CALL To(const uint32_t aValue, float*) {
+			return (static_cast<float>(aValue % 100000) - 50000.0f) / 7.0f;
+		}
+
+		static double SOLAIRE_DEFAULT_CALL To(const uint32_t aValue, double*) {
+			return (static_cast<double>(aValue) - 2147483648.0) / 3.0;
+		}
+	};
+
+	template<class T>
+	std::vector<T> SOLAIRE_DEFAULT_CALL Generate(const Pattern aPattern, const uint32_t aSize) {
+		const std::vector<uint32_t> values = Generate(aPattern, aSize);
+		std::vector<T> result(aSize);
+		for(uint32_t i = 0; i < aSize; ++i) result[i] = Convert::To(values[i], static_cast<T*>(nullptr));
+
+		// Floating point keys also need both zeros and both infinities, placed so that they are not already in order
+		if(std::is_floating_point<T>::value && aPattern == PATTERN_RANDOM && aSize >= 8) {
+			result[aSize / 8] = std::numeric_limits<T>::infinity();
+			result[aSize / 4] = static_cast<T>(-0.0);
+			result[aSize / 2] = static_cast<T>(0.0);
+			result[aSize - 1] = -std::numeric_limits<T>::infinity();
+		}
+		return result;
+	}
+
+	template<class T, class C>
+	void SOLAIRE_DEFAULT_CALL TestSort(const char* const aType, C aCompare) {
+		for(uint32_t p = 0; p < PATTERN_COUNT; ++p) {
+			for(const uint32_t size : SIZES) {
+				const Pattern pattern = static_cast<Pattern>(p);
+				std::vector<T> expected = Generate<T>(pattern, size);
+				std::vector<T> actual = expected;
+				std::sort(expected.begin(), expected.end(), aCompare);
+				Sort(actual.data(), size, aCompare);
+				Check(actual == expected, "Sort", aType, pattern, size);
+			}
+		}
+	}
+
+	template<class T>
+	void SOLAIRE_DEFAULT_CALL TestRadixSort(Allocator& aAllocator, const char* const aType) {
+		for(uint32_t p = 0; p < PATTERN_COUNT; ++p) {
+			for(const uint32_t size : SIZES) {
+				const Pattern pattern = static_cast<Pattern>(p);
+				std::vector<T> expected = Generate<T>(pattern, size);
+				std::vector<T> actual = expected;
+				std::sort(expected.begin(), expected.end());
+				RadixSort(actual.data(), size, aAllocator);
+				Check(actual == expected, "RadixSort", aType, pattern, size);
+
+				// -0 and +0 compare equal, so their order is checked separately
+				bool zeros = true;
+				if(std::is_floating_point<T>::value) {
+					bool positiveZero = false;
+					for(const T value : actual) {
+						if(value != static_cast<T>(0)) continue;
+						if(std::signbit(value)) zeros = zeros && ! positiveZero;
+						else positiveZero = true;
+					}
+				}
+				Check(zeros, "RadixSort ordering of zeros", aType, pattern, size);
+			}
+		}
+	}
+
+	struct Record {
+		float Key;
+		uint32_t Index;
+	};
+
+	void SOLAIRE_DEFAULT_CALL TestRadixStability(Allocator& aAllocator) {
+		for(uint32_t p = 0; p < PATTERN_COUNT; ++p) {
+			for(const uint32_t size : SIZES) {
+				const Pattern pattern = static_cast<Pattern>(p);
+				const std::vector<uint32_t> values = Generate(pattern, size);
+				std::vector<Record> records(size);
+				for(uint32_t i = 0; i < size; ++i) records[i] = Record{static_cast<float>(values[i] % 16) - 8.0f, i};
+
+				std::vector<Record> expected = records;
+				std::stable_sort(expected.begin(), expected.end(), [](const Record& aFirst, const Record& aSecond) {
+					return aFirst.Key < aSecond.Key;
+				});
+				RadixSort(records.data(), size, aAllocator, [](const Record& aRecord) {
+					return aRecord.Key;
+				});
+
+				bool result = true;
+				for(uint32_t i = 0; i < size && result; ++i) result = records[i].Index == expected[i].Index;
+				Check(result, "RadixSort stability", "Record", pattern, size);
+			}
+		}
+	}
+
+	template<class T, class C>
+	void SOLAIRE_DEFAULT_CALL TestParallelSort(TaskScheduler& aScheduler, const char* const aType, C aCompare) {
+		for(uint32_t p = 0; p < PATTERN_COUNT; ++p) {
+			for(const uint32_t size : SIZES) {
+				const Pattern pattern = static_cast<Pattern>(p);
+				std::vector<T> expected = Generate<T>(pattern, size);
+				std::vector<T> actual = expected;
+				std::sort(expected.begin(), expected.end(), aCompare);
+				ParallelSort(aScheduler, actual.data(), size, aCompare);
+				Check(actual == expected, "ParallelSort", aType, pattern, size);
+			}
+		}
+	}
+
+	void SOLAIRE_DEFAULT_CALL TestContainers(Allocator& aAllocator, TaskScheduler& aScheduler) {
+		const std::vector<uint32_t> values = Generate(PATTERN_RANDOM, 10000);
+		std::vector<uint32_t> expected = values;
+		std::sort(expected.begin(), expected.end());
+
+		DynamicArray<uint32_t> array(aAllocator);
+		for(const uint32_t value : values) array.PushBack(value);
+		Sort(array);
+		bool result = true;
+		for(uint32_t i = 0; i < array.Size() && result; ++i) result = array[i] == expected[i];
+		Check(result, "Sort", "DynamicArray", PATTERN_RANDOM, array.Size());
+
+		array.Clear();
+		for(const uint32_t value : values) array.PushBack(value);
+		RadixSort(array);
+		result = true;
+		for(uint32_t i = 0; i < array.Size() && result; ++i) result = array[i] == expected[i];
+		Check(result, "RadixSort", "DynamicArray", PATTERN_RANDOM, array.Size());
+
+		array.Clear();
+		for(const uint32_t value : values) array.PushBack(value);
+		ParallelSort(aScheduler, array);
+		result = true;
+		for(uint32_t i = 0; i < array.Size() && result; ++i) result = array[i] == expected[i];
+		Check(result, "ParallelSort", "DynamicArray", PATTERN_RANDOM, array.Size());
+	}
+}
+
+int main() {
+	MallocAllocator allocator;
+	{
+		TestSort<uint32_t>("uint32_t", std::less<uint32_t>());
+		TestSort<uint32_t>("uint32_t descending", std::greater<uint32_t>());
+		TestSort<double>("double", std::less<double>());
+
+		TestRadixSort<uint32_t>(allocator, "uint32_t");
+		TestRadixSort<int32_t>(allocator, "int32_t");
+		TestRadixSort<uint64_t>(allocator, "uint64_t");
+		TestRadixSort<float>(allocator, "float");
+		TestRadixSort<double>(allocator, "double");
+		TestRadixStability(allocator);
+
+		TaskScheduler scheduler(allocator, THREADS);
+		TestParallelSort<uint32_t>(scheduler, "uint32_t", std::less<uint32_t>());
+		TestParallelSort<uint32_t>(scheduler, "uint32_t descending", std::greater<uint32_t>());
+		TestParallelSort<float>(scheduler, "float", std::less<float>());
+		TestContainers(allocator, scheduler);
+	}
+
+	if(allocator.GetAllocationCount() != 0) {
+		std::fprintf(stderr, "Sort : memory was not deallocated\n");
+		gPassed = false;
+	}
+
+	std::printf("Sort : %s\n", gPassed ? "passed" : "failed");
+	return gPassed ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -0,0 +1,175 @@
+//Copyright 2015 Adam Smith
+//
+//Licensed under the Apache License, Version 2.0 (the "License");
+//you may not use this file except in compliance with the License.
+//You may obtain a copy of the License at
+//
+//    http://www.apache.org/licenses/LICENSE-2.0
+//
+//Unless required by applicable law or agreed to in writing, software
+//distributed under the License is distributed on an "AS IS" BASIS,
+//WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//See the License for the specific language governing permissions and
+//limitations under the License.
+
+// Contact :
+// Email             : solairelibrary@mail.com
+// GitHub repository : https://github.com/SolaireLibrary/SolaireCPP
+
+/*!
+	\file SortBenchmark.cpp
+	\brief Benchmark comparing Sort, RadixSort and ParallelSort with std::sort.
+	\detail
+	Sorts uint32_t and float keys at sizes from one thousand to four million elements, on random, sorted and few unique
+	inputs. Each sort is timed on a fresh copy of the input and the fastest of several repeats is printed in milliseconds.
+	ParallelSort uses one worker per hardware thread, or the number of workers given as the first argument.
+	\author
+	Created			: Adam Smith
+	Last modified	: Adam Smith
+	\version 1.0
+	\date
+	Created			: 18th October 2026
+	Last Modified	: 18th October 2026
+*/
+
+#include <cstdio>
+#include <cstdlib>
+#include <algorithm>
+#include <chrono>
+#include <vector>
+#include "Solaire\Core\Sort.hpp"
+#include "Solaire\Core\TaskScheduler.hpp"
+
+using namespace Solaire;
+
+namespace {
+
+	class MallocAllocator : public Allocator {
+	public:
+		uint32_t SOLAIRE_EXPORT_CALL GetAllocatedBytes() const throw() override {
+			return 0;
+		}
+
+		uint32_t SOLAIRE_EXPORT_CALL GetFreeBytes() const throw() override {
+			return UINT32_MAX;
+		}
+
+		uint32_t SOLAIRE_EXPORT_CALL SizeOf(const void* const) throw() override {
+			return 0;
+		}
+
+		void* SOLAIRE_EXPORT_CALL Allocate(const size_t aBytes) throw() override {
+			return std::malloc(aBytes);
+		}
+
+		bool SOLAIRE_EXPORT_CALL Deallocate(const void* const aObject) throw() override {
+			std::free(const_cast<void*>(aObject));
+			return true;
+		}
+
+		bool SOLAIRE_EXPORT_CALL DeallocateAll() throw() override {
+			return false;
+		}
+	};
+
+	enum Pattern : uint32_t {
+		PATTERN_RANDOM,
+		PATTERN_SORTED,
+		PATTERN_FEW_UNIQUE,
+		PATTERN_COUNT
+	};
+
+	const char* const PATTERN_NAMES[PATTERN_COUNT] = {
+		"random", "sorted", "few unique"
+	};
+
+	const uint32_t SIZES[] = {1000, 100000, 1 << 22};
+
+	enum : uint32_t {
+		REPEATS = 5
+	};
+
+	inline SOLAIRE_FORCE_INLINE uint32_t SOLAIRE_DEFAULT_CALL NextRandom(uint32_t& aSeed) throw() {
+		aSeed ^= aSeed << 13;
+		aSeed ^= aSeed >> 17;
+		aSeed ^= aSeed << 5;
+		return aSeed;
+	}
+
+	template<class T>
+	std::vector<T> SOLAIRE_DEFAULT_CALL Generate(const Pattern aPattern, const uint32_t aSize) {
+		std::vector<T> values(aSize);
+		uint32_t seed = 0x9E3779B9;
+		for(uint32_t i = 0; i < aSize; ++i) {
+			switch(aPattern) {
+			case PATTERN_RANDOM:
+				values[i] = static_cast<T>(NextRandom(seed));
+				break;
+			case PATTERN_SORTED:
+				values[i] = static_cast<T>(i);
+				break;
+			default:
+				values[i] = static_cast<T>(NextRandom(seed) % 16);
+				break;
+			}
+		}
+		return values;
+	}
+
+	// Returns the fastest time in milliseconds, and checks the result against the reference so a broken sort is not timed
+	template<class T, class F>
+	double SOLAIRE_DEFAULT_CALL Time(const std::vector<T>& aInput, const std::vector<T>& aExpected, bool& aPassed, F aSort) {
+		double best = 0.0;
+		for(uint32_t i = 0; i < REPEATS; ++i) {
+			std::vector<T> values = aInput;
+			const auto begin = std::chrono::steady_clock::now();
+			aSort(values.data(), static_cast<uint32_t>(values.size()));
+			const auto end = std::chrono::steady_clock::now();
+			const double milliseconds = std::chrono::duration<double, std::milli>(end - begin).count();
+			if(i == 0 || milliseconds < best) best = milliseconds;
+			aPassed = aPassed && values == aExpected;
+		}
+		return best;
+	}
+
+	template<class T>
+	bool SOLAIRE_DEFAULT_CALL Run(Allocator& aAllocator, TaskScheduler& aScheduler, const char* const aType) {
+		bool passed = true;
+		for(uint32_t p = 0; p < PATTERN_COUNT; ++p) {
+			for(const uint32_t size : SIZES) {
+				const std::vector<T> input = Generate<T>(static_cast<Pattern>(p), size);
+				std::vector<T> expected = input;
+				std::sort(expected.begin(), expected.end());
+
+				const double standard = Time(input, expected, passed, [](T* const aData, const uint32_t aCount) {
+					std::sort(aData, aData + aCount);
+				});
+				const double sort = Time(input, expected, passed, [](T* const aData, const uint32_t aCount) {
+					Sort(aData, aCount);
+				});
+				const double radix = Time(input, expected, passed, [&aAllocator](T* const aData, const uint32_t aCount) {
+					RadixSort(aData, aCount, aAllocator);
+				});
+				const double parallel = Time(input, expected, passed, [&aScheduler](T* const aData, const uint32_t aCount) {
+					ParallelSort(aScheduler, aData, aCount);
+				});
+				std::printf("%-8s %-12s %10u %12.3f %12.3f %12.3f %12.3f\n", aType, PATTERN_NAMES[p], size, standard, sort, radix, parallel);
+			}
+		}
+		return passed;
+	}
+}
+
+int main(int aArgCount, char** aArgs) {
+	MallocAllocator allocator;
+	const uint32_t threads = aArgCount > 1 ? std::strtoul(aArgs[1], nullptr, 10) : 0;
+	TaskScheduler scheduler(allocator, threads);
+
+	std::printf("ParallelSort workers : %u\n", scheduler.GetThreadCount());
+	std::printf("%-8s %-12s %10s %12s %12s %12s %12s\n", "type", "input", "size", "std::sort ms", "Sort ms", "Radix ms", "Parallel ms");
+	bool passed = Run<uint32_t>(allocator, scheduler, "uint32_t");
+	passed = Run<float>(allocator, scheduler, "float") && passed;
+
+	std::printf("Sort : %s\n", passed ? "passed" : "failed");
+	return passed ? EXIT_SUCCESS : EXIT_FAILURE;
+}
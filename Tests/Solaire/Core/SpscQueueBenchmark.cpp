@@ -0,0 +1,270 @@
+//Copyright 2015 Adam Smith
+//
+//Licensed under the Apache License, Version 2.0 (the "License");
+//you may not use this file except in compliance with the License.
+//You may obtain a copy of the License at
+//
+//    http://www.apache.org/licenses/LICENSE-2.0
+//
+//Unless required by applicable law or agreed to in writing, software
+//distributed under the License is distributed on an "AS IS" BASIS,
+//WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//See the License for the specific language governing permissions and
+//limitations under the License.
+
+// Contact :
+// Email             : solairelibrary@mail.com
+// GitHub repository : https://github.com/SolaireLibrary/SolaireCPP
+
+/*!
+	\file SpscQueueBenchmark.cpp
+	\brief Throughput and latency benchmark for SpscQueue.
+	\detail
+	Throughput : a producer thread passes a sequence of integers to a consumer thread, one element at a time with TryPush
+	and TryPop, in batches with PushRange and PopRange, and in place with Consume. Each is run at several capacities, with
+	a std::deque behind a mutex for comparison, and prints millions of elements per second.
+	Latency : two threads pass a single element back and forth through a pair of queues, and the median and 99th
+	percentile round trip times are printed.
+	A thread that finds its queue full or empty yields, so the results are still meaningful when both threads share a core.
+	Every element is checked to arrive in order. Returns 0 on success.
+	\author
+	Created			: Adam Smith
+	Last modified	: Adam Smith
+	\version 1.0
+	\date
+	Created			: 18th October 2026
+	Last Modified	: 18th October 2026
+*/
+
+#include <cstdio>
+#include <cstdlib>
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <deque>
+#include <mutex>
+#include <thread>
+#include <vector>
+#include "Solaire\Core\SpscQueue.hpp"
+
+using namespace Solaire;
+
+namespace {
+
+	class MallocAllocator : public AllocatorI {
+	public:
+		uint32_t SOLAIRE_EXPORT_CALL GetAllocatedBytes() const throw() override {
+			return 0;
+		}
+
+		uint32_t SOLAIRE_EXPORT_CALL GetFreeBytes() const throw() override {
+			return UINT32_MAX;
+		}
+
+		uint32_t SOLAIRE_EXPORT_CALL SizeOf(const void* const) throw() override {
+			return 0;
+		}
+
+		void* SOLAIRE_EXPORT_CALL Allocate(const size_t aBytes) throw() override {
+			return std::malloc(aBytes);
+		}
+
+		bool SOLAIRE_EXPORT_CALL Deallocate(const void* const aObject) throw() override {
+			std::free(const_cast<void*>(aObject));
+			return true;
+		}
+
+		bool SOLAIRE_EXPORT_CALL DeallocateAll() throw() override {
+			return false;
+		}
+	};
+
+	enum : uint32_t {
+		ELEMENTS = 1 << 22,
+		BATCH = 64,
+		ROUND_TRIPS = 100000
+	};
+
+	const uint32_t CAPACITIES[] = {64, 1024, 65536};
+
+	std::atomic<bool> gPassed(true);
+
+	void SOLAIRE_DEFAULT_CALL Fail(const char* const aName, const uint64_t aExpected, const uint64_t aActual) {
+		if(gPassed.exchange(false)) {
+			std::fprintf(stderr, "SpscQueue : %s expected %llu but received %llu\n", aName, static_cast<unsigned long long>(aExpected), static_cast<unsigned long long>(aActual));
+		}
+	}
+
+	// Each target has a producer function Push and a consumer function Pop, which both return the number of elements moved
+
+	class SingleTarget {
+	private:
+		SpscQueue<uint64_t> mQueue;
+	public:
+		SingleTarget(AllocatorI& aAllocator, const uint32_t aCapacity) :
+			mQueue(aAllocator, aCapacity)
+		{}
+
+		SOLAIRE_FORCE_INLINE uint32_t SOLAIRE_DEFAULT_CALL Push(const uint64_t* const aValues, const uint32_t) {
+			return mQueue.TryPush(*aValues) ? 1 : 0;
+		}
+
+		SOLAIRE_FORCE_INLINE uint32_t SOLAIRE_DEFAULT_CALL Pop(uint64_t* const aValues) {
+			return mQueue.TryPop(*aValues) ? 1 : 0;
+		}
+	};
+
+	class RangeTarget {
+	private:
+		SpscQueue<uint64_t> mQueue;
+	public:
+		RangeTarget(AllocatorI& aAllocator, const uint32_t aCapacity) :
+			mQueue(aAllocator, aCapacity)
+		{}
+
+		SOLAIRE_FORCE_INLINE uint32_t SOLAIRE_DEFAULT_CALL Push(const uint64_t* const aValues, const uint32_t aCount) {
+			return mQueue.PushRange(aValues, aCount);
+		}
+
+		SOLAIRE_FORCE_INLINE uint32_t SOLAIRE_DEFAULT_CALL Pop(uint64_t* const aValues) {
+			return mQueue.PopRange(aValues, BATCH);
+		}
+	};
+
+	class ConsumeTarget {
+	private:
+		SpscQueue<uint64_t> mQueue;
+	public:
+		ConsumeTarget(AllocatorI& aAllocator, const uint32_t aCapacity) :
+			mQueue(aAllocator, aCapacity)
+		{}
+
+		SOLAIRE_FORCE_INLINE uint32_t SOLAIRE_DEFAULT_CALL Push(const uint64_t* const aValues, const uint32_t aCount) {
+			return mQueue.PushRange(aValues, aCount);
+		}
+
+		SOLAIRE_FORCE_INLINE uint32_t SOLAIRE_DEFAULT_CALL Pop(uint64_t* const aValues) {
+			uint32_t count = 0;
+			mQueue.Consume([&](const uint64_t* const aSpan, const uint32_t aLength) {
+				for(uint32_t i = 0; i < aLength; ++i) aValues[count++] = aSpan[i];
+			}, BATCH);
+			return count;
+		}
+	};
+
+	class LockedTarget {
+	private:
+		std::mutex mLock;
+		std::deque<uint64_t> mQueue;
+		const uint32_t mCapacity;
+	public:
+		LockedTarget(AllocatorI&, const uint32_t aCapacity) :
+			mCapacity(aCapacity)
+		{}
+
+		SOLAIRE_FORCE_INLINE uint32_t SOLAIRE_DEFAULT_CALL Push(const uint64_t* const aValues, const uint32_t aCount) {
+			std::lock_guard<std::mutex> lock(mLock);
+			const uint32_t count = std::min<uint32_t>(aCount, mCapacity - static_cast<uint32_t>(mQueue.size()));
+			mQueue.insert(mQueue.end(), aValues, aValues + count);
+			return count;
+		}
+
+		SOLAIRE_FORCE_INLINE uint32_t SOLAIRE_DEFAULT_CALL Pop(uint64_t* const aValues) {
+			std::lock_guard<std::mutex> lock(mLock);
+			const uint32_t count = std::min<uint32_t>(BATCH, static_cast<uint32_t>(mQueue.size()));
+			std::copy(mQueue.begin(), mQueue.begin() + count, aValues);
+			mQueue.erase(mQueue.begin(), mQueue.begin() + count);
+			return count;
+		}
+	};
+
+	template<class TARGET>
+	double SOLAIRE_DEFAULT_CALL RunThroughput(AllocatorI& aAllocator, const char* const aName, const uint32_t aCapacity) {
+		TARGET target(aAllocator, aCapacity);
+		std::atomic<bool> start(false);
+
+		std::thread producer([&]() {
+			uint64_t values[BATCH];
+			uint64_t next = 0;
+			while(! start.load(std::memory_order_acquire)) std::this_thread::yield();
+			while(next < ELEMENTS) {
+				const uint32_t count = static_cast<uint32_t>(std::min<uint64_t>(BATCH, ELEMENTS - next));
+				for(uint32_t i = 0; i < count; ++i) values[i] = next + i;
+				uint32_t pushed = 0;
+				while(pushed < count) {
+					const uint32_t moved = target.Push(values + pushed, count - pushed);
+					if(moved == 0) std::this_thread::yield();
+					pushed += moved;
+				}
+				next += count;
+			}
+		});
+
+		const auto begin = std::chrono::steady_clock::now();
+		start.store(true, std::memory_order_release);
+		uint64_t values[BATCH];
+		uint64_t expected = 0;
+		while(expected < ELEMENTS) {
+			const uint32_t count = target.Pop(values);
+			if(count == 0) std::this_thread::yield();
+			for(uint32_t i = 0; i < count; ++i) {
+				if(values[i] != expected) Fail(aName, expected, values[i]);
+				++expected;
+			}
+		}
+		const auto end = std::chrono::steady_clock::now();
+		producer.join();
+
+		const double seconds = std::chrono::duration<double>(end - begin).count();
+		return static_cast<double>(ELEMENTS) / seconds / 1000000.0;
+	}
+
+	void SOLAIRE_DEFAULT_CALL RunLatency(AllocatorI& aAllocator) {
+		SpscQueue<uint64_t> request(aAllocator, 64);
+		SpscQueue<uint64_t> response(aAllocator, 64);
+
+		std::thread echo([&]() {
+			uint64_t value = 0;
+			for(uint32_t i = 0; i < ROUND_TRIPS; ++i) {
+				while(! request.TryPop(value)) std::this_thread::yield();
+				while(! response.TryPush(value)) std::this_thread::yield();
+			}
+		});
+
+		std::vector<double> nanoseconds(ROUND_TRIPS);
+		for(uint32_t i = 0; i < ROUND_TRIPS; ++i) {
+			uint64_t value = 0;
+			const auto begin = std::chrono::steady_clock::now();
+			while(! request.TryPush(i)) std::this_thread::yield();
+			while(! response.TryPop(value)) std::this_thread::yield();
+			const auto end = std::chrono::steady_clock::now();
+			if(value != i) Fail("round trip", i, value);
+			nanoseconds[i] = std::chrono::duration<double, std::nano>(end - begin).count();
+		}
+		echo.join();
+
+		std::sort(nanoseconds.begin(), nanoseconds.end());
+		std::printf("%-12s %12.0f %12.0f\n", "round trip", nanoseconds[ROUND_TRIPS / 2], nanoseconds[(ROUND_TRIPS / 100) * 99]);
+	}
+}
+
+int main() {
+	MallocAllocator allocator;
+
+	std::printf("throughput, millions of elements per second\n");
+	std::printf("%-12s %12s %12s %12s %12s\n", "capacity", "single", "range", "consume", "mutex");
+	for(const uint32_t capacity : CAPACITIES) {
+		const double single = RunThroughput<SingleTarget>(allocator, "TryPop", capacity);
+		const double range = RunThroughput<RangeTarget>(allocator, "PopRange", capacity);
+		const double consume = RunThroughput<ConsumeTarget>(allocator, "Consume", capacity);
+		const double locked = RunThroughput<LockedTarget>(allocator, "mutex", capacity);
+		std::printf("%-12u %12.2f %12.2f %12.2f %12.2f\n", capacity, single, range, consume, locked);
+	}
+
+	std::printf("\nlatency, nanoseconds\n");
+	std::printf("%-12s %12s %12s\n", "", "p50", "p99");
+	RunLatency(allocator);
+
+	std::printf("SpscQueue : %s\n", gPassed ? "passed" : "failed");
+	return gPassed ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -0,0 +1,163 @@
+//Copyright 2015 Adam Smith
+//
+//Licensed under the Apache License, Version 2.0 (the "License");
+//you may not use this file except in compliance with the License.
+//You may obtain a copy of the License at
+//
+//    http://www.apache.org/licenses/LICENSE-2.0
+//
+//Unless required by applicable law or agreed to in writing, software
+//distributed under the License is distributed on an "AS IS" BASIS,
+//WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//See the License for the specific language governing permissions and
+//limitations under the License.
+
+// Contact :
+// Email             : solairelibrary@mail.com
+// GitHub repository : https://github.com/SolaireLibrary/SolaireCPP
+
+/*!
+	\file WorkStealingDeque.cpp
+	\brief Linearizability stress test for WorkStealingDeque.
+	\detail
+	The owner thread pushes a sequence of items and pops some of them back while several thieves steal from the top.
+	Every item must be taken exactly once, by either the owner or a thief. The deque starts small so that it grows while
+	thieves are reading from it. Returns 0 on success.
+	\author
+	Created			: Adam Smith
+	Last modified	: Adam Smith
+	\version 1.0
+	\date
+	Created			: 18th October 2026
+	Last Modified	: 18th October 2026
+*/
+
+#include <cstdio>
+#include <cstdlib>
+#include <atomic>
+#include <thread>
+#include <vector>
+#include "Solaire\Core\WorkStealingDeque.hpp"
+
+using namespace Solaire;
+
+namespace {
+
+	class MallocAllocator : public AllocatorI {
+	private:
+		std::atomic<uint32_t> mAllocations;
+	public:
+		MallocAllocator() :
+			mAllocations(0)
+		{}
+
+		uint32_t SOLAIRE_EXPORT_CALL GetAllocatedBytes() const throw() override {
+			return 0;
+		}
+
+		uint32_t SOLAIRE_EXPORT_CALL GetFreeBytes() const throw() override {
+			return UINT32_MAX;
+		}
+
+		uint32_t SOLAIRE_EXPORT_CALL SizeOf(const void* const) throw() override {
+			return 0;
+		}
+
+		void* SOLAIRE_EXPORT_CALL Allocate(const size_t aBytes) throw() override {
+			++mAllocations;
+			return std::malloc(aBytes);
+		}
+
+		bool SOLAIRE_EXPORT_CALL Deallocate(const void* const aObject) throw() override {
+			--mAllocations;
+			std::free(const_cast<void*>(aObject));
+			return true;
+		}
+
+		bool SOLAIRE_EXPORT_CALL DeallocateAll() throw() override {
+			return false;
+		}
+
+		uint32_t SOLAIRE_DEFAULT_CALL GetAllocationCount() const throw() {
+			return mAllocations;
+		}
+	};
+
+	enum : uint32_t {
+		ROUNDS = 20,
+		ITEMS = 200000,
+		INITIAL_CAPACITY = 16
+	};
+
+	bool SOLAIRE_DEFAULT_CALL RunRound(MallocAllocator& aAllocator, const uint32_t aThieves, const uint32_t aSeed) {
+		WorkStealingDeque<uint32_t> deque(aAllocator, INITIAL_CAPACITY);
+		std::vector<std::atomic<uint32_t>> taken(ITEMS);
+		for(std::atomic<uint32_t>& count : taken) count = 0;
+		std::atomic<bool> done(false);
+		std::atomic<uint32_t> invalid(0);
+
+		const auto take = [&](const uint32_t aItem) {
+			if(aItem >= ITEMS) ++invalid;
+			else ++taken[aItem];
+		};
+
+		std::vector<std::thread> thieves;
+		for(uint32_t i = 0; i < aThieves; ++i) {
+			thieves.emplace_back([&]() {
+				uint32_t item;
+				while(! done.load(std::memory_order_acquire)) {
+					if(deque.Steal(item)) take(item);
+					else std::this_thread::yield();
+				}
+				while(deque.Steal(item)) take(item);
+			});
+		}
+
+		// The owner pops after roughly one push in three, so it races the thieves for the last element
+		uint32_t seed = aSeed;
+		uint32_t item;
+		for(uint32_t i = 0; i < ITEMS; ++i) {
+			deque.Push(i);
+			seed ^= seed << 13;
+			seed ^= seed >> 17;
+			seed ^= seed << 5;
+			if(seed % 3 == 0 && deque.Pop(item)) take(item);
+		}
+		while(deque.Pop(item)) take(item);
+
+		done.store(true, std::memory_order_release);
+		for(std::thread& thief : thieves) thief.join();
+
+		bool result = invalid == 0;
+		for(uint32_t i = 0; i < ITEMS; ++i) {
+			const uint32_t count = taken[i];
+			if(count != 1) {
+				std::fprintf(stderr, "WorkStealingDeque : item %u was taken %u times\n", i, count);
+				result = false;
+			}
+		}
+		if(! deque.IsEmpty()) {
+			std::fprintf(stderr, "WorkStealingDeque : deque is not empty after every item was taken\n");
+			result = false;
+		}
+		return result;
+	}
+}
+
+int main() {
+	MallocAllocator allocator;
+	const uint32_t thieves = std::thread::hardware_concurrency() > 2 ? std::thread::hardware_concurrency() - 1 : 3;
+
+	bool result = true;
+	for(uint32_t i = 0; i < ROUNDS && result; ++i) {
+		result = RunRound(allocator, thieves, (i + 1) * 0x9E3779B9);
+	}
+
+	if(allocator.GetAllocationCount() != 0) {
+		std::fprintf(stderr, "WorkStealingDeque : %u buffers were not deallocated\n", allocator.GetAllocationCount());
+		result = false;
+	}
+
+	std::printf("WorkStealingDeque : %s\n", result ? "passed" : "failed");
+	return result ? EXIT_SUCCESS : EXIT_FAILURE;
+}